@@ -154,11 +154,15 @@ void File::Write(const std::string &name, const std::string &stringValue,
 
 std::string File::ReadString(const std::string &name, const bool endl)
 {
+    PerformDeferredGets(name, endl);
+
     return m_Stream->Read<std::string>(name, endl).front();
 }
 
 std::string File::ReadString(const std::string &name, const size_t step)
 {
+    PerformDeferredGets(name, false);
+
     std::string value;
     m_Stream->Read<std::string>(name, &value, Box<size_t>(step, 1));
     return value;
@@ -166,6 +170,8 @@ std::string File::ReadString(const std::string &name, const size_t step)
 
 pybind11::array File::Read(const std::string &name, const bool endl)
 {
+    PerformDeferredGets(name, endl);
+
     const std::string type = m_Stream->m_IO->InquireVariableType(name);
 
     if (type == "string")
@@ -214,6 +220,8 @@ pybind11::array File::Read(const std::string &name, const bool endl)
 pybind11::array File::Read(const std::string &name, const Dims &selectionStart,
                            const Dims &selectionCount, const bool endl)
 {
+    PerformDeferredGets(name, endl);
+
     const std::string type = m_Stream->m_IO->InquireVariableType(name);
 
     if (type.empty())
@@ -241,6 +249,8 @@ pybind11::array File::Read(const std::string &name, const Dims &selectionStart,
                            const size_t stepSelectionStart,
                            const size_t stepSelectionCount)
 {
+    PerformDeferredGets(name, false);
+
     // shape of the returned numpy array
     Dims shapePy(selectionCount.size() + 1);
     shapePy[0] = stepSelectionCount;
@@ -275,8 +285,85 @@ pybind11::array File::Read(const std::string &name, const Dims &selectionStart,
     return pybind11::array();
 }
 
+void File::ReadInto(const std::string &name, pybind11::array &array,
+                    const Dims &start, const Dims &count, const bool endl)
+{
+    PerformDeferredGets(name, endl);
+
+    const std::string type = m_Stream->m_IO->InquireVariableType(name);
+
+    if (type.empty())
+    {
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetType<T>())                                     \
+    {                                                                          \
+        const Box<Dims> selection = ArraySelection<T>(name, start, count);     \
+        T *data = ArrayData<T>(name, array, selection.second, "read_into");    \
+        if (selection.second.empty())                                          \
+        {                                                                      \
+            m_Stream->Read<T>(name, data, endl);                               \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            m_Stream->Read<T>(name, data, selection, endl);                    \
+        }                                                                      \
+        return;                                                                \
+    }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
+
+    throw std::invalid_argument(
+        "ERROR: adios2 file read variable " + name +
+        ", type can't be mapped to a numpy type, in call to read_into\n");
+}
+
+void File::ReadDeferred(const std::string &name, pybind11::array &array,
+                        const Dims &start, const Dims &count)
+{
+    if (m_DeferredArrays.count(name) == 1)
+    {
+        throw std::invalid_argument(
+            "ERROR: adios2 file variable " + name +
+            " has a pending deferred read, call perform_gets first, in call "
+            "to read_deferred\n");
+    }
+
+    const std::string type = m_Stream->m_IO->InquireVariableType(name);
+
+    if (type.empty())
+    {
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetType<T>())                                     \
+    {                                                                          \
+        const Box<Dims> selection = ArraySelection<T>(name, start, count);     \
+        T *data =                                                              \
+            ArrayData<T>(name, array, selection.second, "read_deferred");      \
+        m_Stream->ReadDeferred<T>(name, data, selection);                      \
+        m_DeferredArrays.emplace(name, array);                                 \
+        return;                                                                \
+    }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
+
+    throw std::invalid_argument(
+        "ERROR: adios2 file read variable " + name +
+        ", type can't be mapped to a numpy type, in call to read_deferred\n");
+}
+
+void File::PerformGets()
+{
+    m_Stream->PerformGets();
+    m_DeferredArrays.clear();
+}
+
 void File::Close()
 {
+    if (!m_DeferredArrays.empty())
+    {
+        PerformGets();
+    }
     m_Stream->Close();
     m_IsClosed = true;
 }
@@ -284,5 +371,71 @@ void File::Close()
 bool File::IsClosed() const noexcept { return m_IsClosed; }
 
 size_t File::CurrentStep() const { return m_Stream->m_Engine->CurrentStep(); };
+
+// PRIVATE
+void File::PerformDeferredGets(const std::string &name, const bool endl)
+{
+    // a read of the same variable would overwrite the pending selection and
+    // data pointer, a step change would read the pending one at the next step
+    if (m_DeferredArrays.count(name) == 1 ||
+        (endl && !m_DeferredArrays.empty()))
+    {
+        PerformGets();
+    }
+}
+
+template <class T>
+T *File::ArrayData(const std::string &name, pybind11::array &array,
+                   const Dims &count, const std::string hint) const
+{
+    if (!pybind11::isinstance<pybind11::array_t<T, pybind11::array::c_style>>(
+            array))
+    {
+        throw std::invalid_argument(
+            "ERROR: adios2 file read variable " + name + " of type " +
+            helper::GetType<T>() +
+            ", numpy array is either of a different type or not c_style "
+            "memory contiguous, in call to " +
+            hint + "\n");
+    }
+
+    if (!array.writeable())
+    {
+        throw std::invalid_argument("ERROR: adios2 file read variable " +
+                                    name +
+                                    ", numpy array is read only, in call to " +
+                                    hint + "\n");
+    }
+
+    const size_t size = helper::GetTotalSize(count);
+    if (static_cast<size_t>(array.size()) != size)
+    {
+        throw std::invalid_argument(
+            "ERROR: adios2 file read variable " + name + ", numpy array has " +
+            std::to_string(array.size()) + " elements, selection has " +
+            std::to_string(size) + ", in call to " + hint + "\n");
+    }
+
+    return reinterpret_cast<T *>(array.mutable_data());
+}
+
+template <class T>
+Box<Dims> File::ArraySelection(const std::string &name, const Dims &start,
+                               const Dims &count) const
+{
+    const core::Variable<T> &variable =
+        *m_Stream->m_IO->InquireVariable<T>(name);
+
+    if (variable.m_SingleValue)
+    {
+        return Box<Dims>();
+    }
+
+    const Dims &selectionCount = count.empty() ? variable.m_Shape : count;
+    const Dims selectionStart =
+        start.empty() ? Dims(selectionCount.size(), 0) : start;
+    return Box<Dims>(selectionStart, selectionCount);
+}
+
 } // end namespace py11
 } // end namespace adios2
@@ -13,6 +13,9 @@
 
 #include <pybind11/numpy.h>
 
+#include <map>
+#include <string>
+
 #include "adios2/ADIOSMPICommOnly.h"
 #include "adios2/ADIOSTypes.h"
 #include "adios2/core/Stream.h"
@@ -77,6 +80,30 @@ public:
                          const Dims &selectionCount,
                          const size_t stepSelectionStart,
                          const size_t stepSelectionCount);
+    /**
+     * Reads a selection straight into a preallocated numpy array
+     * @param name variable name
+     * @param array c_style contiguous, writeable, same type as the variable
+     * and size of count
+     * @param start empty: zeros, or a single value
+     * @param count empty: variable shape, or a single value
+     * @param endl true: advance to the next step after reading
+     */
+    void ReadInto(const std::string &name, pybind11::array &array,
+                  const Dims &start = Dims(), const Dims &count = Dims(),
+                  const bool endl = false);
+
+    /**
+     * Same as ReadInto, but array is filled at PerformGets (or Close), which
+     * executes all deferred reads at once, one per variable until then.
+     * Other reads of the same variable, or advancing the step, perform the
+     * pending ones first.
+     */
+    void ReadDeferred(const std::string &name, pybind11::array &array,
+                      const Dims &start = Dims(), const Dims &count = Dims());
+
+    void PerformGets();
+
     void Close();
 
     bool IsClosed() const noexcept;
@@ -86,6 +113,23 @@ public:
 private:
     std::shared_ptr<core::Stream> m_Stream;
     bool m_IsClosed = true;
+
+    /** arrays of ReadDeferred kept alive until PerformGets, key: variable */
+    std::map<std::string, pybind11::array> m_DeferredArrays;
+
+    /** runs pending deferred reads before a read of name, or before any
+     * read advancing the step (endl = true) */
+    void PerformDeferredGets(const std::string &name, const bool endl);
+
+    /** checks array can receive the selection, returns its data */
+    template <class T>
+    T *ArrayData(const std::string &name, pybind11::array &array,
+                 const Dims &count, const std::string hint) const;
+
+    /** start and count of the whole variable if count is empty */
+    template <class T>
+    Box<Dims> ArraySelection(const std::string &name, const Dims &start,
+                             const Dims &count) const;
 };
 
 } // end namespace py11
@@ -385,6 +385,19 @@ PYBIND11_MODULE(adios2, m)
                          adios2::py11::File::Read,
              pybind11::return_value_policy::take_ownership)
 
+        .def("read_into", &adios2::py11::File::ReadInto,
+             pybind11::arg("name"), pybind11::arg("array"),
+             pybind11::arg("start") = adios2::Dims(),
+             pybind11::arg("count") = adios2::Dims(),
+             pybind11::arg("endl") = false)
+
+        .def("read_deferred", &adios2::py11::File::ReadDeferred,
+             pybind11::arg("name"), pybind11::arg("array"),
+             pybind11::arg("start") = adios2::Dims(),
+             pybind11::arg("count") = adios2::Dims())
+
+        .def("perform_gets", &adios2::py11::File::PerformGets)
+
         .def("close", &adios2::py11::File::Close)
         .def("currentstep", &adios2::py11::File::CurrentStep);
 }
@@ -0,0 +1,158 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * bpAggregation.cpp: compares BPFile AggregationType strategies (MPIChain,
+ * MPIShmChain, MPITree, MPIGatherv) writing the same global array with
+ * aggregation groups of 2, 4, ... MPI_Size processes per subfile
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <mpi.h>
+
+#include <iomanip>   //std::setw
+#include <ios>       //std::ios_base::failure
+#include <iostream>  //std::cout
+#include <stdexcept> //std::invalid_argument std::exception
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+void printUsage()
+{
+    std::cout << "Usage: benchmark_bpAggregation  [MB]  [steps]\n"
+              << "  MB:     data buffered per process at each step, default "
+                 "16\n"
+              << "  steps:  number of steps, flushed at each EndStep, default "
+                 "5\n\n";
+}
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    size_t megabytes = 16;
+    size_t steps = 5;
+
+    try
+    {
+        if (argc > 1)
+        {
+            megabytes = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            steps = std::stoul(argv[2]);
+        }
+    }
+    catch (std::exception &e)
+    {
+        if (rank == 0)
+        {
+            printUsage();
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    const size_t Nx = megabytes * 1024 * 1024 / sizeof(double);
+    std::vector<double> myDoubles(Nx, static_cast<double>(rank));
+
+    const std::vector<std::string> aggregationTypes = {
+        "MPIChain", "MPIShmChain", "MPITree", "MPIGatherv"};
+
+    if (rank == 0)
+    {
+        std::cout << "BPFile aggregation with " << size << " processes, "
+                  << megabytes << " MB per process, " << steps << " steps\n";
+        std::cout << std::setw(12) << "Type" << std::setw(12) << "GroupSize"
+                  << std::setw(12) << "SubStreams" << std::setw(12)
+                  << "Seconds" << std::setw(12) << "GB/s"
+                  << "\n";
+    }
+
+    try
+    {
+        adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugOFF);
+
+        for (int groupSize = 2; groupSize <= size; groupSize *= 2)
+        {
+            const int subStreams = size / groupSize;
+
+            for (const std::string &aggregationType : aggregationTypes)
+            {
+                const std::string name("bpAggregation_" + aggregationType +
+                                       "_" + std::to_string(groupSize));
+
+                adios2::IO bpIO = adios.DeclareIO(name);
+                bpIO.SetParameters({{"SubStreams", std::to_string(subStreams)},
+                                    {"AggregationType", aggregationType},
+                                    {"CollectiveMetadata", "Off"},
+                                    {"Profile", "Off"}});
+
+                adios2::Variable<double> bpDoubles =
+                    bpIO.DefineVariable<double>("bpDoubles", {size * Nx},
+                                                {rank * Nx}, {Nx},
+                                                adios2::ConstantDims);
+
+                MPI_Barrier(MPI_COMM_WORLD);
+                const double start = MPI_Wtime();
+
+                adios2::Engine bpWriter =
+                    bpIO.Open(name + ".bp", adios2::Mode::Write);
+
+                for (size_t step = 0; step < steps; ++step)
+                {
+                    bpWriter.BeginStep();
+                    bpWriter.Put(bpDoubles, myDoubles.data());
+                    bpWriter.EndStep();
+                }
+                bpWriter.Close();
+
+                const double elapsed = MPI_Wtime() - start;
+                double maxElapsed = 0;
+                MPI_Reduce(&elapsed, &maxElapsed, 1, MPI_DOUBLE, MPI_MAX, 0,
+                           MPI_COMM_WORLD);
+
+                if (rank == 0)
+                {
+                    const double gigabytes = static_cast<double>(size) *
+                                             megabytes * steps / 1024.0;
+                    std::cout << std::setw(12) << aggregationType
+                              << std::setw(12) << groupSize << std::setw(12)
+                              << subStreams << std::setw(12) << std::fixed
+                              << std::setprecision(4) << maxElapsed
+                              << std::setw(12) << gigabytes / maxElapsed
+                              << "\n";
+                }
+            }
+        }
+    }
+    catch (std::invalid_argument &e)
+    {
+        std::cout << "Invalid argument exception, STOPPING PROGRAM from rank "
+                  << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+    catch (std::ios_base::failure &e)
+    {
+        std::cout << "IO System base failure exception, STOPPING PROGRAM "
+                     "from rank "
+                  << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+    catch (std::exception &e)
+    {
+        std::cout << "Exception, STOPPING PROGRAM from rank " << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+
+    MPI_Finalize();
+
+    return 0;
+}
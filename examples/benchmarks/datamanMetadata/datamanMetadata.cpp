@@ -0,0 +1,236 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * datamanMetadata.cpp: compares DataMan JSON (Format dataman) and binary
+ * (Format binary) block metadata streaming many small steps over the WAN
+ * ZMQ transport on localhost, rank 0 writes and rank 1 reads. Subscribers
+ * drop steps beyond the ZMQ high water mark, received steps are reported.
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <mpi.h>
+
+#include <chrono>    //std::chrono::seconds
+#include <iomanip>   //std::setw
+#include <ios>       //std::ios_base::failure
+#include <iostream>  //std::cout
+#include <stdexcept> //std::invalid_argument std::exception
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+void printUsage()
+{
+    std::cout << "Usage: mpirun -n 2 benchmark_datamanMetadata  [steps]  "
+                 "[variables]  [elements]\n"
+              << "  steps:      number of steps, default 10000\n"
+              << "  variables:  number of variables per step, default 10\n"
+              << "  elements:   doubles per variable, default 16\n\n";
+}
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    size_t steps = 10000;
+    size_t variables = 10;
+    size_t elements = 16;
+
+    try
+    {
+        if (size != 2)
+        {
+            throw std::invalid_argument("run with 2 processes");
+        }
+        if (argc > 1)
+        {
+            steps = std::stoul(argv[1]);
+        }
+        if (argc > 2)
+        {
+            variables = std::stoul(argv[2]);
+        }
+        if (argc > 3)
+        {
+            elements = std::stoul(argv[3]);
+        }
+    }
+    catch (std::exception &e)
+    {
+        if (rank == 0)
+        {
+            printUsage();
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    // writer and reader are separate ADIOS2 applications
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, rank, 0, &comm);
+
+    const std::vector<std::string> formats = {"dataman", "binary"};
+    std::vector<double> myDoubles(elements, static_cast<double>(rank));
+
+    if (rank == 0)
+    {
+        std::cout << "DataMan metadata with " << steps << " steps, "
+                  << variables << " variables of " << elements
+                  << " doubles\n";
+        std::cout << std::setw(12) << "Format" << std::setw(12) << "Role"
+                  << std::setw(12) << "Steps" << std::setw(12) << "Seconds"
+                  << std::setw(12) << "Steps/s"
+                  << "\n";
+    }
+
+    try
+    {
+        adios2::ADIOS adios(comm, adios2::DebugOFF);
+
+        for (size_t f = 0; f < formats.size(); ++f)
+        {
+            const std::string &format = formats[f];
+
+            adios2::IO dataManIO = adios.DeclareIO("WAN_" + format);
+            dataManIO.SetEngine("DataMan");
+            dataManIO.SetParameters(
+                {{"WorkflowMode", "subscribe"}, {"Format", format}});
+            dataManIO.AddTransport("WAN",
+                                   {{"Library", "ZMQ"},
+                                    {"IPAddress", "127.0.0.1"},
+                                    {"Port", std::to_string(12306 + f)}});
+
+            MPI_Barrier(MPI_COMM_WORLD);
+            double elapsed = 0;
+            size_t received = steps;
+
+            if (rank == 0)
+            {
+                std::vector<adios2::Variable<double>> bpDoubles;
+                for (size_t v = 0; v < variables; ++v)
+                {
+                    bpDoubles.push_back(dataManIO.DefineVariable<double>(
+                        "bpDoubles" + std::to_string(v), {elements}, {0},
+                        {elements}));
+                }
+
+                adios2::Engine dataManWriter =
+                    dataManIO.Open("datamanMetadata", adios2::Mode::Write);
+                // let the subscriber connect before publishing
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+
+                const double start = MPI_Wtime();
+                for (size_t step = 0; step < steps; ++step)
+                {
+                    dataManWriter.BeginStep();
+                    for (auto &bpDouble : bpDoubles)
+                    {
+                        dataManWriter.Put(bpDouble, myDoubles.data(),
+                                          adios2::Mode::Sync);
+                    }
+                    dataManWriter.EndStep();
+                }
+                elapsed = MPI_Wtime() - start;
+                dataManWriter.Close();
+            }
+            else
+            {
+                adios2::Engine dataManReader =
+                    dataManIO.Open("datamanMetadata", adios2::Mode::Read);
+
+                // stops at the last step, or 5 seconds without steps
+                received = 0;
+                double start = 0;
+                double last = MPI_Wtime();
+                while (true)
+                {
+                    const adios2::StepStatus status =
+                        dataManReader.BeginStep();
+                    if (status == adios2::StepStatus::NotReady)
+                    {
+                        if (MPI_Wtime() - last > 5.0)
+                        {
+                            break;
+                        }
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    if (status != adios2::StepStatus::OK)
+                    {
+                        break;
+                    }
+                    if (received == 0)
+                    {
+                        start = MPI_Wtime();
+                    }
+
+                    for (size_t v = 0; v < variables; ++v)
+                    {
+                        adios2::Variable<double> bpDouble =
+                            dataManIO.InquireVariable<double>(
+                                "bpDoubles" + std::to_string(v));
+                        dataManReader.Get(bpDouble, myDoubles.data(),
+                                          adios2::Mode::Sync);
+                    }
+                    const size_t step = dataManReader.CurrentStep();
+                    dataManReader.EndStep();
+                    ++received;
+                    last = MPI_Wtime();
+                    if (step + 1 >= steps)
+                    {
+                        break;
+                    }
+                }
+                elapsed = last - start;
+                dataManReader.Close();
+            }
+
+            // print in rank order
+            for (int r = 0; r < size; ++r)
+            {
+                MPI_Barrier(MPI_COMM_WORLD);
+                if (r == rank)
+                {
+                    std::cout << std::setw(12) << format << std::setw(12)
+                              << (rank == 0 ? "writer" : "reader")
+                              << std::setw(12) << received
+                              << std::setw(12) << std::fixed
+                              << std::setprecision(4) << elapsed
+                              << std::setw(12) << std::setprecision(0)
+                              << received / elapsed << "\n"
+                              << std::flush;
+                }
+            }
+        }
+    }
+    catch (std::invalid_argument &e)
+    {
+        std::cout << "Invalid argument exception, STOPPING PROGRAM from rank "
+                  << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+    catch (std::ios_base::failure &e)
+    {
+        std::cout << "IO System base failure exception, STOPPING PROGRAM "
+                     "from rank "
+                  << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+    catch (std::exception &e)
+    {
+        std::cout << "Exception, STOPPING PROGRAM from rank " << rank << "\n";
+        std::cout << e.what() << "\n";
+    }
+
+    MPI_Comm_free(&comm);
+    MPI_Finalize();
+
+    return 0;
+}
@@ -56,6 +56,10 @@ ADIOS::ADIOS(const std::string configFile, MPI_Comm mpiComm,
         {
             helper::InitXML(configFile, m_MPIComm, m_HostLanguage, m_DebugMode,
                             m_Operators, m_IOs);
+            for (auto &ioPair : m_IOs)
+            {
+                ioPair.second.m_ThreadPool = &m_ThreadPool;
+            }
         }
         // TODO expand for other formats
     }
@@ -107,6 +111,7 @@ IO &ADIOS::DeclareIO(const std::string name)
         name, IO(name, m_MPIComm, false, m_HostLanguage, m_DebugMode));
     IO &io = ioPair.first->second;
     io.SetDeclared();
+    io.m_ThreadPool = &m_ThreadPool;
     return io;
 }
 
@@ -23,6 +23,7 @@
 #include "adios2/ADIOSTypes.h"
 #include "adios2/core/IO.h"
 #include "adios2/core/Operator.h"
+#include "adios2/helper/adiosThreadPool.h"
 
 namespace adios2
 {
@@ -169,6 +170,10 @@ private:
     /** Changed by language bindings in constructor */
     const std::string m_HostLanguage = "C++";
 
+    /** worker threads used by all IOs and engines, started on demand from
+     * the Threads parameter, must outlive m_IOs */
+    helper::ThreadPool m_ThreadPool;
+
     /**
      * @brief List of IO class objects defined from either ADIOS
      * configuration file (XML) or the DeclareIO function explicitly.
@@ -31,6 +31,11 @@
 namespace adios2
 {
 
+namespace helper
+{
+class ThreadPool;
+}
+
 namespace core
 {
 
@@ -66,6 +71,9 @@ public:
     /** from ADIOS class passed to Engine created with Open */
     const std::string m_HostLanguage = "C++";
 
+    /** from ADIOS class, worker threads shared by all engines */
+    helper::ThreadPool *m_ThreadPool = nullptr;
+
     /** From SetParameter, parameters for a particular engine from m_Type */
     Params m_Parameters;
 
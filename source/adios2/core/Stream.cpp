@@ -96,6 +96,12 @@ void Stream::Open(const std::string &name, const Mode mode,
     Open(name, mode, MPI_COMM_SELF, configFile, ioInConfigFile);
 }
 
+void Stream::PerformGets()
+{
+    ThrowIfNotOpen(m_Name + ", in call to PerformGets");
+    m_Engine->PerformGets();
+}
+
 void Stream::Close()
 {
     ThrowIfNotOpen(m_Name + ", in call to Close");
@@ -148,7 +154,10 @@ void Stream::ThrowIfOpen(const std::string hint) const
         const std::string &, const Box<Dims> &, const Box<size_t> &);          \
                                                                                \
     template std::vector<T> Stream::Read<T>(const std::string &,               \
-                                            const Box<Dims> &, const bool);
+                                            const Box<Dims> &, const bool);    \
+                                                                               \
+    template void Stream::ReadDeferred<T>(const std::string &, T *,            \
+                                          const Box<Dims> &);
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
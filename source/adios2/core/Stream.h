@@ -115,6 +115,20 @@ public:
     std::vector<T> Read(const std::string &name, const Box<Dims> &selection,
                         const Box<size_t> &stepSelection);
 
+    /**
+     * Reads values of a variable at PerformGets (or Close) instead of right
+     * away, only one deferred read per variable until then
+     * @param name variable name
+     * @param values must stay valid until PerformGets
+     * @param selection empty: current selection of the variable
+     */
+    template <class T>
+    void ReadDeferred(const std::string &name, T *values,
+                      const Box<Dims> &selection = Box<Dims>());
+
+    /** executes all ReadDeferred reads */
+    void PerformGets();
+
     void Close();
 
 private:
@@ -168,7 +182,10 @@ private:
         const std::string &, const Box<Dims> &, const Box<size_t> &);          \
                                                                                \
     extern template std::vector<T> Stream::Read<T>(                            \
-        const std::string &, const Box<Dims> &, const bool);
+        const std::string &, const Box<Dims> &, const bool);                   \
+                                                                               \
+    extern template void Stream::ReadDeferred<T>(const std::string &, T *,     \
+                                                 const Box<Dims> &);
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
@@ -181,6 +181,37 @@ std::vector<T> Stream::Read(const std::string &name, const Box<Dims> &selection,
     return GetCommon(*variable, false);
 }
 
+template <class T>
+void Stream::ReadDeferred(const std::string &name, T *values,
+                          const Box<Dims> &selection)
+{
+    CheckPCommon(name, values);
+
+    Variable<T> *variable = m_IO->InquireVariable<T>(name);
+    if (variable == nullptr)
+    {
+        // nothing would tell the caller values are left unread
+        throw std::invalid_argument("ERROR: variable " + name +
+                                    " not found, in call to ReadDeferred\n");
+    }
+
+    if (!selection.second.empty())
+    {
+        variable->SetSelection(selection);
+    }
+
+    try
+    {
+        m_Engine->Get(*variable, values, adios2::Mode::Deferred);
+    }
+    catch (...)
+    {
+        std::throw_with_nested(std::runtime_error(
+            "ERROR: couldn't Read deferred variable " + variable->m_Name +
+            "\n"));
+    }
+}
+
 // PRIVATE
 template <class T>
 std::vector<T> Stream::GetCommon(Variable<T> &variable, const bool endStep)
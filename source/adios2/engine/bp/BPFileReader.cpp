@@ -11,6 +11,10 @@
 #include "BPFileReader.h"
 #include "BPFileReader.tcc"
 
+#include <algorithm> // std::sort, std::max
+#include <chrono>    // std::chrono::steady_clock
+#include <thread>    // std::this_thread::sleep_for
+
 #include "adios2/helper/adiosFunctions.h" // MPI BroadcastVector
 
 namespace adios2
@@ -20,6 +24,10 @@ namespace core
 namespace engine
 {
 
+constexpr int BPFileReader::m_PollMilliseconds;
+constexpr size_t BPFileReader::m_ReadMergeGap;
+constexpr size_t BPFileReader::m_ReadExtentMaxSize;
+
 BPFileReader::BPFileReader(IO &io, const std::string &name, const Mode mode,
                            MPI_Comm mpiComm)
 : Engine("BPFileReader", io, name, mode, mpiComm),
@@ -50,15 +58,24 @@ StepStatus BPFileReader::BeginStep(StepMode mode, const float timeoutSeconds)
         }
     }
 
-    if (m_FirstStep)
-    {
-        m_FirstStep = false;
-    }
-    else
+    const size_t nextStep = m_FirstStep ? 0 : m_CurrentStep + 1;
+
+    if (nextStep >= m_BP3Deserializer.m_MetadataSet.StepsCount &&
+        !m_MetadataComplete)
     {
-        ++m_CurrentStep;
+        ReadMetadataRecords(timeoutSeconds);
+
+        // stay at the current step until the writer appends the next one
+        if (nextStep >= m_BP3Deserializer.m_MetadataSet.StepsCount &&
+            !m_MetadataComplete)
+        {
+            return StepStatus::NotReady;
+        }
     }
 
+    m_FirstStep = false;
+    m_CurrentStep = nextStep;
+
     if (m_CurrentStep >= m_BP3Deserializer.m_MetadataSet.StepsCount)
     {
         return StepStatus::EndOfStream;
@@ -121,10 +138,17 @@ void BPFileReader::Init()
         }
     }
 
+    InitParameters();
     InitTransports();
     InitBuffer();
 }
 
+void BPFileReader::InitParameters()
+{
+    m_BP3Deserializer.InitParameters(m_IO.m_Parameters);
+    m_BP3Deserializer.m_ThreadPool = m_IO.m_ThreadPool;
+}
+
 void BPFileReader::InitTransports()
 {
     if (m_IO.m_TransportsParameters.empty())
@@ -163,7 +187,73 @@ void BPFileReader::InitBuffer()
     helper::BroadcastVector(m_BP3Deserializer.m_Metadata.m_Buffer, m_MPIComm);
 
     // fills IO with Variables and Attributes
-    m_BP3Deserializer.ParseMetadata(m_BP3Deserializer.m_Metadata, m_IO);
+    m_MetadataComplete = m_BP3Deserializer.ParseMetadataRecords(
+        m_BP3Deserializer.m_Metadata, m_IO);
+}
+
+void BPFileReader::ReadMetadataRecords(const float timeoutSeconds)
+{
+    BufferSTL &metadata = m_BP3Deserializer.m_Metadata;
+    const size_t stepsCount = m_BP3Deserializer.m_MetadataSet.StepsCount;
+    const auto start = std::chrono::steady_clock::now();
+
+    auto lf_TimedOut = [&]() -> bool {
+        const std::chrono::duration<float> elapsed =
+            std::chrono::steady_clock::now() - start;
+        return timeoutSeconds >= 0.f && elapsed.count() >= timeoutSeconds;
+    };
+
+    while (true)
+    {
+        const size_t size = metadata.m_Buffer.size();
+        size_t fileSize = size;
+        if (m_BP3Deserializer.m_RankMPI == 0)
+        {
+            fileSize = m_FileManager.GetFileSize(0);
+            while (fileSize <= size && !lf_TimedOut())
+            {
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(m_PollMilliseconds));
+                fileSize = m_FileManager.GetFileSize(0);
+            }
+        }
+        // rank 0 decides for all ranks
+        fileSize = helper::BroadcastValue(fileSize, m_MPIComm);
+        if (fileSize <= size)
+        {
+            return;
+        }
+
+        // positions in parsed records stay valid, grow geometrically
+        if (metadata.m_Buffer.capacity() < fileSize)
+        {
+            metadata.m_Buffer.reserve(
+                std::max(fileSize, 2 * metadata.m_Buffer.capacity()));
+        }
+        metadata.Resize(fileSize, "appending metadata records, in call to "
+                                  "BPFileReader BeginStep");
+
+        if (m_BP3Deserializer.m_RankMPI == 0)
+        {
+            m_FileManager.ReadFile(metadata.m_Buffer.data() + size,
+                                   fileSize - size, size);
+        }
+        helper::CheckMPIReturn(
+            MPI_Bcast(metadata.m_Buffer.data() + size,
+                      static_cast<int>(fileSize - size), MPI_CHAR, 0,
+                      m_MPIComm),
+            "broadcasting metadata records, in call to BPFileReader "
+            "BeginStep\n");
+
+        m_MetadataComplete =
+            m_BP3Deserializer.ParseMetadataRecords(metadata, m_IO);
+
+        if (m_MetadataComplete ||
+            m_BP3Deserializer.m_MetadataSet.StepsCount > stepsCount)
+        {
+            return;
+        }
+    }
 }
 
 #define declare_type(T)                                                        \
@@ -181,51 +271,208 @@ ADIOS2_FOREACH_TYPE_1ARG(declare_type)
 void BPFileReader::ReadVariables(
     const std::map<std::string, helper::SubFileInfoMap> &variablesSubFileInfo)
 {
-    const bool profile = m_BP3Deserializer.m_Profiler.IsActive;
+    const std::map<size_t, std::vector<ExtentRead>> subFilesExtents =
+        PlanReads(variablesSubFileInfo);
 
-    // sequentially request bytes from transport manager
-    // threaded per variable?
-    for (const auto &variableNamePair : variablesSubFileInfo) // variable name
+    // open subfiles serially, transports map is not thread-safe
+    const bool profile = m_BP3Deserializer.m_Profiler.IsActive;
+    for (const auto &subFileExtentsPair : subFilesExtents)
     {
-        const std::string variableName(variableNamePair.first);
+        const size_t subFileIndex = subFileExtentsPair.first;
 
-        // or threaded per file?
-        for (const auto &subFileIndexPair : variableNamePair.second)
+        if (m_SubFileManager.m_Transports.count(subFileIndex) == 0)
         {
-            const size_t subFileIndex = subFileIndexPair.first;
+            const std::string subFile(
+                m_BP3Deserializer.GetBPSubFileName(m_Name, subFileIndex));
 
-            if (m_SubFileManager.m_Transports.count(subFileIndex) == 0)
-            {
-                const std::string subFile(
-                    m_BP3Deserializer.GetBPSubFileName(m_Name, subFileIndex));
+            // subfiles use the same transport library as metadata
+            m_SubFileManager.OpenFileID(subFile, subFileIndex, Mode::Read,
+                                        m_IO.m_TransportsParameters.front(),
+                                        profile);
+        }
+    }
+
+    const size_t threads = std::min(
+        static_cast<size_t>(m_BP3Deserializer.m_Threads),
+        subFilesExtents.size());
+
+    if (threads <= 1)
+    {
+        for (const auto &subFileExtentsPair : subFilesExtents)
+        {
+            ReadExtents(subFileExtentsPair.first, subFileExtentsPair.second);
+        }
+        return;
+    }
 
-                m_SubFileManager.OpenFileID(subFile, subFileIndex, Mode::Read,
-                                            {{"transport", "File"}}, profile);
+    // one queue per subfile, subfiles are distributed round-robin to threads
+    // as each subfile transport can only serve one read at a time
+    auto lf_ReadSubFiles = [&](const size_t thread) {
+        size_t s = 0;
+        for (const auto &subFileExtentsPair : subFilesExtents)
+        {
+            if (s % threads == thread)
+            {
+                ReadExtents(subFileExtentsPair.first,
+                            subFileExtentsPair.second);
             }
+            ++s;
+        }
+    };
+
+    // rethrows exceptions from reading threads
+    helper::RunTasks(m_IO.m_ThreadPool, threads, lf_ReadSubFiles,
+                     static_cast<unsigned int>(threads));
+}
+
+std::map<size_t, std::vector<BPFileReader::ExtentRead>> BPFileReader::PlanReads(
+    const std::map<std::string, helper::SubFileInfoMap> &variablesSubFileInfo)
+    const
+{
+    // gather all block reads per subfile
+    std::map<size_t, std::vector<BlockRead>> subFilesBlocks;
+
+    for (const auto &variableNamePair : variablesSubFileInfo) // variable name
+    {
+        for (const auto &subFileIndexPair : variableNamePair.second)
+        {
+            std::vector<BlockRead> &blocks =
+                subFilesBlocks[subFileIndexPair.first];
 
             for (const auto &stepPair : subFileIndexPair.second) // step
             {
                 for (const auto &blockInfo : stepPair.second)
                 {
-                    const auto &seek = blockInfo.Seeks;
-                    const size_t blockStart = seek.first;
-                    const size_t blockSize = seek.second - seek.first;
-                    std::vector<char> contiguousMemory(blockSize);
-                    m_SubFileManager.ReadFile(contiguousMemory.data(),
-                                              blockSize, blockStart,
-                                              subFileIndex);
-
-                    m_BP3Deserializer.ClipContiguousMemory(
-                        variableName, m_IO, contiguousMemory,
-                        blockInfo.BlockBox, blockInfo.IntersectionBox);
-                } // end block
-
-                // Advancing data pointer for the next step
-                // m_BP3Deserializer.SetVariableNextStepData(variableName,
-                // m_IO);
-            } // end step
-        }     // end subfile
-    }         // end variable
+                    blocks.push_back(
+                        {&variableNamePair.first, &blockInfo,
+                         GetInPlaceData(variableNamePair.first, blockInfo)});
+                }
+            }
+        }
+    }
+
+    std::map<size_t, std::vector<ExtentRead>> subFilesExtents;
+
+    for (auto &subFileBlocksPair : subFilesBlocks)
+    {
+        std::vector<BlockRead> &blocks = subFileBlocksPair.second;
+        std::sort(blocks.begin(), blocks.end(),
+                  [](const BlockRead &a, const BlockRead &b) {
+                      return a.Info->Seeks.first < b.Info->Seeks.first;
+                  });
+
+        std::vector<ExtentRead> &extents =
+            subFilesExtents[subFileBlocksPair.first];
+
+        for (const BlockRead &block : blocks)
+        {
+            const Box<size_t> &seeks = block.Info->Seeks;
+
+            // blocks read in place are not merged
+            if (!extents.empty() && block.Data == nullptr &&
+                extents.back().Blocks.front().Data == nullptr)
+            {
+                ExtentRead &extent = extents.back();
+                const size_t mergedEnd =
+                    std::max(extent.Seeks.second, seeks.second);
+
+                if (seeks.first <= extent.Seeks.second + m_ReadMergeGap &&
+                    mergedEnd - extent.Seeks.first <= m_ReadExtentMaxSize)
+                {
+                    extent.Seeks.second = mergedEnd;
+                    extent.Blocks.push_back(block);
+                    continue;
+                }
+            }
+
+            extents.push_back({seeks, {block}});
+        }
+    }
+
+    return subFilesExtents;
+}
+
+void BPFileReader::ReadExtents(const size_t subFileIndex,
+                               const std::vector<ExtentRead> &extents)
+{
+    std::vector<char> extentMemory;
+
+    for (const ExtentRead &extent : extents)
+    {
+        const size_t extentStart = extent.Seeks.first;
+        const size_t extentSize = extent.Seeks.second - extent.Seeks.first;
+
+        char *inPlaceData = extent.Blocks.front().Data;
+        if (inPlaceData != nullptr)
+        {
+            m_SubFileManager.ReadFile(inPlaceData, extentSize, extentStart,
+                                      subFileIndex);
+            continue;
+        }
+
+        // zero-copy from mapped subfiles, otherwise read extent in memory
+        const char *extentData = m_SubFileManager.GetMappedFile(
+            extentSize, extentStart, subFileIndex);
+        if (extentData == nullptr)
+        {
+            extentMemory.resize(extentSize);
+            m_SubFileManager.ReadFile(extentMemory.data(), extentSize,
+                                      extentStart, subFileIndex);
+            extentData = extentMemory.data();
+        }
+
+        for (const BlockRead &block : extent.Blocks)
+        {
+            const helper::SubFileInfo &blockInfo = *block.Info;
+            const char *blockData =
+                extentData + blockInfo.Seeks.first - extentStart;
+            const size_t blockSize =
+                blockInfo.Seeks.second - blockInfo.Seeks.first;
+
+            if (!blockInfo.OperationsInfo.empty())
+            {
+                std::vector<char> postOperationMemory;
+                m_BP3Deserializer.PostDataOperations(
+                    blockInfo, blockData, blockSize, postOperationMemory);
+                m_BP3Deserializer.ClipContiguousMemory(
+                    *block.VariableName, m_IO, postOperationMemory,
+                    blockInfo.BlockBox, blockInfo.IntersectionBox);
+                continue;
+            }
+
+            m_BP3Deserializer.ClipContiguousMemory(
+                *block.VariableName, m_IO, blockData, blockSize,
+                blockInfo.BlockBox, blockInfo.IntersectionBox);
+        } // end block
+    }     // end extent
+}
+
+char *BPFileReader::GetInPlaceData(const std::string &variableName,
+                                   const helper::SubFileInfo &blockInfo) const
+{
+    if (!blockInfo.OperationsInfo.empty())
+    {
+        return nullptr;
+    }
+
+    const std::string type(m_IO.InquireVariableType(variableName));
+
+    if (type == "compound")
+    {
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetType<T>())                                     \
+    {                                                                          \
+        const Variable<T> *variable = m_IO.InquireVariable<T>(variableName);   \
+        if (variable != nullptr)                                               \
+        {                                                                      \
+            return GetInPlaceDataCommon(*variable, blockInfo);                 \
+        }                                                                      \
+    }
+    ADIOS2_FOREACH_TYPE_1ARG(declare_type)
+#undef declare_type
+
+    return nullptr;
 }
 
 void BPFileReader::DoClose(const int transportIndex)
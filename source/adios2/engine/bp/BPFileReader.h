@@ -57,10 +57,48 @@ private:
     size_t m_CurrentStep = 0;
     bool m_FirstStep = true;
 
+    /** false while an IncrementalMetadata writer can append steps */
+    bool m_MetadataComplete = true;
+
+    /** time between metadata file size checks in BeginStep */
+    static constexpr int m_PollMilliseconds = 10;
+
+    /** merge block reads separated by at most this many bytes in a subfile */
+    static constexpr size_t m_ReadMergeGap = 4096;
+    /** stop merging block reads once an extent reaches this size */
+    static constexpr size_t m_ReadExtentMaxSize = 16 * 1024 * 1024;
+
+    /** a single block payload read request, from a SubFileInfoMap */
+    struct BlockRead
+    {
+        const std::string *VariableName;
+        const helper::SubFileInfo *Info;
+        /** user memory to read the block into, nullptr: read into a
+         * temporary extent and clip */
+        char *Data;
+    };
+
+    /** contiguous range read at once from a subfile, covering block reads
+     * sorted by seek */
+    struct ExtentRead
+    {
+        Box<size_t> Seeks;
+        std::vector<BlockRead> Blocks;
+    };
+
     void Init();
+    void InitParameters();
     void InitTransports();
     void InitBuffer();
 
+    /**
+     * IncrementalMetadata: rank 0 polls the metadata file until it grows or
+     * timeoutSeconds pass, new bytes are broadcast and their complete
+     * records parsed. Repeats while records are incomplete.
+     * @param timeoutSeconds < 0: no limit, 0: single check
+     */
+    void ReadMetadataRecords(const float timeoutSeconds);
+
 #define declare_type(T)                                                        \
     void DoGetSync(Variable<T> &, T *) final;                                  \
     void DoGetDeferred(Variable<T> &, T *) final;
@@ -77,6 +115,41 @@ private:
 
     void ReadVariables(
         const std::map<std::string, helper::SubFileInfoMap> &variablesInfo);
+
+    /**
+     * Read planner: groups all block requests by subfile, sorts them by
+     * seek and merges adjacent (or near-adjacent) ranges into extents
+     * @param variablesInfo read schedule per variable
+     * @return key: subfile index, value: extents sorted by seek
+     */
+    std::map<size_t, std::vector<ExtentRead>> PlanReads(
+        const std::map<std::string, helper::SubFileInfoMap> &variablesInfo)
+        const;
+
+    /**
+     * Reads extents from a single subfile and clips each block into the
+     * variables' memory
+     * @param subFileIndex subfile transport index in m_SubFileManager
+     * @param extents from PlanReads
+     */
+    void ReadExtents(const size_t subFileIndex,
+                     const std::vector<ExtentRead> &extents);
+
+    /**
+     * Zero-copy fast path: finds the location in variable memory a block
+     * can be read into directly
+     * @param variableName input
+     * @param blockInfo block read schedule
+     * @return pointer in variable memory if the intersection is contiguous in
+     * both block and selection and the block is not operated, nullptr
+     * otherwise
+     */
+    char *GetInPlaceData(const std::string &variableName,
+                         const helper::SubFileInfo &blockInfo) const;
+
+    template <class T>
+    char *GetInPlaceDataCommon(const Variable<T> &variable,
+                               const helper::SubFileInfo &blockInfo) const;
 };
 
 } // end namespace engine
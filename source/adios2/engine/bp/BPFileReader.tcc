@@ -53,6 +53,28 @@ void BPFileReader::GetDeferredCommon(Variable<T> &variable, T *data)
     m_BP3Deserializer.m_PerformedGets = false;
 }
 
+template <class T>
+char *BPFileReader::GetInPlaceDataCommon(
+    const Variable<T> &variable, const helper::SubFileInfo &blockInfo) const
+{
+    size_t elementOffset, dummy;
+
+    // contiguous piece in the block and in the user data?
+    if (helper::IsIntersectionContiguousSubarray(
+            blockInfo.BlockBox, blockInfo.IntersectionBox,
+            m_BP3Deserializer.m_IsRowMajor, dummy) &&
+        helper::IsIntersectionContiguousSubarray(
+            helper::StartEndBox(variable.m_Start, variable.m_Count,
+                                m_BP3Deserializer.m_ReverseDimensions),
+            blockInfo.IntersectionBox, m_BP3Deserializer.m_IsRowMajor,
+            elementOffset))
+    {
+        return reinterpret_cast<char *>(variable.GetData() + elementOffset);
+    }
+
+    return nullptr;
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
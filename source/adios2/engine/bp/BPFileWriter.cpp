@@ -35,7 +35,14 @@ BPFileWriter::BPFileWriter(IO &io, const std::string &name, const Mode mode,
     Init();
 }
 
-BPFileWriter::~BPFileWriter() = default;
+BPFileWriter::~BPFileWriter()
+{
+    // background thread must not outlive the buffers and transports
+    if (m_AsyncWriteFuture.valid())
+    {
+        m_AsyncWriteFuture.wait();
+    }
+}
 
 StepStatus BPFileWriter::BeginStep(StepMode mode, const float timeoutSeconds)
 {
@@ -72,10 +79,12 @@ void BPFileWriter::PerformPuts()
         Variable<T> &variable = FindVariable<T>(                               \
             variableName, "in call to PerformPuts, EndStep or Close");         \
         const auto &blocksInfo = variable.m_StepBlocksInfo.at(CurrentStep());  \
+        const bool byReference =                                               \
+            m_BP3Serializer.IsDeferredByReference(variable);                   \
         for (const auto &blockInfoPair : blocksInfo)                           \
         {                                                                      \
             const auto &blockInfo = blockInfoPair.second;                      \
-            PutSyncCommon(variable, blockInfo);                                \
+            PutSyncCommon(variable, blockInfo, byReference);                   \
         }                                                                      \
         variable.m_StepBlocksInfo.erase(CurrentStep());                        \
     }
@@ -99,7 +108,9 @@ void BPFileWriter::EndStep()
     const size_t currentStep = CurrentStep();
     const size_t flushStepsCount = m_BP3Serializer.m_FlushStepsCount;
 
-    if (currentStep % flushStepsCount == 0)
+    // referenced application memory is only valid until EndStep
+    if (currentStep % flushStepsCount == 0 ||
+        !m_BP3Serializer.m_Data.m_References.empty())
     {
         Flush();
     }
@@ -112,7 +123,14 @@ void BPFileWriter::Flush(const int transportIndex)
 
     if (m_BP3Serializer.m_CollectiveMetadata)
     {
-        WriteCollectiveMetadataFile();
+        if (m_BP3Serializer.m_IncrementalMetadata)
+        {
+            WriteMetadataRecord();
+        }
+        else
+        {
+            WriteCollectiveMetadataFile();
+        }
     }
 }
 
@@ -142,6 +160,11 @@ ADIOS2_FOREACH_TYPE_1ARG(declare_type)
 void BPFileWriter::InitParameters()
 {
     m_BP3Serializer.InitParameters(m_IO.m_Parameters);
+    m_BP3Serializer.m_ThreadPool = m_IO.m_ThreadPool;
+    m_BP3Serializer.m_ApplyOperators = true;
+    m_BP3Serializer.m_FuseMinMax = true;
+    // aggregators exchange a contiguous data buffer
+    m_BP3Serializer.m_ChunkedData = !m_BP3Serializer.m_Aggregator->m_IsActive;
 }
 
 void BPFileWriter::InitTransports()
@@ -155,7 +178,7 @@ void BPFileWriter::InitTransports()
     }
 
     // only consumers will interact with transport managers
-    if (m_BP3Serializer.m_Aggregator.m_IsConsumer)
+    if (m_BP3Serializer.m_Aggregator->m_IsConsumer)
     {
         // Names passed to IO AddTransport option with key "Name"
         const std::vector<std::string> transportsNames =
@@ -170,6 +193,22 @@ void BPFileWriter::InitTransports()
                                     m_IO.m_TransportsParameters,
                                     m_BP3Serializer.m_Profiler.IsActive);
     }
+
+    // readers can open the file before the first record is appended
+    if (m_BP3Serializer.m_IncrementalMetadata &&
+        m_BP3Serializer.m_CollectiveMetadata && m_BP3Serializer.m_RankMPI == 0)
+    {
+        const std::vector<std::string> transportsNames =
+            m_FileMetadataManager.GetFilesBaseNames(
+                m_Name, m_IO.m_TransportsParameters);
+
+        const std::vector<std::string> bpMetadataFileNames =
+            m_BP3Serializer.GetBPMetadataFileNames(transportsNames);
+
+        m_FileMetadataManager.OpenFiles(bpMetadataFileNames, m_OpenMode,
+                                        m_IO.m_TransportsParameters,
+                                        m_BP3Serializer.m_Profiler.IsActive);
+    }
 }
 
 void BPFileWriter::InitBPBuffer()
@@ -190,7 +229,7 @@ void BPFileWriter::InitBPBuffer()
 
 void BPFileWriter::DoFlush(const bool isFinal, const int transportIndex)
 {
-    if (m_BP3Serializer.m_Aggregator.m_IsActive)
+    if (m_BP3Serializer.m_Aggregator->m_IsActive)
     {
         AggregateWriteData(isFinal, transportIndex);
     }
@@ -208,8 +247,9 @@ void BPFileWriter::DoClose(const int transportIndex)
     }
 
     DoFlush(true, transportIndex);
+    WaitAsyncWrite();
 
-    if (m_BP3Serializer.m_Aggregator.m_IsConsumer)
+    if (m_BP3Serializer.m_Aggregator->m_IsConsumer)
     {
         m_FileDataManager.CloseFiles(transportIndex);
     }
@@ -217,7 +257,14 @@ void BPFileWriter::DoClose(const int transportIndex)
     if (m_BP3Serializer.m_CollectiveMetadata &&
         m_FileDataManager.AllTransportsClosed())
     {
-        WriteCollectiveMetadataFile(true);
+        if (m_BP3Serializer.m_IncrementalMetadata)
+        {
+            WriteMetadataRecord(true);
+        }
+        else
+        {
+            WriteCollectiveMetadataFile(true);
+        }
     }
 
     if (m_BP3Serializer.m_Profiler.IsActive &&
@@ -262,36 +309,112 @@ void BPFileWriter::WriteProfilingJSONFile()
 
 void BPFileWriter::WriteCollectiveMetadataFile(const bool isFinal)
 {
-    m_BP3Serializer.AggregateCollectiveMetadata(
-        m_MPIComm, m_BP3Serializer.m_Metadata, true);
+    BufferSTL &metadata = m_BP3Serializer.m_Metadata;
+    m_BP3Serializer.AggregateCollectiveMetadata(m_MPIComm, metadata, true);
 
     if (m_BP3Serializer.m_RankMPI == 0)
     {
-        // first init metadata files
-        const std::vector<std::string> transportsNames =
-            m_FileMetadataManager.GetFilesBaseNames(
-                m_Name, m_IO.m_TransportsParameters);
+        auto lf_WriteMetadataFile = [&](const char *buffer,
+                                        const size_t size) {
+            // first init metadata files
+            const std::vector<std::string> transportsNames =
+                m_FileMetadataManager.GetFilesBaseNames(
+                    m_Name, m_IO.m_TransportsParameters);
+
+            const std::vector<std::string> bpMetadataFileNames =
+                m_BP3Serializer.GetBPMetadataFileNames(transportsNames);
+
+            m_FileMetadataManager.OpenFiles(
+                bpMetadataFileNames, m_OpenMode, m_IO.m_TransportsParameters,
+                m_BP3Serializer.m_Profiler.IsActive);
+
+            m_FileMetadataManager.WriteFiles(buffer, size);
+            m_FileMetadataManager.CloseFiles();
+
+            // profiling at Close reads the final transports
+            if (!isFinal)
+            {
+                m_FileMetadataManager.m_Transports.clear();
+            }
+        };
+
+        // the whole index is rewritten, the pending one is outdated at Close
+        if (isFinal || !IsMetadataDeferred())
+        {
+            m_PendingMetadata.clear();
+            lf_WriteMetadataFile(metadata.m_Buffer.data(),
+                                 metadata.m_Position);
+        }
+        else
+        {
+            // all ranks waited for the data indexed by the pending metadata
+            // before this aggregation
+            if (!m_PendingMetadata.empty())
+            {
+                lf_WriteMetadataFile(m_PendingMetadata.data(),
+                                     m_PendingMetadata.size());
+            }
+            m_PendingMetadata.assign(metadata.m_Buffer.begin(),
+                                     metadata.m_Buffer.begin() +
+                                         metadata.m_Position);
+        }
 
-        const std::vector<std::string> bpMetadataFileNames =
-            m_BP3Serializer.GetBPMetadataFileNames(transportsNames);
+        if (!isFinal)
+        {
+            m_BP3Serializer.ResetBuffer(metadata, true);
+        }
+    }
+}
 
-        m_FileMetadataManager.OpenFiles(bpMetadataFileNames, m_OpenMode,
-                                        m_IO.m_TransportsParameters,
-                                        m_BP3Serializer.m_Profiler.IsActive);
+void BPFileWriter::WriteMetadataRecord(const bool isFinal)
+{
+    BufferSTL &metadata = m_BP3Serializer.m_Metadata;
+    m_BP3Serializer.AggregateMetadataRecord(m_MPIComm, metadata, isFinal);
 
-        m_FileMetadataManager.WriteFiles(
-            m_BP3Serializer.m_Metadata.m_Buffer.data(),
-            m_BP3Serializer.m_Metadata.m_Position);
-        m_FileMetadataManager.CloseFiles();
+    if (m_BP3Serializer.m_RankMPI == 0)
+    {
+        // records are appended in order, all ranks waited for the data
+        // indexed by the pending record before this aggregation
+        if (!m_PendingMetadata.empty())
+        {
+            m_FileMetadataManager.WriteFiles(m_PendingMetadata.data(),
+                                             m_PendingMetadata.size());
+            m_PendingMetadata.clear();
+        }
 
-        if (!isFinal)
+        if (isFinal || !IsMetadataDeferred())
+        {
+            // opened in InitTransports
+            m_FileMetadataManager.WriteFiles(metadata.m_Buffer.data(),
+                                             metadata.m_Position);
+        }
+        else
+        {
+            m_PendingMetadata.assign(metadata.m_Buffer.begin(),
+                                     metadata.m_Buffer.begin() +
+                                         metadata.m_Position);
+        }
+        m_FileMetadataManager.FlushFiles();
+
+        if (isFinal)
+        {
+            m_FileMetadataManager.CloseFiles();
+        }
+        else
         {
-            m_BP3Serializer.ResetBuffer(m_BP3Serializer.m_Metadata, true);
-            m_FileMetadataManager.m_Transports.clear();
+            // keeps the absolute position of the next record
+            m_BP3Serializer.ResetBuffer(metadata);
         }
     }
 }
 
+bool BPFileWriter::IsMetadataDeferred() const noexcept
+{
+    // same on all ranks, as metadata is aggregated collectively
+    return m_BP3Serializer.m_AsyncWrite &&
+           !m_BP3Serializer.m_Aggregator->m_IsActive;
+}
+
 void BPFileWriter::WriteData(const bool isFinal, const int transportIndex)
 {
     size_t dataSize = m_BP3Serializer.m_Data.m_Position;
@@ -303,13 +426,79 @@ void BPFileWriter::WriteData(const bool isFinal, const int transportIndex)
     }
     else
     {
-        m_BP3Serializer.CloseStream(m_IO);
+        // a flush inside a step closes the process group here, metadata
+        // serialized after it is not written
+        size_t metadataStart = 0;
+        size_t metadataCount = 0;
+        m_BP3Serializer.CloseStream(m_IO, metadataStart, metadataCount);
+        dataSize = metadataStart;
+    }
+
+    // previous buffer must be drained before it can be reused
+    WaitAsyncWrite();
+
+    // referenced application memory can't be written in the background
+    if (!m_BP3Serializer.m_AsyncWrite || isFinal ||
+        !m_BP3Serializer.m_Data.m_References.empty())
+    {
+        WriteDataBuffer(m_BP3Serializer.m_Data, dataSize, transportIndex);
+        m_FileDataManager.FlushFiles(transportIndex);
+        return;
+    }
+
+    // swap buffers, serializer continues in the drained buffer and chunks
+    BufferSTL &data = m_BP3Serializer.m_Data;
+    if (m_AsyncBuffer.m_Buffer.size() < data.m_Buffer.size())
+    {
+        m_AsyncBuffer.m_Buffer.resize(data.m_Buffer.size());
     }
+    m_AsyncBuffer.SwapChunks(data);
+    m_AsyncBuffer.m_Position = dataSize;
 
-    m_FileDataManager.WriteFiles(m_BP3Serializer.m_Data.m_Buffer.data(),
-                                 dataSize, transportIndex);
+    m_AsyncWriteFuture =
+        helper::SubmitTask(m_IO.m_ThreadPool, [this, transportIndex] {
+            WriteDataBuffer(m_AsyncBuffer, m_AsyncBuffer.m_Position,
+                            transportIndex);
+            m_FileDataManager.FlushFiles(transportIndex);
+        });
+}
+
+void BPFileWriter::WriteDataBuffer(const BufferSTL &bufferSTL,
+                                   const size_t size, const int transportIndex)
+{
+    if (bufferSTL.m_Chunks.empty() && bufferSTL.m_References.empty())
+    {
+        m_FileDataManager.WriteFiles(bufferSTL.m_Buffer.data(), size,
+                                     transportIndex);
+        return;
+    }
+
+    // full chunks, then the current one up to size, split at references
+    m_FileDataManager.WriteFiles(bufferSTL.GetSegments(size), transportIndex);
+}
+
+void BPFileWriter::WaitAsyncWrite()
+{
+    if (!m_AsyncWriteFuture.valid())
+    {
+        return;
+    }
+
+    profiling::IOChrono &profiler = m_BP3Serializer.m_Profiler;
+    if (profiler.IsActive)
+    {
+        profiler.Timers.at("async_wait").Resume();
+    }
+
+    m_AsyncWriteFuture.wait();
+
+    if (profiler.IsActive)
+    {
+        profiler.Timers.at("async_wait").Pause();
+    }
 
-    m_FileDataManager.FlushFiles(transportIndex);
+    // rethrows exceptions from the background write
+    m_AsyncWriteFuture.get();
 }
 
 void BPFileWriter::AggregateWriteData(const bool isFinal,
@@ -318,19 +507,20 @@ void BPFileWriter::AggregateWriteData(const bool isFinal,
     m_BP3Serializer.CloseStream(m_IO, false);
 
     // async?
-    for (int r = 0; r < m_BP3Serializer.m_Aggregator.m_Size; ++r)
+    const int steps = m_BP3Serializer.m_Aggregator->GetExchangeSteps();
+    for (int r = 0; r < steps; ++r)
     {
         std::vector<MPI_Request> dataRequests =
-            m_BP3Serializer.m_Aggregator.IExchange(m_BP3Serializer.m_Data, r);
+            m_BP3Serializer.m_Aggregator->IExchange(m_BP3Serializer.m_Data, r);
 
         std::vector<MPI_Request> absolutePositionRequests =
-            m_BP3Serializer.m_Aggregator.IExchangeAbsolutePosition(
+            m_BP3Serializer.m_Aggregator->IExchangeAbsolutePosition(
                 m_BP3Serializer.m_Data, r);
 
-        if (m_BP3Serializer.m_Aggregator.m_IsConsumer)
+        if (m_BP3Serializer.m_Aggregator->m_IsConsumer)
         {
             const BufferSTL &bufferSTL =
-                m_BP3Serializer.m_Aggregator.GetConsumerBuffer(
+                m_BP3Serializer.m_Aggregator->GetConsumerBuffer(
                     m_BP3Serializer.m_Data);
 
             m_FileDataManager.WriteFiles(bufferSTL.m_Buffer.data(),
@@ -339,11 +529,11 @@ void BPFileWriter::AggregateWriteData(const bool isFinal,
             m_FileDataManager.FlushFiles(transportIndex);
         }
 
-        m_BP3Serializer.m_Aggregator.WaitAbsolutePosition(
+        m_BP3Serializer.m_Aggregator->WaitAbsolutePosition(
             absolutePositionRequests, r);
 
-        m_BP3Serializer.m_Aggregator.Wait(dataRequests, r);
-        m_BP3Serializer.m_Aggregator.SwapBuffers(r);
+        m_BP3Serializer.m_Aggregator->Wait(dataRequests, r);
+        m_BP3Serializer.m_Aggregator->SwapBuffers(r);
     }
 
     m_BP3Serializer.UpdateOffsetsInMetadata();
@@ -354,9 +544,9 @@ void BPFileWriter::AggregateWriteData(const bool isFinal,
         m_BP3Serializer.ResetBuffer(bufferSTL, false, false);
 
         m_BP3Serializer.AggregateCollectiveMetadata(
-            m_BP3Serializer.m_Aggregator.m_Comm, bufferSTL, false);
+            m_BP3Serializer.m_Aggregator->m_Comm, bufferSTL, false);
 
-        if (m_BP3Serializer.m_Aggregator.m_IsConsumer)
+        if (m_BP3Serializer.m_Aggregator->m_IsConsumer)
         {
             m_FileDataManager.WriteFiles(bufferSTL.m_Buffer.data(),
                                          bufferSTL.m_Position, transportIndex);
@@ -365,7 +555,7 @@ void BPFileWriter::AggregateWriteData(const bool isFinal,
         }
     }
 
-    m_BP3Serializer.m_Aggregator.ResetBuffers();
+    m_BP3Serializer.m_Aggregator->ResetBuffers();
 }
 
 } // end namespace engine
@@ -11,6 +11,10 @@
 #ifndef ADIOS2_ENGINE_BP_BPFILEWRITER_H_
 #define ADIOS2_ENGINE_BP_BPFILEWRITER_H_
 
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <future>
+/// \endcond
+
 #include "adios2/ADIOSConfig.h"
 #include "adios2/core/Engine.h"
 #include "adios2/toolkit/format/bp3/BP3.h"
@@ -54,6 +58,17 @@ private:
     /** Manages the optional collective metadata files */
     transportman::TransportMan m_FileMetadataManager;
 
+    /** AsyncWrite=On: data buffer being written by the background thread,
+     * swapped with the serializer data buffer at each flush */
+    BufferSTL m_AsyncBuffer;
+
+    /** AsyncWrite=On: pending background write of m_AsyncBuffer */
+    std::future<void> m_AsyncWriteFuture;
+
+    /** AsyncWrite=On, rank 0: aggregated metadata of the last flush, written
+     * at the next flush or Close once the data it indexes is in the files */
+    std::vector<char> m_PendingMetadata;
+
     void Init() final;
 
     /** Parses parameters from IO SetParameters */
@@ -74,10 +89,13 @@ private:
      * Common function for primitive PutSync, puts variables in buffer
      * @param variable
      * @param values
+     * @param byReference true: payload is written from blockInfo.Data at
+     * flush, see DeferredByReference
      */
     template <class T>
     void PutSyncCommon(Variable<T> &variable,
-                       const typename Variable<T>::Info &blockInfo);
+                       const typename Variable<T>::Info &blockInfo,
+                       const bool byReference = false);
 
     template <class T>
     void PutDeferredCommon(Variable<T> &variable, const T *data);
@@ -90,14 +108,50 @@ private:
      * profilers*/
     void WriteProfilingJSONFile();
 
+    /**
+     * Rewrites the metadata file with the index of all steps flushed so far.
+     * If IsMetadataDeferred, writes the index of the previous flush instead.
+     * @param isFinal true: writes the current index
+     */
     void WriteCollectiveMetadataFile(const bool isFinal = false);
 
+    /**
+     * IncrementalMetadata=On: appends the metadata record of the steps
+     * flushed since the previous record to the metadata file, which stays
+     * open until the final record. If IsMetadataDeferred, the record is
+     * appended at the next flush, so data is in the file before readers
+     * find its metadata.
+     * @param isFinal true: flags the last record and closes the file
+     */
+    void WriteMetadataRecord(const bool isFinal = false);
+
+    /**
+     * @return true if data of a flush might still be written in the
+     * background when its metadata is aggregated (AsyncWrite=On)
+     */
+    bool IsMetadataDeferred() const noexcept;
+
     /**
      * N-to-N data buffers writes, including metadata file
      * @param transportIndex
      */
     void WriteData(const bool isFinal, const int transportIndex = -1);
 
+    /**
+     * Writes a data buffer, gathering its chunks and references if any
+     * @param bufferSTL data buffer
+     * @param size used bytes of the current chunk bufferSTL.m_Buffer
+     * @param transportIndex
+     */
+    void WriteDataBuffer(const BufferSTL &bufferSTL, const size_t size,
+                         const int transportIndex);
+
+    /**
+     * Waits for a pending background write (AsyncWrite=On), providing
+     * back-pressure when both buffers are full. Waiting time is profiled.
+     */
+    void WaitAsyncWrite();
+
     /**
      * N-to-M (aggregation) data buffers writes, including metadata file
      * @param transportIndex
@@ -21,7 +21,8 @@ namespace engine
 
 template <class T>
 void BPFileWriter::PutSyncCommon(Variable<T> &variable,
-                                 const typename Variable<T>::Info &blockInfo)
+                                 const typename Variable<T>::Info &blockInfo,
+                                 const bool byReference)
 {
     // if first timestep Write create a new pg index
     if (!m_BP3Serializer.m_MetadataSet.DataPGIsOpen)
@@ -31,13 +32,16 @@ void BPFileWriter::PutSyncCommon(Variable<T> &variable,
             m_FileDataManager.GetTransportsTypes());
     }
 
+    // referenced payloads are not copied to the data buffer
     const size_t dataSize =
-        variable.PayloadSize() +
+        (byReference ? 0 : m_BP3Serializer.GetPayloadSizeInData(variable,
+                                                                 blockInfo)) +
         m_BP3Serializer.GetBPIndexSizeInData(variable.m_Name, blockInfo.Count);
 
+    const std::string hint("in call to variable " + variable.m_Name + " Put");
+
     const format::BP3Base::ResizeResult resizeResult =
-        m_BP3Serializer.ResizeBuffer(dataSize, "in call to variable " +
-                                                   variable.m_Name + " Put");
+        m_BP3Serializer.ResizeBuffer(dataSize, hint);
 
     if (resizeResult == format::BP3Base::ResizeResult::Flush)
     {
@@ -48,11 +52,23 @@ void BPFileWriter::PutSyncCommon(Variable<T> &variable,
         m_BP3Serializer.PutProcessGroupIndex(
             m_IO.m_Name, m_IO.m_HostLanguage,
             m_FileDataManager.GetTransportsTypes());
+
+        // the current buffer chunk, kept by ResetBuffer, might be smaller
+        // than dataSize
+        if (m_BP3Serializer.ResizeBuffer(dataSize, hint) ==
+            format::BP3Base::ResizeResult::Flush)
+        {
+            throw std::runtime_error(
+                "ERROR: data size: " + std::to_string(dataSize) +
+                " bytes doesn't fit in an empty buffer of MaxBufferSize, "
+                "try increasing MaxBufferSize in call to IO SetParameters " +
+                hint + "\n");
+        }
     }
 
     // WRITE INDEX to data buffer and metadata structure (in memory)//
     m_BP3Serializer.PutVariableMetadata(variable, blockInfo);
-    m_BP3Serializer.PutVariablePayload(variable, blockInfo);
+    m_BP3Serializer.PutVariablePayload(variable, blockInfo, byReference);
 }
 
 template <class T>
@@ -61,7 +77,9 @@ void BPFileWriter::PutDeferredCommon(Variable<T> &variable, const T *data)
     variable.SetStepBlockInfo(data, CurrentStep());
     m_BP3Serializer.m_DeferredVariables.insert(variable.m_Name);
     m_BP3Serializer.m_DeferredVariablesDataSize +=
-        variable.PayloadSize() +
+        (m_BP3Serializer.IsDeferredByReference(variable)
+             ? 0
+             : variable.PayloadSize()) +
         m_BP3Serializer.GetBPIndexSizeInData(variable.m_Name, variable.m_Count);
 }
 
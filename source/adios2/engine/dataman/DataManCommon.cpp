@@ -10,6 +10,8 @@
 
 #include "DataManCommon.h"
 
+#include <stdexcept> //std::invalid_argument
+
 namespace adios2
 {
 namespace core
@@ -28,6 +30,21 @@ DataManCommon::DataManCommon(const std::string engineType, IO &io,
 
     GetIntParameter(m_IO.m_Parameters, "TransportChannels",
                     m_TransportChannels);
+
+    GetStringParameter(m_IO.m_Parameters, "Format", m_Format);
+    if (m_Format == "binary")
+    {
+        m_Format = "dataman";
+        m_BinaryMetadata = true;
+    }
+    else if (m_DebugMode && m_Format != "dataman" && m_Format != "bp")
+    {
+        throw std::invalid_argument("ERROR: DataMan Format parameter " +
+                                    m_Format +
+                                    " must be dataman, binary or bp, in call "
+                                    "to Open " +
+                                    name + "\n");
+    }
 }
 
 bool DataManCommon::GetBoolParameter(Params &params, std::string key,
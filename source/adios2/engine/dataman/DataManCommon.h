@@ -39,7 +39,10 @@ protected:
     int m_MPISize;
     int m_RemoteMPISize;
     int m_TransportChannels = 1;
+    /** Format parameter: dataman (JSON metadata), binary (dataman with
+     * compact binary metadata) or bp, readers accept both dataman kinds */
     std::string m_Format = "dataman";
+    bool m_BinaryMetadata = false;
     std::string m_WorkflowMode = "subscribe";
     bool m_Synchronous = true;
     size_t m_BufferSize = 1024 * 1024 * 1024;
@@ -15,6 +15,11 @@
 #include "adios2/ADIOSMacros.h"
 #include "adios2/helper/adiosFunctions.h" //CSVToVector
 
+#include <iostream>  //std::cout
+#include <limits>    //std::numeric_limits
+#include <stdexcept> //std::invalid_argument
+#include <thread>    //std::this_thread::yield
+
 namespace adios2
 {
 namespace core
@@ -52,10 +57,21 @@ StepStatus DataManReader::BeginStep(StepMode stepMode,
     {
         m_CurrentStep = m_DataManDeserializer.MinStep();
     }
+    else if (m_DropOldest)
+    {
+        // skip steps dropped by the IO thread
+        const size_t minStep = m_DataManDeserializer.MinStep();
+        if (minStep != std::numeric_limits<size_t>::max() &&
+            m_CurrentStep < static_cast<int64_t>(minStep))
+        {
+            m_CurrentStep = minStep;
+        }
+    }
     StepStatus status;
 
+    // protects the step from drop_oldest until EndStep
     std::shared_ptr<std::vector<format::DataManDeserializer::DataManVar>> vars =
-        m_DataManDeserializer.GetMetaData(m_CurrentStep);
+        m_DataManDeserializer.PinMetaData(m_CurrentStep);
 
     if (vars == nullptr)
     {
@@ -86,7 +102,10 @@ StepStatus DataManReader::BeginStep(StepMode stepMode,
     return status;
 }
 
-void DataManReader::EndStep() { m_DataManDeserializer.Erase(m_CurrentStep); }
+void DataManReader::EndStep()
+{
+    m_DataManDeserializer.Erase(m_CurrentStep);
+}
 
 size_t DataManReader::CurrentStep() const { return m_CurrentStep; }
 
@@ -113,6 +132,27 @@ void DataManReader::Init()
         m_Synchronous = false;
     }
 
+    int maxBufferedSteps = 0;
+    GetIntParameter(m_IO.m_Parameters, "MaxBufferedSteps", maxBufferedSteps);
+    if (m_DebugMode && maxBufferedSteps < 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: DataMan MaxBufferedSteps parameter must be >= 0" +
+            m_EndMessage);
+    }
+    m_MaxBufferedSteps = static_cast<size_t>(maxBufferedSteps);
+
+    std::string policy = "block";
+    GetStringParameter(m_IO.m_Parameters, "BufferedStepsPolicy", policy);
+    if (m_DebugMode && policy != "block" && policy != "drop_oldest")
+    {
+        throw std::invalid_argument(
+            "ERROR: DataMan BufferedStepsPolicy parameter " + policy +
+            " must be block or drop_oldest" + m_EndMessage);
+    }
+    m_DropOldest = (policy == "drop_oldest");
+    GetIntParameter(m_IO.m_Parameters, "Verbose", m_Verbosity);
+
     // initialize transports
     m_DataMan = std::make_shared<transportman::DataMan>(m_MPIComm, m_DebugMode);
     for (auto &i : m_IO.m_TransportsParameters)
@@ -120,6 +160,7 @@ void DataManReader::Init()
         i["WorkflowMode"] = m_WorkflowMode;
     }
     size_t channels = m_IO.m_TransportsParameters.size();
+    m_TransportChannels = static_cast<int>(channels);
     std::vector<std::string> names;
     for (size_t i = 0; i < channels; ++i)
     {
@@ -138,20 +179,64 @@ void DataManReader::Init()
 
 void DataManReader::IOThread(std::shared_ptr<transportman::DataMan> man)
 {
+    bool blocked = false;
     while (m_Listening)
     {
-        std::shared_ptr<std::vector<char>> buffer = man->ReadWAN(0);
-        if (buffer != nullptr)
+        if (m_Callbacks.empty() && BufferedStepsFull(blocked))
+        {
+            // leave messages in the transport queues, which stop receiving
+            // when full
+            std::this_thread::yield();
+            continue;
+        }
+
+        bool received = false;
+        for (int i = 0; i < m_TransportChannels; ++i)
         {
-            m_DataManDeserializer.Put(buffer);
+            std::shared_ptr<std::vector<char>> buffer = man->ReadWAN(i);
+            if (buffer != nullptr)
+            {
+                m_DataManDeserializer.Put(buffer);
+                received = true;
+            }
         }
         if (m_Callbacks.empty() == false)
         {
             RunCallback();
         }
+        if (received == false)
+        {
+            std::this_thread::yield();
+        }
     }
 }
 
+bool DataManReader::BufferedStepsFull(bool &blocked)
+{
+    if (m_MaxBufferedSteps == 0)
+    {
+        return false;
+    }
+
+    while (m_DataManDeserializer.Steps() >= m_MaxBufferedSteps)
+    {
+        // the step being read is pinned and kept
+        if (m_DropOldest == false || !m_DataManDeserializer.EraseOldest())
+        {
+            // count each blocking episode once
+            if (blocked == false)
+            {
+                ++m_BlockedCount;
+                blocked = true;
+            }
+            return true;
+        }
+        ++m_DroppedSteps;
+    }
+    blocked = false;
+    return false;
+}
+
 void DataManReader::RunCallback()
 {
     for (size_t step = m_DataManDeserializer.MinStep();
@@ -207,7 +292,16 @@ void DataManReader::RunCallback()
 ADIOS2_FOREACH_TYPE_1ARG(declare_type)
 #undef declare_type
 
-void DataManReader::DoClose(const int transportIndex) {}
+void DataManReader::DoClose(const int transportIndex)
+{
+    if (m_Verbosity > 0)
+    {
+        std::cout << "DataManReader " << m_Name << " rank " << m_MPIRank
+                  << ": steps dropped " << m_DroppedSteps
+                  << ", times blocked at MaxBufferedSteps " << m_BlockedCount
+                  << std::endl;
+    }
+}
 
 void DataManReader::IOThreadBP(std::shared_ptr<transportman::DataMan> man)
 {
@@ -216,7 +310,11 @@ void DataManReader::IOThreadBP(std::shared_ptr<transportman::DataMan> man)
 
     while (m_Listening)
     {
-        std::shared_ptr<std::vector<char>> buffer = man->ReadWAN(0);
+        std::shared_ptr<std::vector<char>> buffer = nullptr;
+        for (int i = 0; i < m_TransportChannels && buffer == nullptr; ++i)
+        {
+            buffer = man->ReadWAN(i);
+        }
         if (buffer != nullptr)
         {
             if (buffer->size() > 0)
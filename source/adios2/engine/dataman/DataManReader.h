@@ -14,6 +14,8 @@
 
 #include "DataManCommon.h"
 
+#include <atomic>
+
 namespace adios2
 {
 namespace core
@@ -51,8 +53,22 @@ private:
 
     bool m_Listening = false;
 
+    /** MaxBufferedSteps parameter, 0 is unlimited */
+    size_t m_MaxBufferedSteps = 0;
+    /** BufferedStepsPolicy parameter: block stops draining the transport
+     * queues while full, drop_oldest erases the oldest step not being read */
+    bool m_DropOldest = false;
+    int m_Verbosity = 0;
+
+    std::atomic<size_t> m_DroppedSteps{0};
+    std::atomic<size_t> m_BlockedCount{0};
+
     std::mutex m_MutexIO;
 
+    /** @return true if the buffered steps are at m_MaxBufferedSteps after
+     * applying the policy, IO thread only */
+    bool BufferedStepsFull(bool &blocked);
+
     void IOThread(std::shared_ptr<transportman::DataMan> man) final;
     void IOThreadBP(std::shared_ptr<transportman::DataMan> man);
 
@@ -26,7 +26,13 @@ template <class T>
 void DataManReader::GetSyncCommon(Variable<T> &variable, T *data)
 {
     variable.SetData(data);
-    m_DataManDeserializer.Get(variable, m_CurrentStep);
+    if (m_DataManDeserializer.Get(variable, m_CurrentStep) == -3)
+    {
+        throw std::runtime_error("ERROR: step " +
+                                 std::to_string(m_CurrentStep) +
+                                 " was erased while reading variable " +
+                                 variable.m_Name + ", in call to Get\n");
+    }
 }
 
 template <class T>
@@ -51,6 +51,20 @@ void DataManWriter::EndStep()
         m_BP3Serializer->ResetBuffer(m_BP3Serializer->m_Data, true);
         m_BP3Serializer->ResetIndices();
     }
+    else if (m_Format == "dataman" && m_ZeroCopy)
+    {
+        // channels send in parallel, Put data is released when all are done
+        std::vector<std::future<void>> released;
+        for (size_t i = 0; i < m_TransportChannels; ++i)
+        {
+            released.push_back(
+                m_DataMan->WriteWAN(m_DataManSerializer[i]->GetSegments(), i));
+        }
+        for (auto &channelReleased : released)
+        {
+            channelReleased.get();
+        }
+    }
     else if (m_Format == "dataman")
     {
         for (size_t i = 0; i < m_TransportChannels; ++i)
@@ -70,12 +84,15 @@ size_t DataManWriter::CurrentStep() const { return m_CurrentStep; }
 void DataManWriter::Init()
 {
     m_TransportChannels = m_IO.m_TransportsParameters.size();
+    GetBoolParameter(m_IO.m_Parameters, "ZeroCopy", m_ZeroCopy);
 
     if (m_Format == "bp")
     {
         m_BP3Serializer =
             std::make_shared<format::BP3Serializer>(m_MPIComm, m_DebugMode);
         m_BP3Serializer->InitParameters(m_IO.m_Parameters);
+        m_BP3Serializer->m_ThreadPool = m_IO.m_ThreadPool;
+        m_BP3Serializer->m_FuseMinMax = true;
         m_BP3Serializer->PutProcessGroupIndex(m_IO.m_Name, m_IO.m_HostLanguage,
                                               {"WAN_Zmq"});
     }
@@ -84,7 +101,8 @@ void DataManWriter::Init()
         for (size_t i = 0; i < m_TransportChannels; ++i)
         {
             m_DataManSerializer.push_back(
-                std::make_shared<format::DataManSerializer>());
+                std::make_shared<format::DataManSerializer>(m_BinaryMetadata,
+                                                            m_ZeroCopy));
         }
     }
 
@@ -41,6 +41,9 @@ private:
     bool m_DoMonitor = false;
     bool m_Blocking = true;
     size_t m_StepsPerBuffer = 10;
+    /** ZeroCopy parameter: large payloads are sent from Put data, which must
+     * stay unchanged until EndStep returns */
+    bool m_ZeroCopy = false;
 
     std::shared_ptr<format::BP3Serializer> m_BP3Serializer;
     std::vector<std::shared_ptr<format::DataManSerializer>> m_DataManSerializer;
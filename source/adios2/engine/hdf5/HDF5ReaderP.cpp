@@ -11,6 +11,8 @@
 #include "HDF5ReaderP.h"
 #include "HDF5ReaderP.tcc"
 
+#include <algorithm> // std::min, std::max
+
 #include "adios2/ADIOSMPI.h"
 #include "adios2/helper/adiosFunctions.h" //CSVToVector
 
@@ -179,58 +181,116 @@ size_t HDF5ReaderP::ReadDataset(hid_t dataSetId, hid_t h5Type,
     return slabsize;
 }
 
+// returns slab size of all steps read (>0)
+// returns 0 to advise do not continue
 template <class T>
-void HDF5ReaderP::UseHDFRead(Variable<T> &variable, T *data, hid_t h5Type)
+size_t HDF5ReaderP::ReadTimeDataset(hid_t dataSetId, hid_t h5Type,
+                                    Variable<T> &variable, T *values)
 {
+    hid_t fileSpace = H5Dget_space(dataSetId);
+    interop::HDF5TypeGuard g_fs(fileSpace, interop::E_H5_SPACE);
 
-    if (!m_H5File.m_IsGeneratedByAdios)
+    if (fileSpace < 0)
     {
-        // UseHDFReadNativeFile(variable, data, h5Type);
-        hid_t dataSetId =
-            H5Dopen(m_H5File.m_FileId, variable.m_Name.c_str(), H5P_DEFAULT);
-        if (dataSetId < 0)
-        {
-            return;
-        }
+        return 0;
+    }
 
-        interop::HDF5TypeGuard g_ds(dataSetId, interop::E_H5_DATASET);
-        ReadDataset(dataSetId, h5Type, variable, data);
-        return;
+    const int ndims =
+        std::max(variable.m_Shape.size(), variable.m_Count.size());
+    hsize_t start[ndims + 1], count[ndims + 1];
+
+    // steps this variable was written for, fewer than the file steps if it
+    // was first written at a later step
+    if (H5Sget_simple_extent_ndims(fileSpace) != ndims + 1)
+    {
+        return 0;
+    }
+    hsize_t dims[ndims + 1];
+    H5Sget_simple_extent_dims(fileSpace, dims, NULL);
+    const size_t numSteps = static_cast<size_t>(dims[0]);
+    if (variable.m_StepsStart >= numSteps)
+    {
+        return 0;
     }
 
-    T *values = data;
-    int ts = 0;
-    // T *values = data;
-    size_t variableStart = variable.m_StepsStart;
-    /*
-      // looks like m_StepsStart is defaulted to be 0 now.
-    if (!m_InStreamMode && (variableStart == 1))
-    { // variableBase::m_StepsStart min=1
-        variableStart = 0;
+    start[0] = variable.m_StepsStart;
+    count[0] = std::min(variable.m_StepsCount,
+                        numSteps - variable.m_StepsStart);
+    size_t slabsize = count[0];
+
+    const bool isOrderC = helper::IsRowMajor(m_IO.m_HostLanguage);
+    for (int i = 0; i < ndims; i++)
+    {
+        const int j = isOrderC ? i : ndims - 1 - i;
+        count[i + 1] = variable.m_Count[j];
+        start[i + 1] = variable.m_Start[j];
+        slabsize *= count[i + 1];
     }
-    */
 
-    while (ts < variable.m_StepsCount)
+    hid_t ret = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, NULL,
+                                    count, NULL);
+    if (ret < 0)
     {
-        try
+        return 0;
+    }
+
+    hid_t memDataSpace = H5Screate_simple(ndims + 1, count, NULL);
+    interop::HDF5TypeGuard g_mds(memDataSpace, interop::E_H5_SPACE);
+
+    ret = H5Dread(dataSetId, h5Type, memDataSpace, fileSpace, H5P_DEFAULT,
+                  values);
+    if (ret < 0)
+    {
+        if (m_DebugMode)
         {
-            m_H5File.SetAdiosStep(variableStart + ts);
+            throw std::runtime_error("ERROR: H5Dread failed for steps of "
+                                     "variable " +
+                                     variable.m_Name + ", in call to Get\n");
         }
-        catch (std::exception &e)
+        return 0;
+    }
+
+    return slabsize;
+}
+
+template <class T>
+void HDF5ReaderP::UseHDFRead(Variable<T> &variable, T *data, hid_t h5Type)
+{
+    // dataset handles are cached by m_H5File until Close
+    if (!m_H5File.m_IsGeneratedByAdios)
+    {
+        hid_t dataSetId = m_H5File.GetDataset(0, variable.m_Name);
+        if (dataSetId < 0)
         {
-            printf("[Not fatal] %s\n", e.what());
-            break;
+            return;
         }
 
-        std::vector<hid_t> chain;
-        if (!m_H5File.OpenDataset(variable.m_Name, chain))
+        ReadDataset(dataSetId, h5Type, variable, data);
+        return;
+    }
+
+    if (m_H5File.m_TimeDimension)
+    {
+        // all selected steps in one read
+        hid_t dataSetId = m_H5File.GetDataset(0, variable.m_Name);
+        if (dataSetId < 0)
         {
             return;
         }
-        hid_t dataSetId = chain.back();
-        interop::HDF5DatasetGuard g(chain);
-        // hid_t dataSetId =
-        //  H5Dopen(m_H5File.m_GroupId, variable.m_Name.c_str(), H5P_DEFAULT);
+
+        ReadTimeDataset(dataSetId, h5Type, variable, data);
+        return;
+    }
+
+    T *values = data;
+    size_t ts = 0;
+    size_t variableStart = variable.m_StepsStart;
+    const size_t numSteps = m_H5File.GetNumAdiosSteps();
+
+    while (ts < variable.m_StepsCount && variableStart + ts < numSteps)
+    {
+        hid_t dataSetId = m_H5File.GetDataset(
+            static_cast<unsigned int>(variableStart + ts), variable.m_Name);
         if (dataSetId < 0)
         {
             return;
@@ -242,8 +302,6 @@ void HDF5ReaderP::UseHDFRead(Variable<T> &variable, T *data, hid_t h5Type)
         {
             break;
         }
-        // H5Sclose(fileSpace);
-        // H5Dclose(dataSetId);
 
         ts++;
         values += slabsize;
@@ -65,6 +65,12 @@ private:
     size_t ReadDataset(hid_t dataSetId, hid_t h5Type, Variable<T> &variable,
                        T *values);
 
+    /** reads the selected steps of a TimeDimension dataset, steps are its
+     * first dimension, with a single hyperslab read */
+    template <class T>
+    size_t ReadTimeDataset(hid_t dataSetId, hid_t h5Type,
+                           Variable<T> &variable, T *values);
+
     template <class T>
     void GetSyncCommon(Variable<T> &variable, T *data);
 
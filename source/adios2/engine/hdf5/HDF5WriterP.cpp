@@ -10,6 +10,9 @@
 
 #include "HDF5WriterP.h"
 
+#include <algorithm> // std::transform, std::reverse
+#include <sstream>   // std::istringstream
+
 #include "adios2/ADIOSMPI.h"
 #include "adios2/helper/adiosFunctions.h" //CSVToVector
 
@@ -35,7 +38,13 @@ StepStatus HDF5WriterP::BeginStep(StepMode mode, const float timeoutSeconds)
     return StepStatus::OK;
 }
 
-void HDF5WriterP::EndStep() { m_H5File.Advance(); }
+void HDF5WriterP::EndStep()
+{
+    PerformPuts();
+    m_H5File.Advance();
+}
+
+void HDF5WriterP::PerformPuts() { m_H5File.PerformWrites(); }
 
 // PRIVATE
 void HDF5WriterP::Init()
@@ -48,6 +57,8 @@ void HDF5WriterP::Init()
             ", in call to ADIOS Open or HDF5Writer constructor\n");
     }
 
+    InitParameters();
+
 #ifdef NEVER
     m_H5File.Init(m_Name, m_MPIComm, true);
 #else
@@ -72,20 +83,84 @@ void HDF5WriterP::Init()
 #endif
 }
 
+void HDF5WriterP::InitParameters()
+{
+    auto lf_OnOff = [&](const std::string &key, const std::string &value) {
+        if (value == "on" || value == "On")
+        {
+            return true;
+        }
+        if (m_DebugMode && value != "off" && value != "Off")
+        {
+            throw std::invalid_argument("ERROR: IO SetParameters " + key +
+                                        " invalid value, valid: On or Off" +
+                                        m_EndMessage);
+        }
+        return false;
+    };
+
+    for (const auto &pair : m_IO.m_Parameters)
+    {
+        std::string key(pair.first);
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+
+        const std::string value(pair.second);
+
+        if (key == "chunkdims")
+        {
+            // comma separated, in the order of the variables' dimensions
+            Dims chunkDims;
+            std::istringstream valueSS(value);
+            std::string dim;
+            while (std::getline(valueSS, dim, ','))
+            {
+                chunkDims.push_back(helper::StringToUInt(
+                    dim, m_DebugMode, "in ChunkDims=" + value + m_EndMessage));
+            }
+            if (!helper::IsRowMajor(m_IO.m_HostLanguage))
+            {
+                std::reverse(chunkDims.begin(), chunkDims.end());
+            }
+            m_H5File.m_ChunkDims = chunkDims;
+        }
+        else if (key == "deflatelevel")
+        {
+            m_H5File.m_DeflateLevel = helper::StringToUInt(
+                value, m_DebugMode, "in DeflateLevel" + m_EndMessage);
+            if (m_DebugMode && m_H5File.m_DeflateLevel > 9)
+            {
+                throw std::invalid_argument(
+                    "ERROR: IO SetParameters DeflateLevel must be 0 (off) to "
+                    "9" +
+                    m_EndMessage);
+            }
+        }
+        else if (key == "shuffle")
+        {
+            m_H5File.m_Shuffle = lf_OnOff(pair.first, value);
+        }
+        else if (key == "timedimension")
+        {
+            m_H5File.m_TimeDimension = lf_OnOff(pair.first, value);
+        }
+    }
+}
+
 #define declare_type(T)                                                        \
     void HDF5WriterP::DoPutSync(Variable<T> &variable, const T *values)        \
     {                                                                          \
-        DoPutSyncCommon(variable, values);                                     \
+        PutCommon(variable, values);                                           \
+        PerformPuts();                                                         \
     }                                                                          \
     void HDF5WriterP::DoPutDeferred(Variable<T> &variable, const T *values)    \
     {                                                                          \
-        DoPutSyncCommon(variable, values);                                     \
+        PutCommon(variable, values);                                           \
     }
 ADIOS2_FOREACH_TYPE_1ARG(declare_type)
 #undef declare_type
 
 template <class T>
-void HDF5WriterP::DoPutSyncCommon(Variable<T> &variable, const T *values)
+void HDF5WriterP::PutCommon(Variable<T> &variable, const T *values)
 {
 
     bool isOrderC = helper::IsRowMajor(m_IO.m_HostLanguage);
@@ -112,16 +187,17 @@ void HDF5WriterP::DoPutSyncCommon(Variable<T> &variable, const T *values)
              * duplicate var attributes and convert to c order before saving.
              */
             dup.SetData(values);
-            m_H5File.Write(dup, values);
+            m_H5File.DefineWrite(dup, values);
             return;
         }
     }
     variable.SetData(values);
-    m_H5File.Write(variable, values);
+    m_H5File.DefineWrite(variable, values);
 }
 
 void HDF5WriterP::DoClose(const int transportIndex)
 {
+    PerformPuts();
     m_H5File.WriteAttrFromIO(m_IO);
     m_H5File.Close();
 }
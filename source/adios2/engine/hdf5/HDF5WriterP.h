@@ -44,20 +44,29 @@ public:
 
     StepStatus BeginStep(StepMode mode, const float timeoutSeconds = 0.f) final;
     void EndStep() final;
+    void PerformPuts() final;
 
 private:
     interop::HDF5Common m_H5File;
 
     void Init();
 
+    /** ChunkDims, DeflateLevel, Shuffle and TimeDimension parameters */
+    void InitParameters();
+
 #define declare_type(T)                                                        \
     void DoPutSync(Variable<T> &variable, const T *values) final;              \
     void DoPutDeferred(Variable<T> &variable, const T *values) final;
     ADIOS2_FOREACH_TYPE_1ARG(declare_type)
 #undef declare_type
 
+    /**
+     * Creates the block dataset, data is written at PerformPuts
+     * @param variable
+     * @param values must stay valid until PerformPuts
+     */
     template <class T>
-    void DoPutSyncCommon(Variable<T> &variable, const T *values);
+    void PutCommon(Variable<T> &variable, const T *values);
 
     void DoClose(const int transportIndex = -1) final;
 };
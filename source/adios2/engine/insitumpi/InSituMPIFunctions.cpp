@@ -182,9 +182,10 @@ std::vector<int> AssignPeers(const int rank, const int nproc,
 
 int ConnectDirectPeers(const MPI_Comm commWorld, const bool IAmSender,
                        const bool IAmWriterRoot, const int globalRank,
-                       const std::vector<int> &peers)
+                       const std::vector<int> &peers, bool &useRMA)
 {
-    int token = (IAmWriterRoot ? 1 : 0);
+    // bit 0: writer root, bit 1: one-sided transfers
+    int token = (IAmWriterRoot ? 1 : 0) | (useRMA ? 2 : 0);
     int writeRootGlobalRank = -1;
     MPI_Status status;
     for (const auto peerRank : peers)
@@ -201,13 +202,43 @@ int ConnectDirectPeers(const MPI_Comm commWorld, const bool IAmSender,
             //          << std::endl;
             MPI_Recv(&token, 1, MPI_INT, peerRank, MpiTags::Connect, commWorld,
                      &status);
-            if (token == 1)
+            if (token & 1)
                 writeRootGlobalRank = peerRank;
+            useRMA = (token & 2) != 0;
         }
     }
     return writeRootGlobalRank;
 }
 
+MPI_Comm CreateRMAComm(const MPI_Comm comm, const MPI_Comm commWorld,
+                       const bool amIWriter, const std::vector<int> &peers)
+{
+    int wrank, nproc;
+    MPI_Comm_rank(commWorld, &wrank);
+    MPI_Comm_size(comm, &nproc);
+
+    std::vector<int> ours(nproc);
+    MPI_Allgather(&wrank, 1, MPI_INT, ours.data(), 1, MPI_INT, comm);
+
+    std::vector<int> ranks;
+    ranks.reserve(ours.size() + peers.size());
+    const std::vector<int> &writers = amIWriter ? ours : peers;
+    const std::vector<int> &readers = amIWriter ? peers : ours;
+    ranks.insert(ranks.end(), writers.begin(), writers.end());
+    ranks.insert(ranks.end(), readers.begin(), readers.end());
+
+    MPI_Group worldGroup, rmaGroup;
+    MPI_Comm_group(commWorld, &worldGroup);
+    MPI_Group_incl(worldGroup, static_cast<int>(ranks.size()), ranks.data(),
+                   &rmaGroup);
+
+    MPI_Comm rmaComm;
+    MPI_Comm_create_group(commWorld, rmaGroup, MpiTags::RMAComm, &rmaComm);
+    MPI_Group_free(&rmaGroup);
+    MPI_Group_free(&worldGroup);
+    return rmaComm;
+}
+
 } // end namespace insitumpi
 
 } // end namespace adios2
@@ -39,6 +39,9 @@ enum MpiTags
     ReadSchedule,
     Data,
     ReadCompleted,
+    BlockAddressesLength,
+    BlockAddresses,
+    RMAComm,
     LastTag
 };
 
@@ -59,11 +62,21 @@ std::vector<int> AssignPeers(const int rank, const int nproc,
 // on the Writer and Reader side at the same time.
 // IAmSender is true on the writers, false on the readers.
 // IAmWriterRoot is true only on one writer who will send the global metadata.
+// useRMA is the writers' one-sided transfer mode, it is input on the
+// writers and output on the readers.
 // return global rank of writer root on the reader who is connected to writer
 // root, -1 everywhere else.
 int ConnectDirectPeers(const MPI_Comm commWorld, const bool IAmSender,
                        const bool IAmWriterRoot, const int globalRank,
-                       const std::vector<int> &peers);
+                       const std::vector<int> &peers, bool &useRMA);
+
+// Create the communicator of all writers and readers of a stream for
+// one-sided transfers: writers in writer rank order, then readers in reader
+// rank order. comm is 'our' communicator, peers are all the peers' ranks in
+// commWorld. This is collective & blocking function and must be called both
+// on the Writer and Reader side at the same time.
+MPI_Comm CreateRMAComm(const MPI_Comm comm, const MPI_Comm commWorld,
+                       const bool amIWriter, const std::vector<int> &peers);
 
 } // end namespace insitumpi
 
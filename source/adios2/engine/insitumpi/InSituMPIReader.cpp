@@ -52,7 +52,13 @@ InSituMPIReader::InSituMPIReader(IO &io, const std::string &name,
     }
 
     m_WriteRootGlobalRank = insitumpi::ConnectDirectPeers(
-        m_CommWorld, false, false, m_GlobalRank, m_RankDirectPeers);
+        m_CommWorld, false, false, m_GlobalRank, m_RankDirectPeers, m_RMA);
+    if (m_RMA)
+    {
+        m_RMAComm = insitumpi::CreateRMAComm(mpiComm, m_CommWorld, false,
+                                             m_RankAllPeers);
+        MPI_Win_create_dynamic(MPI_INFO_NULL, m_RMAComm, &m_Window);
+    }
     if (m_WriteRootGlobalRank > -1)
     {
         m_ReaderRootRank = m_ReaderRank;
@@ -254,23 +260,36 @@ void InSituMPIReader::PerformGets()
     int nRequests = insitumpi::FixSeeksToZeroOffset(
         m_ReadScheduleMap, helper::IsRowMajor(m_IO.m_HostLanguage));
 
-    if (m_CurrentStep == 0 || !m_FixedLocalSchedule)
+    if (m_RMA)
     {
-        // Send schedule to writers
-        SendReadSchedule(m_ReadScheduleMap);
+        // no schedule exchange, pull the data from the writers' buffers
+        ReceiveBlockAddresses();
+        MPI_Win_lock_all(0, m_Window);
+        AsyncRecvAllVariables();
+        // all gets complete at unlock
+        MPI_Win_unlock_all(m_Window);
     }
-
-    if (m_CurrentStep == 0 || !m_FixedLocalSchedule || !m_FixedRemoteSchedule)
+    else
     {
-        // Allocate the MPI_Request and OngoingReceives vectors
-        m_MPIRequests.reserve(nRequests);
-        m_OngoingReceives.reserve(nRequests);
+        if (m_CurrentStep == 0 || !m_FixedLocalSchedule)
+        {
+            // Send schedule to writers
+            SendReadSchedule(m_ReadScheduleMap);
+        }
 
-        // Make the receive requests for each variable
-        AsyncRecvAllVariables();
-    }
+        if (m_CurrentStep == 0 || !m_FixedLocalSchedule ||
+            !m_FixedRemoteSchedule)
+        {
+            // Allocate the MPI_Request and OngoingReceives vectors
+            m_MPIRequests.reserve(nRequests);
+            m_OngoingReceives.reserve(nRequests);
 
-    ProcessReceives();
+            // Make the receive requests for each variable
+            AsyncRecvAllVariables();
+        }
+
+        ProcessReceives();
+    }
 
     m_BP3Deserializer.m_PerformedGets = true;
     if (m_Verbosity == 5)
@@ -306,6 +325,11 @@ void InSituMPIReader::EndStep()
     ClearMetadataBuffer();
 
     // Send final acknowledgment to the Writer
+    if (m_RMA)
+    {
+        // every reader's gets must be complete before the writers detach
+        MPI_Barrier(m_MPIComm);
+    }
     int dummy = 1;
     MPI_Bcast(&dummy, 1, MPI_INT, m_ReaderRootRank, m_MPIComm);
     if (m_ReaderRootRank == m_ReaderRank)
@@ -356,6 +380,40 @@ void InSituMPIReader::SendReadSchedule(
     MPI_Waitall(m_RankAllPeers.size(), request.data(), status.data());
 }
 
+void InSituMPIReader::ReceiveBlockAddresses()
+{
+    unsigned long addressesLen = 0;
+    std::vector<char> addresses;
+    if (m_ReaderRootRank == m_ReaderRank)
+    {
+        MPI_Status status;
+        MPI_Recv(&addressesLen, 1, MPI_UNSIGNED_LONG, m_WriteRootGlobalRank,
+                 insitumpi::MpiTags::BlockAddressesLength, m_CommWorld,
+                 &status);
+        addresses.resize(addressesLen);
+        MPI_Recv(addresses.data(), addressesLen, MPI_CHAR,
+                 m_WriteRootGlobalRank, insitumpi::MpiTags::BlockAddresses,
+                 m_CommWorld, &status);
+    }
+
+    // broadcast block addresses to every reader
+    MPI_Bcast(&addressesLen, 1, MPI_UNSIGNED_LONG, m_ReaderRootRank,
+              m_MPIComm);
+    addresses.resize(addressesLen);
+    MPI_Bcast(addresses.data(), addressesLen, MPI_CHAR, m_ReaderRootRank,
+              m_MPIComm);
+
+    size_t pos = 0;
+    const int nWriters = helper::ReadValue<int>(addresses, pos);
+    m_BlockAddresses.clear();
+    m_BlockAddresses.reserve(nWriters);
+    for (int i = 0; i < nWriters; i++)
+    {
+        m_BlockAddresses.push_back(
+            insitumpi::DeserializeBlockAddresses(addresses, pos));
+    }
+}
+
 void InSituMPIReader::AsyncRecvAllVariables()
 {
     // <variable, <writer, <steps, <SubFileInfo>>>>
@@ -379,7 +437,14 @@ void InSituMPIReader::AsyncRecvAllVariables()
                 "ERROR: variable " + variablePair.first +                      \
                 " not found, in call to AsyncSendVariable\n");                 \
         }                                                                      \
-        AsyncRecvVariable<T>(*variable, variablePair.second);                  \
+        if (m_RMA)                                                             \
+        {                                                                      \
+            GetVariable<T>(*variable, variablePair.second);                    \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            AsyncRecvVariable<T>(*variable, variablePair.second);              \
+        }                                                                      \
     }
 
         ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
@@ -508,6 +573,13 @@ void InSituMPIReader::DoClose(const int transportIndex)
                       << "% of data in place (zero-copy)" << std::endl;
         }
     }
+
+    if (m_RMA)
+    {
+        // collective with the writers' Close
+        MPI_Win_free(&m_Window);
+        MPI_Comm_free(&m_RMAComm);
+    }
 }
 
 } // end namespace engine
@@ -14,6 +14,7 @@
 #ifndef ADIOS2_ENGINE_INSITUMPIREADER_H_
 #define ADIOS2_ENGINE_INSITUMPIREADER_H_
 
+#include "InSituMPISchedules.h"
 #include "adios2/ADIOSConfig.h"
 #include "adios2/core/ADIOS.h"
 #include "adios2/core/Engine.h"
@@ -131,6 +132,23 @@ private:
         : sfi(p), varNamePointer(v), inPlaceDataArray(ptr){};
     };
 
+    /** One-sided transfers, decided by the writers' RMA parameter */
+    bool m_RMA = false;
+    MPI_Comm m_RMAComm = MPI_COMM_NULL; // writers then readers
+    MPI_Win m_Window = MPI_WIN_NULL;    // writers' Put buffers
+
+    /** this step's block addresses in m_Window per writer */
+    std::vector<insitumpi::BlockAddressMap> m_BlockAddresses;
+
+    /** Receive the block addresses of all writers for this step */
+    void ReceiveBlockAddresses();
+
+    /** MPI_Get the selections of a variable from the writers' buffers
+     * straight into the user data (RMA mode) */
+    template <class T>
+    void GetVariable(const Variable<T> &variable,
+                     const helper::SubFileInfoMap &subFileInfoMap);
+
     std::vector<OngoingReceive> m_OngoingReceives;
     // We need a contiguous array of MPI_Requests, so we
     // have it here separately from OnGoingReceive struct
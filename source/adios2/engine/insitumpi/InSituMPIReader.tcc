@@ -13,7 +13,9 @@
 
 #include "InSituMPIReader.h"
 
+#include <algorithm> // std::find_if
 #include <iostream>
+#include <limits>    // std::numeric_limits
 
 namespace adios2
 {
@@ -72,7 +74,8 @@ void InSituMPIReader::GetDeferredCommon(Variable<T> &variable, T *data)
         std::cout << "InSituMPI Reader " << m_ReaderRank << " GetDeferred("
                   << variable.m_Name << ")\n";
     }
-    if (m_FixedLocalSchedule && m_FixedRemoteSchedule && m_CurrentStep > 0)
+    if (!m_RMA && m_FixedLocalSchedule && m_FixedRemoteSchedule &&
+        m_CurrentStep > 0)
     {
         variable.SetData(data);
         // Create the async send for the variable now
@@ -134,17 +137,31 @@ void InSituMPIReader::AsyncRecvVariable(
                 const int index = m_MPIRequests.size() - 1;
                 size_t elementOffset, dummy;
 
+                const Box<Dims> selectionBox = helper::StartEndBox(
+                    variable.m_Start, variable.m_Count,
+                    m_BP3Deserializer.m_ReverseDimensions);
+                const bool isSourceContiguous =
+                    helper::IsIntersectionContiguousSubarray(
+                        sfi.BlockBox, sfi.IntersectionBox,
+                        m_BP3Deserializer.m_IsRowMajor, dummy);
+                // the writer sends a strided source with a subarray datatype,
+                // so only the intersection arrives (see InSituMPIWriter.tcc)
+                const bool isIntersectionOnly =
+                    isSourceContiguous ||
+                    insitumpi::IsSubarrayDatatypeBox(sfi.BlockBox);
+                const size_t intersectionSize =
+                    helper::GetTotalSize(
+                        helper::StartCountBox(sfi.IntersectionBox.first,
+                                              sfi.IntersectionBox.second)
+                            .second) *
+                    sizeof(T);
+
                 // Do we read a contiguous piece from the source?
                 // and do we write a contiguous piece into the user data?
-                if (helper::IsIntersectionContiguousSubarray(
-                        sfi.BlockBox, sfi.IntersectionBox,
-                        m_BP3Deserializer.m_IsRowMajor, dummy) &&
+                if (isSourceContiguous &&
                     helper::IsIntersectionContiguousSubarray(
-                        helper::StartEndBox(
-                            variable.m_Start, variable.m_Count,
-                            m_BP3Deserializer.m_ReverseDimensions),
-                        sfi.IntersectionBox, m_BP3Deserializer.m_IsRowMajor,
-                        elementOffset))
+                        selectionBox, sfi.IntersectionBox,
+                        m_BP3Deserializer.m_IsRowMajor, elementOffset))
                 {
 
                     // Receive in place (of user data pointer)
@@ -167,25 +184,187 @@ void InSituMPIReader::AsyncRecvVariable(
                     }
                     m_BytesReceivedInPlace += blockSize;
                 }
+                else if (isIntersectionOnly &&
+                         insitumpi::IsSubarrayDatatypeBox(selectionBox))
+                {
+                    // Receive strided in place (of user data pointer)
+                    char *ptr = reinterpret_cast<char *>(variable.GetData());
+                    m_OngoingReceives.emplace_back(sfi, &variable.m_Name, ptr);
+                    MPI_Datatype datatype = insitumpi::CreateSubarrayDatatype(
+                        selectionBox, sfi.IntersectionBox, sizeof(T),
+                        m_BP3Deserializer.m_IsRowMajor);
+                    MPI_Irecv(m_OngoingReceives[index].inPlaceDataArray, 1,
+                              datatype, m_RankAllPeers[writerRank],
+                              insitumpi::MpiTags::Data, m_CommWorld,
+                              m_MPIRequests.data() + index);
+                    // freed when the receive completes
+                    MPI_Type_free(&datatype);
+                    if (m_Verbosity == 5)
+                    {
+                        std::cout << "InSituMPI Reader " << m_ReaderRank
+                                  << " requested in-place subarray receive"
+                                  << std::endl;
+                    }
+                    m_BytesReceivedInPlace += intersectionSize;
+                }
                 else
                 {
                     // Receive in temporary array and copy in later
-                    m_OngoingReceives.emplace_back(sfi, &variable.m_Name);
-                    m_OngoingReceives[index].temporaryDataArray.resize(
-                        blockSize);
-                    MPI_Irecv(
-                        m_OngoingReceives[index].temporaryDataArray.data(),
-                        blockSize, MPI_CHAR, m_RankAllPeers[writerRank],
-                        insitumpi::MpiTags::Data, m_CommWorld,
-                        m_MPIRequests.data() + index);
+                    helper::SubFileInfo temporaryInfo = sfi;
+                    size_t receiveSize = blockSize;
+                    if (isIntersectionOnly)
+                    {
+                        // the temporary holds the intersection only
+                        temporaryInfo.BlockBox = sfi.IntersectionBox;
+                        receiveSize = intersectionSize;
+                    }
+                    m_OngoingReceives.emplace_back(temporaryInfo,
+                                                   &variable.m_Name);
+                    OngoingReceive &receive = m_OngoingReceives[index];
+                    receive.temporaryDataArray.resize(receiveSize);
+                    MPI_Irecv(receive.temporaryDataArray.data(), receiveSize,
+                              MPI_CHAR, m_RankAllPeers[writerRank],
+                              insitumpi::MpiTags::Data, m_CommWorld,
+                              m_MPIRequests.data() + index);
                     if (m_Verbosity == 5)
                     {
                         std::cout << "InSituMPI Reader " << m_ReaderRank
                                   << " requested receive into temporary area"
                                   << std::endl;
                     }
-                    m_BytesReceivedInTemporary += blockSize;
+                    m_BytesReceivedInTemporary += receiveSize;
+                }
+            }
+            break; // there is only one step here
+        }
+    }
+}
+
+template <class T>
+void InSituMPIReader::GetVariable(const Variable<T> &variable,
+                                  const helper::SubFileInfoMap &subFileInfoMap)
+{
+    const Box<Dims> selectionBox =
+        helper::StartEndBox(variable.m_Start, variable.m_Count,
+                            m_BP3Deserializer.m_ReverseDimensions);
+    const bool isRowMajor = m_BP3Deserializer.m_IsRowMajor;
+
+    // <writer, <steps, <SubFileInfo>>>
+    for (const auto &subFileIndexPair : subFileInfoMap)
+    {
+        const size_t writerRank = subFileIndexPair.first; // writer
+        const std::vector<insitumpi::BlockAddress> &blockAddresses =
+            m_BlockAddresses.at(writerRank).at(variable.m_Name);
+
+        // <steps, <SubFileInfo>>  but there is only one step
+        for (const auto &stepPair : subFileIndexPair.second)
+        {
+            for (const auto &sfi : stepPair.second)
+            {
+                auto itBlock = std::find_if(
+                    blockAddresses.begin(), blockAddresses.end(),
+                    [&sfi](const insitumpi::BlockAddress &blockAddress) {
+                        return helper::IdenticalBoxes(blockAddress.BlockBox,
+                                                      sfi.BlockBox);
+                    });
+                if (itBlock == blockAddresses.end())
+                {
+                    throw std::runtime_error(
+                        "ERROR: InSituMPI Reader did not receive the address "
+                        "of a block of " +
+                        variable.m_Name + " from writer " +
+                        std::to_string(writerRank) +
+                        ", in call to PerformGets\n");
+                }
+                if (!insitumpi::IsSubarrayDatatypeBox(sfi.BlockBox) ||
+                    !insitumpi::IsSubarrayDatatypeBox(selectionBox))
+                {
+                    throw std::invalid_argument(
+                        "ERROR: InSituMPI RMA mode does not support blocks "
+                        "or selections of " +
+                        variable.m_Name +
+                        " with dimensions beyond int, in call to "
+                        "PerformGets\n");
+                }
+
+                if (m_Verbosity == 5)
+                {
+                    std::cout << "InSituMPI Reader " << m_ReaderRank
+                              << " get var = " << variable.m_Name
+                              << " from writer " << writerRank;
+                    std::cout << " info = ";
+                    insitumpi::PrintSubFileInfo(sfi);
+                    std::cout << std::endl;
+                }
+
+                const size_t intersectionSize =
+                    helper::GetTotalSize(
+                        helper::StartCountBox(sfi.IntersectionBox.first,
+                                              sfi.IntersectionBox.second)
+                            .second) *
+                    sizeof(T);
+                // MPI_CHAR counts are int, larger contiguous pieces are
+                // transferred with a subarray datatype as well
+                const bool isIntCount =
+                    intersectionSize <=
+                    static_cast<size_t>(std::numeric_limits<int>::max());
+
+                // origin: contiguous piece or subarray of the user data
+                char *origin = reinterpret_cast<char *>(
+                    const_cast<T *>(variable.GetData()));
+                int originCount = 1;
+                MPI_Datatype originType = MPI_DATATYPE_NULL;
+                size_t elementOffset;
+                if (isIntCount &&
+                    helper::IsIntersectionContiguousSubarray(
+                        selectionBox, sfi.IntersectionBox, isRowMajor,
+                        elementOffset))
+                {
+                    origin += elementOffset * sizeof(T);
+                    originCount = static_cast<int>(intersectionSize);
+                    originType = MPI_CHAR;
+                }
+                else
+                {
+                    originType = insitumpi::CreateSubarrayDatatype(
+                        selectionBox, sfi.IntersectionBox, sizeof(T),
+                        isRowMajor);
+                }
+
+                // target: contiguous piece or subarray of the writer block
+                MPI_Aint targetAddress = itBlock->Address;
+                int targetCount = 1;
+                MPI_Datatype targetType = MPI_DATATYPE_NULL;
+                if (isIntCount &&
+                    helper::IsIntersectionContiguousSubarray(
+                        sfi.BlockBox, sfi.IntersectionBox, isRowMajor,
+                        elementOffset))
+                {
+                    targetAddress += elementOffset * sizeof(T);
+                    targetCount = static_cast<int>(intersectionSize);
+                    targetType = MPI_CHAR;
+                }
+                else
+                {
+                    targetType = insitumpi::CreateSubarrayDatatype(
+                        sfi.BlockBox, sfi.IntersectionBox, sizeof(T),
+                        isRowMajor);
+                }
+
+                MPI_Get(origin, originCount, originType,
+                        static_cast<int>(writerRank), targetAddress,
+                        targetCount, targetType, m_Window);
+
+                // freed when the get completes
+                if (originType != MPI_CHAR)
+                {
+                    MPI_Type_free(&originType);
+                }
+                if (targetType != MPI_CHAR)
+                {
+                    MPI_Type_free(&targetType);
                 }
+                m_BytesReceivedInPlace += intersectionSize;
             }
             break; // there is only one step here
         }
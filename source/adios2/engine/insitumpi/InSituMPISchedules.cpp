@@ -16,6 +16,7 @@
 #include "adios2/helper/adiosMemory.h"
 
 #include <iostream>
+#include <limits> //std::numeric_limits
 
 namespace adios2
 {
@@ -254,6 +255,107 @@ Box<size_t> DeserializeBoxSizet(const std::vector<char> &buffer,
     return Box<size_t>(first, second);
 }
 
+void SerializeBlockAddresses(std::vector<char> &buffer,
+                             const BlockAddressMap &map) noexcept
+{
+    const int nVars = map.size();
+    helper::InsertToBuffer(buffer, &nVars, 1);
+    for (const auto &variableNamePair : map)
+    {
+        const std::string &varName = variableNamePair.first;
+        const int nameLen = varName.size();
+        helper::InsertToBuffer(buffer, &nameLen, 1);
+        helper::InsertToBuffer(buffer, varName.data(), nameLen);
+        const int nBlocks = variableNamePair.second.size();
+        helper::InsertToBuffer(buffer, &nBlocks, 1);
+        for (const auto &blockAddress : variableNamePair.second)
+        {
+            SerializeBox(buffer, blockAddress.BlockBox);
+            helper::InsertToBuffer(buffer, &blockAddress.Address, 1);
+        }
+    }
+}
+
+BlockAddressMap DeserializeBlockAddresses(const std::vector<char> &buffer,
+                                          size_t &position) noexcept
+{
+    BlockAddressMap map;
+    int nVars = helper::ReadValue<int>(buffer, position);
+    for (int i = 0; i < nVars; i++)
+    {
+        int nameLen = helper::ReadValue<int>(buffer, position);
+        std::string name(nameLen, '\0');
+        helper::CopyFromBuffer(buffer, position, &name[0], nameLen);
+        int nBlocks = helper::ReadValue<int>(buffer, position);
+        std::vector<BlockAddress> &blockAddresses = map[name];
+        blockAddresses.reserve(nBlocks);
+        for (int j = 0; j < nBlocks; j++)
+        {
+            BlockAddress blockAddress;
+            blockAddress.BlockBox = DeserializeBoxDims(buffer, position);
+            helper::CopyFromBuffer(buffer, position, &blockAddress.Address, 1);
+            blockAddresses.push_back(blockAddress);
+        }
+    }
+    return map;
+}
+
+Box<Dims> WriterBlockBox(const Dims &start, const Dims &count) noexcept
+{
+    return helper::StartEndBox(start, count, false);
+}
+
+bool IsSubarrayDatatypeBox(const Box<Dims> &box) noexcept
+{
+    const size_t maxInt =
+        static_cast<size_t>(std::numeric_limits<int>::max());
+    if (box.first.empty() || box.first.size() > maxInt)
+    {
+        return false;
+    }
+    for (size_t d = 0; d < box.first.size(); ++d)
+    {
+        if (box.second[d] < box.first[d] ||
+            box.second[d] - box.first[d] >= maxInt)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+MPI_Datatype CreateSubarrayDatatype(const Box<Dims> &containerBox,
+                                    const Box<Dims> &selectionBox,
+                                    const size_t elementSize,
+                                    const bool isRowMajor) noexcept
+{
+    const size_t nDims = containerBox.first.size();
+    std::vector<int> sizes(nDims);
+    std::vector<int> subsizes(nDims);
+    std::vector<int> starts(nDims);
+    for (size_t d = 0; d < nDims; ++d)
+    {
+        sizes[d] = static_cast<int>(containerBox.second[d] -
+                                    containerBox.first[d] + 1);
+        subsizes[d] = static_cast<int>(selectionBox.second[d] -
+                                       selectionBox.first[d] + 1);
+        starts[d] =
+            static_cast<int>(selectionBox.first[d] - containerBox.first[d]);
+    }
+
+    MPI_Datatype elementType;
+    MPI_Type_contiguous(static_cast<int>(elementSize), MPI_CHAR, &elementType);
+
+    MPI_Datatype subarrayType;
+    MPI_Type_create_subarray(static_cast<int>(nDims), sizes.data(),
+                             subsizes.data(), starts.data(),
+                             isRowMajor ? MPI_ORDER_C : MPI_ORDER_FORTRAN,
+                             elementType, &subarrayType);
+    MPI_Type_commit(&subarrayType);
+    MPI_Type_free(&elementType);
+    return subarrayType;
+}
+
 void PrintReadScheduleMap(const WriteScheduleMap &map) noexcept
 {
     // <variableName, <reader, <SubFileInfo>>>
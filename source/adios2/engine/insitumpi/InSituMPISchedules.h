@@ -15,6 +15,8 @@
 
 #include "adios2/helper/adiosType.h"
 
+#include <mpi.h>
+
 #include <map>
 #include <vector>
 
@@ -104,6 +106,50 @@ Box<Dims> DeserializeBoxDims(const std::vector<char> &buffer,
 Box<size_t> DeserializeBoxSizet(const std::vector<char> &buffer,
                                 size_t &position) noexcept;
 
+// Box of a writer's Put block in the writer's dimension order, as stored in
+// the BP3 metadata. SubFileInfo::BlockBox is built from that metadata without
+// m_ReverseDimensions, so writers compare and publish this box against it;
+// only the reader's selection is reversed into this order.
+Box<Dims> WriterBlockBox(const Dims &start, const Dims &count) noexcept;
+
+// Address of one Put block of a writer in the RMA window
+struct BlockAddress
+{
+    Box<Dims> BlockBox;
+    MPI_Aint Address;
+};
+
+// One writer's blocks in the RMA window for all variables of a step
+using BlockAddressMap = std::map<std::string, std::vector<BlockAddress>>;
+
+// Serialize one writer's block addresses
+//     int N   : number of variables
+//     for each variable
+//         int L   : length of variable name (without 0)
+//         char[L] : variable name
+//         int M   : number of blocks
+//         for each block
+//             serialize BlockBox, MPI_Aint Address
+void SerializeBlockAddresses(std::vector<char> &buffer,
+                             const BlockAddressMap &map) noexcept;
+
+BlockAddressMap DeserializeBlockAddresses(const std::vector<char> &buffer,
+                                          size_t &position) noexcept;
+
+// True if every dimension of the box fits in the int arguments of
+// MPI_Type_create_subarray
+bool IsSubarrayDatatypeBox(const Box<Dims> &box) noexcept;
+
+// Create and commit a datatype selecting selectionBox inside containerBox
+// (both are start-end boxes in the same dimension order) of elementSize byte
+// elements, so non-contiguous selections are sent and received in place.
+// The signature is elements * elementSize MPI_CHARs, matching a contiguous
+// MPI_CHAR transfer of the same selection. Free it with MPI_Type_free.
+MPI_Datatype CreateSubarrayDatatype(const Box<Dims> &containerBox,
+                                    const Box<Dims> &selectionBox,
+                                    const size_t elementSize,
+                                    const bool isRowMajor) noexcept;
+
 void PrintReadScheduleMap(const WriteScheduleMap &map) noexcept;
 void PrintSubFileInfo(const helper::SubFileInfo &sfi) noexcept;
 void PrintBox(const Box<Dims> &box) noexcept;
@@ -18,7 +18,9 @@
 #include "InSituMPIWriter.h"
 #include "InSituMPIWriter.tcc"
 
+#include <algorithm> //std::min, std::max
 #include <iostream>
+#include <iterator> //std::prev
 
 namespace adios2
 {
@@ -35,6 +37,7 @@ InSituMPIWriter::InSituMPIWriter(IO &io, const std::string &name,
     m_EndMessage = " in call to InSituMPIWriter " + m_Name + " Open\n";
     Init();
     m_BP3Serializer.InitParameters(m_IO.m_Parameters);
+    m_BP3Serializer.m_ThreadPool = m_IO.m_ThreadPool;
 
     m_RankAllPeers = insitumpi::FindPeers(mpiComm, m_Name, true, m_CommWorld);
     MPI_Comm_rank(m_CommWorld, &m_GlobalRank);
@@ -53,7 +56,13 @@ InSituMPIWriter::InSituMPIWriter(IO &io, const std::string &name,
     }
     insitumpi::ConnectDirectPeers(m_CommWorld, true,
                                   (m_BP3Serializer.m_RankMPI == 0),
-                                  m_GlobalRank, m_RankDirectPeers);
+                                  m_GlobalRank, m_RankDirectPeers, m_RMA);
+    if (m_RMA)
+    {
+        m_RMAComm = insitumpi::CreateRMAComm(mpiComm, m_CommWorld, true,
+                                             m_RankAllPeers);
+        MPI_Win_create_dynamic(MPI_INFO_NULL, m_RMAComm, &m_Window);
+    }
 }
 
 InSituMPIWriter::~InSituMPIWriter() {}
@@ -156,7 +165,7 @@ void InSituMPIWriter::PerformPuts()
                           << " sends metadata to Reader World rank = "
                           << m_RankDirectPeers[0] << std::endl;
             }
-            MPI_Request request;
+            MPI_Request request[2];
             // for (auto peerRank : m_RankDirectPeers)
             int peerRank = m_RankDirectPeers[0];
             // send fix schedule info, then length of metadata array,
@@ -164,10 +173,16 @@ void InSituMPIWriter::PerformPuts()
 
             MPI_Isend(&mdLen, 1, MPI_UNSIGNED_LONG, peerRank,
                       insitumpi::MpiTags::MetadataLength, m_CommWorld,
-                      &request);
+                      &request[0]);
             MPI_Isend(m_BP3Serializer.m_Metadata.m_Buffer.data(), mdLen,
                       MPI_CHAR, peerRank, insitumpi::MpiTags::Metadata,
-                      m_CommWorld, &request);
+                      m_CommWorld, &request[1]);
+            if (m_RMA)
+            {
+                // no read schedules to wait for, the metadata buffer is
+                // reset at the end of PerformPuts
+                MPI_Waitall(2, request, MPI_STATUSES_IGNORE);
+            }
         }
     }
 
@@ -206,7 +221,7 @@ void InSituMPIWriter::PerformPuts()
         }
     }
 
-    if (m_CurrentStep == 0 || !m_FixedRemoteSchedule)
+    if (!m_RMA && (m_CurrentStep == 0 || !m_FixedRemoteSchedule))
     {
         // Collect the read requests from ALL readers
         // FIXME: How do we make this Irecv from all readers
@@ -259,6 +274,12 @@ void InSituMPIWriter::PerformPuts()
         AsyncSendVariable(variableName);
     }
 
+    if (m_RMA)
+    {
+        // readers MPI_Get the blocks, nothing to send from here
+        SendBlockAddresses();
+    }
+
     m_BP3Serializer.m_DeferredVariables.clear();
     if (!m_FixedRemoteSchedule)
     {
@@ -290,7 +311,14 @@ void InSituMPIWriter::AsyncSendVariable(std::string variableName)
         for (const auto &blockInfoPair : blocksInfo)                           \
         {                                                                      \
             const auto &blockInfo = blockInfoPair.second;                      \
-            AsyncSendVariable<T>(*variable, blockInfo);                        \
+            if (m_RMA)                                                         \
+            {                                                                  \
+                ExposeVariable<T>(*variable, blockInfo);                       \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                AsyncSendVariable<T>(*variable, blockInfo);                    \
+            }                                                                  \
         }                                                                      \
         variable->m_StepBlocksInfo.erase(m_CurrentStep);                       \
     }
@@ -299,6 +327,94 @@ void InSituMPIWriter::AsyncSendVariable(std::string variableName)
 #undef declare_template_instantiation
 }
 
+void InSituMPIWriter::SendBlockAddresses()
+{
+    std::vector<char> buffer;
+    insitumpi::SerializeBlockAddresses(buffer, m_BlockAddresses);
+    m_BlockAddresses.clear();
+
+    // writer root collects the buffers in writer rank order
+    const int length = buffer.size();
+    std::vector<int> lengths(m_WriterNproc);
+    MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, m_MPIComm);
+
+    std::vector<int> displacements(m_WriterNproc);
+    std::vector<char> addresses;
+    if (m_BP3Serializer.m_RankMPI == 0)
+    {
+        helper::InsertToBuffer(addresses, &m_WriterNproc, 1);
+        const size_t header = addresses.size();
+        int total = 0;
+        for (int i = 0; i < m_WriterNproc; i++)
+        {
+            displacements[i] = header + total;
+            total += lengths[i];
+        }
+        addresses.resize(header + total);
+    }
+    MPI_Gatherv(buffer.data(), length, MPI_CHAR, addresses.data(),
+                lengths.data(), displacements.data(), MPI_CHAR, 0, m_MPIComm);
+
+    if (m_BP3Serializer.m_RankMPI == 0)
+    {
+        unsigned long addressesLen = addresses.size();
+        int peerRank = m_RankDirectPeers[0];
+        MPI_Send(&addressesLen, 1, MPI_UNSIGNED_LONG, peerRank,
+                 insitumpi::MpiTags::BlockAddressesLength, m_CommWorld);
+        MPI_Send(addresses.data(), addressesLen, MPI_CHAR, peerRank,
+                 insitumpi::MpiTags::BlockAddresses, m_CommWorld);
+        if (m_Verbosity == 5)
+        {
+            std::cout << "InSituMPI Writer " << m_WriterRank
+                      << " sent block addresses of size = " << addressesLen
+                      << " to Reader World rank = " << peerRank << std::endl;
+        }
+    }
+}
+
+void InSituMPIWriter::AttachBuffer(char *buffer, const size_t size)
+{
+    const char *begin = buffer;
+    const char *end = buffer + size;
+
+    // first region that may overlap: the last one starting at or before begin
+    auto it = m_AttachedBuffers.upper_bound(begin);
+    if (it != m_AttachedBuffers.begin())
+    {
+        auto itPrevious = std::prev(it);
+        if (itPrevious->first + itPrevious->second >= end)
+        {
+            return; // the same buffer may back several Puts
+        }
+        if (itPrevious->first + itPrevious->second > begin)
+        {
+            it = itPrevious;
+        }
+    }
+
+    while (it != m_AttachedBuffers.end() && it->first < end)
+    {
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->first + it->second);
+        MPI_Win_detach(m_Window, it->first);
+        it = m_AttachedBuffers.erase(it);
+    }
+
+    const size_t attachSize = static_cast<size_t>(end - begin);
+    MPI_Win_attach(m_Window, const_cast<char *>(begin),
+                   static_cast<MPI_Aint>(attachSize));
+    m_AttachedBuffers[begin] = attachSize;
+}
+
+void InSituMPIWriter::DetachBuffers()
+{
+    for (const auto &bufferPair : m_AttachedBuffers)
+    {
+        MPI_Win_detach(m_Window, bufferPair.first);
+    }
+    m_AttachedBuffers.clear();
+}
+
 void InSituMPIWriter::EndStep()
 {
     if (m_Verbosity == 5)
@@ -350,6 +466,12 @@ void InSituMPIWriter::EndStep()
     }
     MPI_Bcast(&dummy, 1, MPI_INT, 0, m_MPIComm);
 
+    if (m_RMA)
+    {
+        // readers completed their MPI_Get calls before acknowledging
+        DetachBuffers();
+    }
+
     if (m_Verbosity == 5)
     {
         std::cout << "InSituMPI Writer " << m_WriterRank
@@ -382,6 +504,12 @@ void InSituMPIWriter::Init()
 
 void InSituMPIWriter::InitParameters()
 {
+    auto itRMA = m_IO.m_Parameters.find("RMA");
+    if (itRMA != m_IO.m_Parameters.end())
+    {
+        m_RMA = (itRMA->second == "true");
+    }
+
     auto itVerbosity = m_IO.m_Parameters.find("verbose");
     if (itVerbosity != m_IO.m_Parameters.end())
     {
@@ -417,6 +545,13 @@ void InSituMPIWriter::DoClose(const int transportIndex)
         MPI_Isend(&m_CurrentStep, 1, MPI_INT, peerRank,
                   insitumpi::MpiTags::Step, m_CommWorld, &request);
     }
+
+    if (m_RMA)
+    {
+        // collective with the readers' Close
+        MPI_Win_free(&m_Window);
+        MPI_Comm_free(&m_RMAComm);
+    }
 }
 
 } // end namespace engine
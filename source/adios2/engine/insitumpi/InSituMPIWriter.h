@@ -74,6 +74,18 @@ private:
 
     std::vector<MPI_Request> m_MPIRequests; // for MPI_Waitall in EndStep()
 
+    /** RMA parameter: expose the Put buffers in m_Window and let the readers
+     * MPI_Get their selections, no read schedules are exchanged */
+    bool m_RMA = false;
+    MPI_Comm m_RMAComm = MPI_COMM_NULL; // writers then readers
+    MPI_Win m_Window = MPI_WIN_NULL;    // dynamic, buffers attached per step
+
+    /** disjoint regions attached to m_Window in this step, start -> size */
+    std::map<const char *, size_t> m_AttachedBuffers;
+
+    /** this step's blocks in m_Window, sent to the readers in PerformPuts */
+    insitumpi::BlockAddressMap m_BlockAddresses;
+
     void Init() final;
     void InitParameters() final;
     void InitTransports() final;
@@ -113,6 +125,23 @@ private:
                            const typename Variable<T>::Info &blockInfo);
 
     void AsyncSendVariable(std::string variableName);
+
+    /** Attach a Put block to m_Window and record its address (RMA mode) */
+    template <class T>
+    void ExposeVariable(Variable<T> &variable,
+                        const typename Variable<T>::Info &blockInfo);
+
+    /** Attach [buffer, buffer + size) to m_Window once, merged with the
+     * regions it overlaps since MPI doesn't allow overlapping ones (RMA mode)
+     */
+    void AttachBuffer(char *buffer, const size_t size);
+
+    /** Gather all writers' block addresses to the writer root, which sends
+     * them to the reader root (RMA mode) */
+    void SendBlockAddresses();
+
+    /** Detach this step's buffers once the readers completed (RMA mode) */
+    void DetachBuffers();
 };
 
 } // end namespace engine
@@ -88,7 +88,7 @@ void InSituMPIWriter::PutDeferredCommon(Variable<T> &variable, const T *values)
     // function call
     m_BP3Serializer.PutVariableMetadata(variable, blockInfo);
 
-    if (m_FixedLocalSchedule && m_FixedRemoteSchedule)
+    if (!m_RMA && m_FixedLocalSchedule && m_FixedRemoteSchedule)
     {
         // Create the async send for the variable now
         AsyncSendVariable(variable, blockInfo);
@@ -109,8 +109,8 @@ void InSituMPIWriter::AsyncSendVariable(
     {
         std::map<size_t, std::vector<helper::SubFileInfo>> requests =
             it->second;
-        Box<Dims> mybox =
-            helper::StartEndBox(variable.m_Start, variable.m_Count);
+        const Box<Dims> mybox =
+            insitumpi::WriterBlockBox(variable.m_Start, variable.m_Count);
         for (const auto &readerPair : requests)
         {
             for (const auto &sfi : readerPair.second)
@@ -132,6 +132,26 @@ void InSituMPIWriter::AsyncSendVariable(
                     m_MPIRequests.emplace_back();
                     const int index = m_MPIRequests.size() - 1;
 
+                    size_t dummy;
+                    if (!helper::IsIntersectionContiguousSubarray(
+                            sfi.BlockBox, sfi.IntersectionBox,
+                            m_BP3Serializer.m_IsRowMajor, dummy) &&
+                        insitumpi::IsSubarrayDatatypeBox(sfi.BlockBox))
+                    {
+                        // send only the strided selection, no packing here
+                        MPI_Datatype datatype =
+                            insitumpi::CreateSubarrayDatatype(
+                                sfi.BlockBox, sfi.IntersectionBox, sizeof(T),
+                                m_BP3Serializer.m_IsRowMajor);
+                        MPI_Isend(blockInfo.Data, 1, datatype,
+                                  m_RankAllPeers[readerPair.first],
+                                  insitumpi::MpiTags::Data, m_CommWorld,
+                                  m_MPIRequests.data() + index);
+                        // freed when the send completes
+                        MPI_Type_free(&datatype);
+                        continue;
+                    }
+
                     const auto &seek = sfi.Seeks;
                     const size_t blockStart = seek.first;
                     const size_t blockSize = seek.second - seek.first;
@@ -146,6 +166,33 @@ void InSituMPIWriter::AsyncSendVariable(
     }
 }
 
+template <class T>
+void InSituMPIWriter::ExposeVariable(
+    Variable<T> &variable, const typename Variable<T>::Info &blockInfo)
+{
+    const size_t size = helper::GetTotalSize(blockInfo.Count) * sizeof(T);
+    char *buffer = reinterpret_cast<char *>(const_cast<T *>(blockInfo.Data));
+
+    if (size > 0)
+    {
+        AttachBuffer(buffer, size);
+    }
+
+    insitumpi::BlockAddress blockAddress;
+    blockAddress.BlockBox =
+        insitumpi::WriterBlockBox(blockInfo.Start, blockInfo.Count);
+    MPI_Get_address(buffer, &blockAddress.Address);
+    m_BlockAddresses[variable.m_Name].push_back(blockAddress);
+
+    if (m_Verbosity == 5)
+    {
+        std::cout << "InSituMPI Writer " << m_WriterRank
+                  << " exposed var = " << variable.m_Name << " block=";
+        insitumpi::PrintBox(blockAddress.BlockBox);
+        std::cout << " size = " << size << std::endl;
+    }
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
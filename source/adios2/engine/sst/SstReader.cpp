@@ -171,6 +171,7 @@ StepStatus SstReader::BeginStep(StepMode mode, const float timeout_sec)
 
         m_BP3Deserializer = new format::BP3Deserializer(m_MPIComm, m_DebugMode);
         m_BP3Deserializer->InitParameters(m_IO.m_Parameters);
+        m_BP3Deserializer->m_ThreadPool = m_IO.m_ThreadPool;
 
         m_BP3Deserializer->m_Metadata.Resize(
             (*m_CurrentStepMetaData->WriterMetadata)->DataSize,
@@ -51,6 +51,8 @@ StepStatus SstWriter::BeginStep(StepMode mode, const float timeout_sec)
         // SstWriter::EndStep()::lf_FreeBlocks()
         m_BP3Serializer = new format::BP3Serializer(m_MPIComm, m_DebugMode);
         m_BP3Serializer->InitParameters(m_IO.m_Parameters);
+        m_BP3Serializer->m_ThreadPool = m_IO.m_ThreadPool;
+        m_BP3Serializer->m_FuseMinMax = true;
     }
     else
     {
@@ -14,7 +14,7 @@
 #include <cmath>
 #include <functional> //std::minus<T>
 #include <iterator>   //std::back_inserter
-#include <numeric>    //std::accumulate
+#include <numeric>    //std::accumulate, std::iota
 #include <utility>    //std::pair
 
 #include "adios2/helper/adiosString.h" //DimsToString
@@ -264,5 +264,140 @@ size_t LinearIndex(const Box<Dims> &localBox, const Dims &point,
     return linearIndex;
 }
 
+namespace
+{
+
+bool BoxesIntersect(const Box<Dims> &box1, const Box<Dims> &box2) noexcept
+{
+    const size_t dimensionsSize = box1.first.size();
+    for (size_t d = 0; d < dimensionsSize; ++d)
+    {
+        if (box2.first[d] > box1.second[d] || box2.second[d] < box1.first[d] ||
+            box1.first[d] > box1.second[d] || box2.first[d] > box2.second[d])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // end empty namespace
+
+BoxIndex::BoxIndex(std::vector<Box<Dims>> boxes) : m_Boxes(std::move(boxes))
+{
+    m_Order.resize(m_Boxes.size());
+    std::iota(m_Order.begin(), m_Order.end(), 0);
+
+    if (!m_Boxes.empty())
+    {
+        m_Nodes.reserve(2 * (m_Boxes.size() / m_LeafSize + 1));
+        Build(0, m_Boxes.size());
+    }
+}
+
+std::vector<size_t> BoxIndex::Intersecting(const Box<Dims> &selection) const
+{
+    std::vector<size_t> positions;
+    if (m_Nodes.empty())
+    {
+        return positions;
+    }
+
+    std::vector<size_t> stack(1, 0);
+    while (!stack.empty())
+    {
+        const Node &node = m_Nodes[stack.back()];
+        stack.pop_back();
+
+        if (!BoxesIntersect(node.Bounds, selection))
+        {
+            continue;
+        }
+
+        if (node.Left == 0)
+        {
+            for (size_t i = node.Begin; i < node.End; ++i)
+            {
+                if (BoxesIntersect(m_Boxes[m_Order[i]], selection))
+                {
+                    positions.push_back(m_Order[i]);
+                }
+            }
+            continue;
+        }
+
+        stack.push_back(node.Right);
+        stack.push_back(node.Left);
+    }
+
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+const Box<Dims> &BoxIndex::GetBox(const size_t position) const noexcept
+{
+    return m_Boxes[position];
+}
+
+size_t BoxIndex::Size() const noexcept { return m_Boxes.size(); }
+
+size_t BoxIndex::Build(const size_t begin, const size_t end)
+{
+    const size_t nodeIndex = m_Nodes.size();
+    m_Nodes.emplace_back();
+
+    Box<Dims> bounds = m_Boxes[m_Order[begin]];
+    const size_t dimensionsSize = bounds.first.size();
+    for (size_t i = begin + 1; i < end; ++i)
+    {
+        const Box<Dims> &box = m_Boxes[m_Order[i]];
+        for (size_t d = 0; d < dimensionsSize; ++d)
+        {
+            bounds.first[d] = std::min(bounds.first[d], box.first[d]);
+            bounds.second[d] = std::max(bounds.second[d], box.second[d]);
+        }
+    }
+
+    if (end - begin <= m_LeafSize)
+    {
+        Node &node = m_Nodes[nodeIndex];
+        node.Bounds = std::move(bounds);
+        node.Begin = begin;
+        node.End = end;
+        return nodeIndex;
+    }
+
+    // split at the median of box starts along the widest dimension
+    size_t splitDimension = 0;
+    size_t widest = 0;
+    for (size_t d = 0; d < dimensionsSize; ++d)
+    {
+        const size_t width = bounds.second[d] - bounds.first[d];
+        if (width > widest)
+        {
+            widest = width;
+            splitDimension = d;
+        }
+    }
+
+    const size_t middle = begin + (end - begin) / 2;
+    std::nth_element(m_Order.begin() + begin, m_Order.begin() + middle,
+                     m_Order.begin() + end,
+                     [&](const size_t a, const size_t b) {
+                         return m_Boxes[a].first[splitDimension] <
+                                m_Boxes[b].first[splitDimension];
+                     });
+
+    const size_t left = Build(begin, middle);
+    const size_t right = Build(middle, end);
+
+    // m_Nodes might have been reallocated by recursive calls
+    Node &node = m_Nodes[nodeIndex];
+    node.Bounds = std::move(bounds);
+    node.Left = left;
+    node.Right = right;
+    return nodeIndex;
+}
+
 } // end namespace helper
 } // end namespace adios2
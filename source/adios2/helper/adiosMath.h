@@ -16,6 +16,7 @@
 /// \endcond
 
 #include "adios2/ADIOSTypes.h"
+#include "adios2/helper/adiosThreadPool.h"
 
 namespace adios2
 {
@@ -62,10 +63,13 @@ void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
  * @param min of values
  * @param max of values
  * @param threads used for parallel computation
+ * @param threadPool runs the threads if not nullptr, from core::ADIOS
+ * @exception rethrows the first exception of a thread, see RunTasks
  */
 template <class T>
 void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
-                      const unsigned int threads = 1) noexcept;
+                      const unsigned int threads = 1,
+                      ThreadPool *threadPool = nullptr);
 
 /**
  * Overloaded version of GetMinMaxThreads for complex types
@@ -74,10 +78,14 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
  * @param min of values
  * @param max of values
  * @param threads used for parallel computation
+ * @param threadPool runs the threads if not nullptr, from core::ADIOS
+ * @exception rethrows the first exception of a thread, see RunTasks
  */
 template <class T>
-void GetMinMaxThreads(const std::complex<T> *values, const size_t size, T &min,
-                      T &max, const unsigned int threads = 1) noexcept;
+void GetMinMaxThreads(const std::complex<T> *values, const size_t size,
+                      std::complex<T> &min, std::complex<T> &max,
+                      const unsigned int threads = 1,
+                      ThreadPool *threadPool = nullptr);
 
 /**
  * Check if index is within (inclusive) limits
@@ -182,6 +190,65 @@ bool LessThan(const T input1, const T input2) noexcept;
 template <class T>
 bool GreaterThan(const T input1, const T input2) noexcept;
 
+/**
+ * Static bounding volume hierarchy (R-tree bulk loaded by median splits)
+ * over {start, end} boxes with inclusive end, as returned by StartEndBox.
+ * Built once per variable and step, then queried for each selection in
+ * O(log(boxes) + intersecting boxes) instead of testing every box.
+ * Boxes with an end below their start, e.g. StartEndBox of a zero count,
+ * are empty and never intersect.
+ */
+class BoxIndex
+{
+
+public:
+    BoxIndex() = default;
+
+    /**
+     * Builds the index
+     * @param boxes {start, end} inclusive, all with the same dimensions
+     */
+    explicit BoxIndex(std::vector<Box<Dims>> boxes);
+
+    ~BoxIndex() = default;
+
+    /**
+     * Positions in the constructor boxes of all boxes intersecting selection
+     * @param selection {start, end} inclusive
+     * @return ascending positions, empty if none intersects
+     */
+    std::vector<size_t> Intersecting(const Box<Dims> &selection) const;
+
+    /** @return box at position in the constructor boxes */
+    const Box<Dims> &GetBox(const size_t position) const noexcept;
+
+    /** @return number of indexed boxes */
+    size_t Size() const noexcept;
+
+private:
+    /** boxes are never split, leaves hold at most this many */
+    static constexpr size_t m_LeafSize = 16;
+
+    struct Node
+    {
+        /** bounds of all boxes under this node */
+        Box<Dims> Bounds;
+        /** range in m_Order for leaves */
+        size_t Begin = 0;
+        size_t End = 0;
+        /** children in m_Nodes, 0 for leaves (root is never a child) */
+        size_t Left = 0;
+        size_t Right = 0;
+    };
+
+    std::vector<Box<Dims>> m_Boxes;
+    /** positions in m_Boxes, grouped by leaf */
+    std::vector<size_t> m_Order;
+    std::vector<Node> m_Nodes;
+
+    size_t Build(const size_t begin, const size_t end);
+};
+
 } // end namespace helper
 } // end namespace adios2
 
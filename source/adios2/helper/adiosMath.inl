@@ -14,8 +14,11 @@
 #error "Inline file should only be included from it's header, never on it's own"
 #endif
 
-#include <algorithm> //std::minmax_element, std::min_element, std::max_element
-#include <thread>
+#include <algorithm> //std::min_element, std::max_element
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "adios2/ADIOSMacros.h"
 
@@ -27,20 +30,170 @@ namespace helper
 template <class T>
 void GetMinMax(const T *values, const size_t size, T &min, T &max) noexcept
 {
-    auto bounds = std::minmax_element(values, values + size);
-    min = *bounds.first;
-    max = *bounds.second;
+    if (size == 0)
+    {
+        return;
+    }
+
+    // independent accumulators over 64 bytes, vectorized by the compiler
+    constexpr size_t lanes = (64 / sizeof(T) > 0) ? 64 / sizeof(T) : 1;
+    T mins[lanes];
+    T maxs[lanes];
+    for (size_t l = 0; l < lanes; ++l)
+    {
+        mins[l] = values[0];
+        maxs[l] = values[0];
+    }
+
+    size_t i = 0;
+    for (; i + lanes <= size; i += lanes)
+    {
+        for (size_t l = 0; l < lanes; ++l)
+        {
+            const T value = values[i + l];
+            mins[l] = (value < mins[l]) ? value : mins[l];
+            maxs[l] = (maxs[l] < value) ? value : maxs[l];
+        }
+    }
+
+    T minValue = mins[0];
+    T maxValue = maxs[0];
+    for (size_t l = 1; l < lanes; ++l)
+    {
+        minValue = (mins[l] < minValue) ? mins[l] : minValue;
+        maxValue = (maxValue < maxs[l]) ? maxs[l] : maxValue;
+    }
+
+    for (; i < size; ++i)
+    {
+        minValue = (values[i] < minValue) ? values[i] : minValue;
+        maxValue = (maxValue < values[i]) ? values[i] : maxValue;
+    }
+
+    min = minValue;
+    max = maxValue;
+}
+
+#ifdef __SSE2__
+// compilers don't vectorize floating point min/max reductions without
+// -ffast-math, minps/minpd keep the scalar NaN semantics above
+template <>
+inline void GetMinMax<float>(const float *values, const size_t size,
+                             float &min, float &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    __m128 mins0 = _mm_set1_ps(values[0]);
+    __m128 maxs0 = mins0;
+    __m128 mins1 = mins0;
+    __m128 maxs1 = mins0;
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m128 values0 = _mm_loadu_ps(values + i);
+        const __m128 values1 = _mm_loadu_ps(values + i + 4);
+        mins0 = _mm_min_ps(values0, mins0);
+        maxs0 = _mm_max_ps(values0, maxs0);
+        mins1 = _mm_min_ps(values1, mins1);
+        maxs1 = _mm_max_ps(values1, maxs1);
+    }
+
+    float mins[8];
+    float maxs[8];
+    _mm_storeu_ps(mins, mins0);
+    _mm_storeu_ps(mins + 4, mins1);
+    _mm_storeu_ps(maxs, maxs0);
+    _mm_storeu_ps(maxs + 4, maxs1);
+
+    float minValue = mins[0];
+    float maxValue = maxs[0];
+    for (size_t l = 1; l < 8; ++l)
+    {
+        minValue = (mins[l] < minValue) ? mins[l] : minValue;
+        maxValue = (maxValue < maxs[l]) ? maxs[l] : maxValue;
+    }
+
+    for (; i < size; ++i)
+    {
+        minValue = (values[i] < minValue) ? values[i] : minValue;
+        maxValue = (maxValue < values[i]) ? values[i] : maxValue;
+    }
+
+    min = minValue;
+    max = maxValue;
+}
+
+template <>
+inline void GetMinMax<double>(const double *values, const size_t size,
+                              double &min, double &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    __m128d mins0 = _mm_set1_pd(values[0]);
+    __m128d maxs0 = mins0;
+    __m128d mins1 = mins0;
+    __m128d maxs1 = mins0;
+
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128d values0 = _mm_loadu_pd(values + i);
+        const __m128d values1 = _mm_loadu_pd(values + i + 2);
+        mins0 = _mm_min_pd(values0, mins0);
+        maxs0 = _mm_max_pd(values0, maxs0);
+        mins1 = _mm_min_pd(values1, mins1);
+        maxs1 = _mm_max_pd(values1, maxs1);
+    }
+
+    double mins[4];
+    double maxs[4];
+    _mm_storeu_pd(mins, mins0);
+    _mm_storeu_pd(mins + 2, mins1);
+    _mm_storeu_pd(maxs, maxs0);
+    _mm_storeu_pd(maxs + 2, maxs1);
+
+    double minValue = mins[0];
+    double maxValue = maxs[0];
+    for (size_t l = 1; l < 4; ++l)
+    {
+        minValue = (mins[l] < minValue) ? mins[l] : minValue;
+        maxValue = (maxValue < maxs[l]) ? maxs[l] : maxValue;
+    }
+
+    for (; i < size; ++i)
+    {
+        minValue = (values[i] < minValue) ? values[i] : minValue;
+        maxValue = (maxValue < values[i]) ? values[i] : maxValue;
+    }
+
+    min = minValue;
+    max = maxValue;
 }
+#endif
 
 template <class T>
 void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
                       std::complex<T> &min, std::complex<T> &max) noexcept
 {
+    if (size == 0)
+    {
+        return;
+    }
+
+    min = values[0];
+    max = values[0];
 
     T minNorm = std::norm(values[0]);
     T maxNorm = minNorm;
 
-    for (auto i = 1; i < size; ++i)
+    for (size_t i = 1; i < size; ++i)
     {
         T norm = std::norm(values[i]);
 
@@ -61,7 +214,8 @@ void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
 
 template <class T>
 void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
-                      const unsigned int threads) noexcept
+                      const unsigned int threads,
+                      ThreadPool *threadPool)
 {
     if (threads == 1 || threads > size)
     {
@@ -76,31 +230,13 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
     std::vector<T> mins(threads); // zero init
     std::vector<T> maxs(threads); // zero init
 
-    std::vector<std::thread> getMinMaxThreads;
-    getMinMaxThreads.reserve(threads);
-
-    for (unsigned int t = 0; t < threads; ++t)
-    {
-        const size_t position = stride * t;
-
-        if (t == threads - 1)
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMax<T>, &values[position], last,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-        else
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMax<T>, &values[position], stride,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-    }
-
-    for (auto &getMinMaxThread : getMinMaxThreads)
-    {
-        getMinMaxThread.join();
-    }
+    RunTasks(threadPool, threads,
+             [&](const size_t t) {
+                 const size_t position = stride * t;
+                 const size_t elements = (t == threads - 1) ? last : stride;
+                 GetMinMax(&values[position], elements, mins[t], maxs[t]);
+             },
+             threads);
 
     auto itMin = std::min_element(mins.begin(), mins.end());
     min = *itMin;
@@ -112,9 +248,10 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
 template <class T>
 void GetMinMaxThreads(const std::complex<T> *values, const size_t size,
                       std::complex<T> &min, std::complex<T> &max,
-                      const unsigned int threads) noexcept
+                      const unsigned int threads,
+                      ThreadPool *threadPool)
 {
-    if (threads == 1)
+    if (threads == 1 || threads > size)
     {
         GetMinMaxComplex(values, size, min, max);
         return;
@@ -127,31 +264,14 @@ void GetMinMaxThreads(const std::complex<T> *values, const size_t size,
     std::vector<std::complex<T>> mins(threads); // zero init
     std::vector<std::complex<T>> maxs(threads); // zero init
 
-    std::vector<std::thread> getMinMaxThreads;
-    getMinMaxThreads.reserve(threads);
-
-    for (unsigned int t = 0; t < threads; ++t)
-    {
-        const size_t position = stride * t;
-
-        if (t == threads - 1)
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMaxComplex<T>, &values[position], last,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-        else
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMaxComplex<T>, &values[position], stride,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-    }
-
-    for (auto &getMinMaxThread : getMinMaxThreads)
-    {
-        getMinMaxThread.join();
-    }
+    RunTasks(threadPool, threads,
+             [&](const size_t t) {
+                 const size_t position = stride * t;
+                 const size_t elements = (t == threads - 1) ? last : stride;
+                 GetMinMaxComplex(&values[position], elements, mins[t],
+                                  maxs[t]);
+             },
+             threads);
 
     std::complex<T> minTemp;
     std::complex<T> maxTemp;
@@ -18,6 +18,7 @@
 /// \endcond
 
 #include "adios2/ADIOSTypes.h"
+#include "adios2/helper/adiosMath.h"
 
 namespace adios2
 {
@@ -55,11 +56,49 @@ void CopyToBuffer(std::vector<char> &buffer, size_t &position, const T *source,
  * @param source pointer to source data
  * @param elements number of elements of source type
  * @param threads number of threads sharing the copy load
+ * @param threadPool runs the threads if not nullptr, from core::ADIOS
+ * @exception rethrows the first exception of a thread, see RunTasks
  */
 template <class T>
 void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
                          const T *source, const size_t elements = 1,
-                         const unsigned int threads = 1) noexcept;
+                         const unsigned int threads = 1,
+                         ThreadPool *threadPool = nullptr);
+
+/**
+ * Copies data to a specific location in the buffer updating position, while
+ * getting min and max of source in the same pass. Source is processed in
+ * cache-sized blocks so it is read only once from memory.
+ * Does not update vec.size().
+ * @param buffer data destination
+ * @param position starting position in buffer (in terms of T not bytes)
+ * @param source pointer to source data
+ * @param elements number of elements of source type
+ * @param min of source values (modulus for complex)
+ * @param max of source values (modulus for complex)
+ */
+template <class T>
+void CopyToBufferMinMax(std::vector<char> &buffer, size_t &position,
+                        const T *source, const size_t elements, T &min,
+                        T &max) noexcept;
+
+/**
+ * Threaded version of CopyToBufferMinMax
+ * @param buffer data destination
+ * @param position starting position in buffer (in terms of T not bytes)
+ * @param source pointer to source data
+ * @param elements number of elements of source type
+ * @param min of source values (modulus for complex)
+ * @param max of source values (modulus for complex)
+ * @param threads number of threads sharing the copy and min max load
+ * @param threadPool runs the threads if not nullptr, from core::ADIOS
+ * @exception rethrows the first exception of a thread, see RunTasks
+ */
+template <class T>
+void CopyToBufferMinMaxThreads(std::vector<char> &buffer, size_t &position,
+                               const T *source, const size_t elements, T &min,
+                               T &max, const unsigned int threads = 1,
+                               ThreadPool *threadPool = nullptr);
 
 /**
  * Copy memory from a buffer at a certain input position
@@ -17,7 +17,6 @@
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <algorithm> //std::copy
 #include <cstring>   //std::memcpy
-#include <thread>
 /// \endcond
 
 namespace adios2
@@ -45,7 +44,8 @@ void CopyToBuffer(std::vector<char> &buffer, size_t &position, const T *source,
 template <class T>
 void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
                          const T *source, const size_t elements,
-                         const unsigned int threads) noexcept
+                         const unsigned int threads,
+                         ThreadPool *threadPool)
 {
     if (threads == 1 || threads > elements)
     {
@@ -57,44 +57,101 @@ void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
     const size_t remainder = elements % threads; // remainder if not aligned
     const size_t last = stride + remainder;
 
-    std::vector<std::thread> copyThreads;
-    copyThreads.reserve(threads);
-
     const char *src = reinterpret_cast<const char *>(source);
 
-    for (unsigned int t = 0; t < threads; ++t)
+    RunTasks(threadPool, threads,
+             [&](const size_t t) {
+                 const size_t bufferStart = position + stride * t * sizeof(T);
+                 const size_t srcStart = stride * t * sizeof(T);
+                 // last thread takes stride + remainder
+                 const size_t size = (t == threads - 1) ? last : stride;
+                 std::memcpy(&buffer[bufferStart], &src[srcStart],
+                             size * sizeof(T));
+             },
+             threads);
+
+    position += elements * sizeof(T);
+}
+
+template <class T>
+void CopyToBufferMinMax(std::vector<char> &buffer, size_t &position,
+                        const T *source, const size_t elements, T &min,
+                        T &max) noexcept
+{
+    if (elements == 0)
+    {
+        return;
+    }
+
+    // 16Kb blocks stay in L1 cache between copy and min max
+    constexpr size_t blockElements =
+        (16384 / sizeof(T) > 0) ? 16384 / sizeof(T) : 1;
+
+    min = source[0];
+    max = source[0];
+
+    for (size_t start = 0; start < elements; start += blockElements)
     {
-        const size_t bufferStart = position + stride * t * sizeof(T);
-        const size_t srcStart = stride * t * sizeof(T);
-        if (t == threads - 1) // last thread takes stride + remainder
+        const size_t blockSize = std::min(blockElements, elements - start);
+        const T *block = source + start;
+
+        CopyToBuffer(buffer, position, block, blockSize);
+
+        T blockMin, blockMax;
+        GetMinMaxThreads(block, blockSize, blockMin, blockMax, 1);
+
+        if (LessThan(blockMin, min))
         {
-            copyThreads.push_back(std::thread(std::memcpy, &buffer[bufferStart],
-                                              &src[srcStart],
-                                              last * sizeof(T)));
-            // std::copy not working properly with std::thread...why?
-            //            copyThreads.push_back(std::thread(std::copy,
-            //            &src[srcStart],
-            //                                              &src[srcStart] +
-            //                                              last * sizeof(T),
-            //                                              buffer.begin() +
-            //                                              bufferStart));
+            min = blockMin;
         }
-        else
+        if (GreaterThan(blockMax, max))
         {
-            copyThreads.push_back(std::thread(std::memcpy, &buffer[bufferStart],
-                                              &src[srcStart],
-                                              stride * sizeof(T)));
-            // std::copy not working properly with std::thread...why?
-            //            copyThreads.push_back(std::thread(
-            //                std::copy, &src[srcStart], &src[srcStart] + stride
-            //                * sizeof(T),
-            //                buffer.begin() + bufferStart));
+            max = blockMax;
         }
     }
+}
+
+template <class T>
+void CopyToBufferMinMaxThreads(std::vector<char> &buffer, size_t &position,
+                               const T *source, const size_t elements, T &min,
+                               T &max, const unsigned int threads,
+                               ThreadPool *threadPool)
+{
+    if (threads == 1 || threads > elements)
+    {
+        CopyToBufferMinMax(buffer, position, source, elements, min, max);
+        return;
+    }
 
-    for (auto &copyThread : copyThreads)
+    const size_t stride = elements / threads;    // elements per thread
+    const size_t remainder = elements % threads; // remainder if not aligned
+    const size_t last = stride + remainder;
+
+    std::vector<T> mins(threads);
+    std::vector<T> maxs(threads);
+
+    RunTasks(threadPool, threads,
+             [&](const size_t t) {
+                 const size_t srcStart = stride * t;
+                 const size_t size = (t == threads - 1) ? last : stride;
+                 size_t bufferPosition = position + srcStart * sizeof(T);
+                 CopyToBufferMinMax(buffer, bufferPosition, &source[srcStart],
+                                    size, mins[t], maxs[t]);
+             },
+             threads);
+
+    min = mins.front();
+    max = maxs.front();
+    for (unsigned int t = 1; t < threads; ++t)
     {
-        copyThread.join();
+        if (LessThan(mins[t], min))
+        {
+            min = mins[t];
+        }
+        if (GreaterThan(maxs[t], max))
+        {
+            max = maxs[t];
+        }
     }
 
     position += elements * sizeof(T);
@@ -0,0 +1,291 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "adiosThreadPool.h"
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <algorithm> //std::min, std::max
+#include <exception> //std::exception_ptr
+/// \endcond
+
+namespace adios2
+{
+namespace helper
+{
+
+namespace
+{
+
+/** shared by all threads working on a ThreadPool::Run or RunTasks call, kept
+ * alive by late workers that find no tasks left */
+struct RunState
+{
+    RunState(const size_t tasks, const std::function<void(const size_t)> &task)
+    : Tasks(tasks), Task(&task), Next(0), Completed(0)
+    {
+    }
+
+    const size_t Tasks;
+    const std::function<void(const size_t)> *Task;
+    std::atomic<size_t> Next;
+    std::atomic<size_t> Completed;
+
+    std::mutex Mutex;
+    std::condition_variable Done;
+    std::exception_ptr Exception;
+
+    void Work()
+    {
+        while (true)
+        {
+            const size_t t = Next++;
+            if (t >= Tasks)
+            {
+                return;
+            }
+
+            try
+            {
+                (*Task)(t);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                if (!Exception)
+                {
+                    Exception = std::current_exception();
+                }
+            }
+
+            if (++Completed == Tasks)
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Done.notify_all();
+            }
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        Done.wait(lock, [&]() { return Completed == Tasks; });
+
+        if (Exception)
+        {
+            std::rethrow_exception(Exception);
+        }
+    }
+};
+
+} // end empty namespace
+
+ThreadPool::ThreadPool(const unsigned int maxWorkers)
+: m_MaxWorkers(std::max(maxWorkers, 1u)), m_WorkersCount(0), m_PendingJobs(0),
+  m_NextQueue(0)
+{
+    m_Queues.reserve(m_MaxWorkers);
+    for (unsigned int w = 0; w < m_MaxWorkers; ++w)
+    {
+        m_Queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_WakeUp.notify_all();
+
+    for (auto &worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int ThreadPool::Workers() const noexcept { return m_WorkersCount; }
+
+void ThreadPool::Reserve(const unsigned int workers)
+{
+    const unsigned int target = std::min(workers, m_MaxWorkers);
+    if (m_WorkersCount >= target)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    while (m_Workers.size() < target)
+    {
+        const unsigned int index = static_cast<unsigned int>(m_Workers.size());
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this, index);
+        m_WorkersCount = index + 1;
+    }
+}
+
+void ThreadPool::Run(const size_t tasks,
+                     const std::function<void(const size_t)> &task,
+                     const unsigned int threads)
+{
+    if (tasks == 0)
+    {
+        return;
+    }
+
+    const size_t concurrency =
+        std::min(static_cast<size_t>(std::max(threads, 1u)), tasks);
+    unsigned int helpers = static_cast<unsigned int>(concurrency - 1);
+
+    if (helpers > 0)
+    {
+        Reserve(helpers);
+        helpers = std::min(helpers, Workers());
+    }
+
+    auto state = std::make_shared<RunState>(tasks, task);
+
+    for (unsigned int h = 0; h < helpers; ++h)
+    {
+        Push([state]() { state->Work(); });
+    }
+
+    // calling thread takes part, no deadlock if all workers are busy
+    state->Work();
+    state->Wait();
+}
+
+std::future<void> ThreadPool::Submit(const std::function<void()> &job)
+{
+    Reserve(1);
+
+    auto packagedJob = std::make_shared<std::packaged_task<void()>>(job);
+    std::future<void> future = packagedJob->get_future();
+    Push([packagedJob]() { (*packagedJob)(); });
+    return future;
+}
+
+void ThreadPool::Push(std::function<void()> job)
+{
+    // counted first, so it never goes below the number of queued jobs
+    ++m_PendingJobs;
+
+    const unsigned int index = m_NextQueue++ % Workers();
+    {
+        WorkerQueue &queue = *m_Queues[index];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        queue.Jobs.push_back(std::move(job));
+    }
+
+    // lock so a worker can't miss the notification between check and wait
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_WakeUp.notify_one();
+}
+
+bool ThreadPool::Pop(const unsigned int index, std::function<void()> &job)
+{
+    const unsigned int workers = Workers();
+
+    for (unsigned int i = 0; i < workers; ++i)
+    {
+        const bool isOwn = (i == 0);
+        WorkerQueue &queue = *m_Queues[(index + i) % workers];
+
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (queue.Jobs.empty())
+        {
+            continue;
+        }
+
+        if (isOwn)
+        {
+            job = std::move(queue.Jobs.back());
+            queue.Jobs.pop_back();
+        }
+        else
+        {
+            job = std::move(queue.Jobs.front());
+            queue.Jobs.pop_front();
+        }
+        --m_PendingJobs;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(const unsigned int index)
+{
+    std::function<void()> job;
+
+    while (true)
+    {
+        if (Pop(index, job))
+        {
+            job();
+            job = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_WakeUp.wait(lock, [&]() { return m_Stop || m_PendingJobs > 0; });
+
+        if (m_Stop && m_PendingJobs == 0)
+        {
+            return;
+        }
+    }
+}
+
+void RunTasks(ThreadPool *threadPool, const size_t tasks,
+              const std::function<void(const size_t)> &task,
+              const unsigned int threads)
+{
+    if (threadPool != nullptr)
+    {
+        threadPool->Run(tasks, task, threads);
+        return;
+    }
+
+    if (tasks == 0)
+    {
+        return;
+    }
+
+    const size_t concurrency =
+        std::min(static_cast<size_t>(std::max(threads, 1u)), tasks);
+
+    RunState state(tasks, task);
+
+    std::vector<std::thread> helpers;
+    helpers.reserve(concurrency - 1);
+    for (size_t h = 1; h < concurrency; ++h)
+    {
+        helpers.push_back(std::thread([&state]() { state.Work(); }));
+    }
+
+    state.Work();
+
+    for (auto &helper : helpers)
+    {
+        helper.join();
+    }
+    state.Wait();
+}
+
+std::future<void> SubmitTask(ThreadPool *threadPool,
+                             const std::function<void()> &job)
+{
+    if (threadPool != nullptr)
+    {
+        return threadPool->Submit(job);
+    }
+    return std::async(std::launch::async, job);
+}
+
+} // end namespace helper
+} // end namespace adios2
@@ -0,0 +1,139 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.h : persistent worker threads shared by helper functions,
+ * format serializers and engines
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+#define ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+/// \endcond
+
+namespace adios2
+{
+namespace helper
+{
+
+/**
+ * Pool of worker threads owned by core::ADIOS. Workers are started on demand
+ * up to a fixed maximum and live until the pool is destroyed. Each worker has
+ * its own job queue, idle workers steal jobs from the other queues.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * Unique constructor, no threads are started until needed
+     * @param maxWorkers upper bound for worker threads, at least 1
+     */
+    explicit ThreadPool(
+        const unsigned int maxWorkers = std::thread::hardware_concurrency());
+
+    /** Finishes queued jobs and joins all workers */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /** @return number of started worker threads */
+    unsigned int Workers() const noexcept;
+
+    /**
+     * Starts worker threads until there are at least workers (bounded by
+     * maxWorkers from constructor). Never stops running workers.
+     * @param workers requested number of worker threads
+     */
+    void Reserve(const unsigned int workers);
+
+    /**
+     * Runs task(0) ... task(tasks - 1) using up to threads concurrent threads,
+     * including the calling thread, and waits for all of them. Tasks are
+     * handed out one at a time so uneven tasks balance across threads.
+     * @param tasks number of task indices
+     * @param task function called with each task index
+     * @param threads maximum concurrency, Threads parameter in engines
+     * @exception rethrows the first exception thrown by a task
+     */
+    void Run(const size_t tasks, const std::function<void(const size_t)> &task,
+             const unsigned int threads);
+
+    /**
+     * Queues a job for a worker thread and returns immediately
+     * @param job to be run on a worker
+     * @return future to wait for job and retrieve its exception, if any
+     */
+    std::future<void> Submit(const std::function<void()> &job);
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex Mutex;
+        std::deque<std::function<void()>> Jobs;
+    };
+
+    const unsigned int m_MaxWorkers;
+
+    /** one per potential worker, fixed at construction so it can be scanned
+     * for stealing without locking the pool */
+    std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+
+    std::vector<std::thread> m_Workers;
+    std::atomic<unsigned int> m_WorkersCount;
+
+    /** protects m_Workers, m_Stop and sleeping workers */
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeUp;
+    bool m_Stop = false;
+
+    /** jobs queued and not yet taken by a worker */
+    std::atomic<size_t> m_PendingJobs;
+    std::atomic<unsigned int> m_NextQueue;
+
+    void Push(std::function<void()> job);
+
+    /** pops from own queue back, otherwise steals from the front of others */
+    bool Pop(const unsigned int index, std::function<void()> &job);
+
+    void WorkerLoop(const unsigned int index);
+};
+
+/**
+ * Runs task(0) ... task(tasks - 1) on threadPool, or on std::threads spawned
+ * for this call if threadPool is nullptr
+ * @param threadPool from core::ADIOS through core::IO, can be nullptr
+ * @param tasks number of task indices
+ * @param task function called with each task index
+ * @param threads maximum concurrency including the calling thread
+ */
+void RunTasks(ThreadPool *threadPool, const size_t tasks,
+              const std::function<void(const size_t)> &task,
+              const unsigned int threads);
+
+/**
+ * Runs job asynchronously on threadPool, or with std::async if threadPool is
+ * nullptr
+ * @param threadPool from core::ADIOS through core::IO, can be nullptr
+ * @param job to be run
+ * @return future to wait for job
+ */
+std::future<void> SubmitTask(ThreadPool *threadPool,
+                             const std::function<void()> &job);
+
+} // end namespace helper
+} // end namespace adios2
+
+#endif /* ADIOS2_HELPER_ADIOSTHREADPOOL_H_ */
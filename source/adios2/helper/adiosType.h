@@ -26,13 +26,30 @@ namespace adios2
 namespace helper
 {
 
+/**
+ * Operation (e.g. compression) applied to a block payload when written,
+ * required to restore the original block when read
+ */
+struct BlockOperationInfo
+{
+    std::string Type;     ///< operator type: "bzip2", "zfp", "SZ"
+    Params Parameters;    ///< operator parameters used at write
+    std::string PreType;  ///< adios type of the original data
+    Dims PreCount;        ///< block dimensions of the original data
+    size_t PreSizeOf = 0; ///< element size of the original data
+    size_t PreSize = 0;   ///< original payload size in bytes
+};
+
 struct SubFileInfo
 {
     /**  from characteristics, first = Start point, second =
     End point of block of data */
     Box<Dims> BlockBox;
     Box<Dims> IntersectionBox; ///< first = Start point, second = End point
-    Box<size_t> Seeks;         ///< first = Start seek, second = End seek
+    /** first = Start seek, second = End seek, whole operated payload if
+     * OperationsInfo is not empty */
+    Box<size_t> Seeks;
+    std::vector<BlockOperationInfo> OperationsInfo;
 };
 
 /**
@@ -453,6 +453,13 @@ int MPI_Reduce(const void *sendbuf, void *recvbuf, int count,
     return 0;
 }
 
+int MPI_Exscan(const void * /*sendbuf*/, void * /*recvbuf*/, int /*count*/,
+               MPI_Datatype /*datatype*/, MPI_Op /*op*/, MPI_Comm /*comm*/)
+{
+    // recvbuf is undefined in rank 0, the only rank
+    return MPI_SUCCESS;
+}
+
 } // end namespace mpi
 } // end namespace helper
 } // end namespace adios2
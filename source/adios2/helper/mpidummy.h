@@ -143,6 +143,9 @@ double MPI_Wtime();
 int MPI_Reduce(const void *sendbuf, void *recvbuf, int count,
                MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);
 
+int MPI_Exscan(const void *sendbuf, void *recvbuf, int count,
+               MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+
 } // end namespace mpi
 } // end namespace helper
 } // end namespace adios
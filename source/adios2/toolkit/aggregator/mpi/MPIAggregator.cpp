@@ -10,6 +10,11 @@
 
 #include "MPIAggregator.h"
 
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <algorithm> //std::min
+#include <limits>    //std::numeric_limits
+/// \endcond
+
 #include "adios2/helper/adiosFunctions.h"
 
 namespace adios2
@@ -29,6 +34,8 @@ MPIAggregator::~MPIAggregator()
 
 void MPIAggregator::Init(const size_t subStreams, MPI_Comm parentComm) {}
 
+int MPIAggregator::GetExchangeSteps() const noexcept { return m_Size; }
+
 std::vector<MPI_Request> MPIAggregator::IExchange(BufferSTL & /**bufferSTL*/,
                                                   const int /** step*/)
 {
@@ -42,11 +49,16 @@ MPIAggregator::IExchangeAbsolutePosition(BufferSTL &bufferSTL, const int step)
     const int destination = (step != m_Size - 1) ? step + 1 : 0;
     std::vector<MPI_Request> requests(2);
 
+    if (step == 0)
+    {
+        m_OwnPosition = bufferSTL.m_Position;
+    }
+
     if (m_Rank == step)
     {
         const size_t position =
             (m_Rank == 0) ? bufferSTL.m_AbsolutePosition
-                          : bufferSTL.m_AbsolutePosition + bufferSTL.m_Position;
+                          : bufferSTL.m_AbsolutePosition + m_OwnPosition;
 
         // While the MPI_Isend function should take a const void* as it's first
         // argument, some MPICH implementations provide a broken signature
@@ -172,5 +184,66 @@ void MPIAggregator::HandshakeRank(const int rank)
     MPI_Bcast(&message, 1, MPI_INT, rank, m_Comm);
 }
 
+void MPIAggregator::ScanAbsolutePosition(BufferSTL &bufferSTL,
+                                         const size_t position)
+{
+    size_t offset = 0;
+    helper::CheckMPIReturn(MPI_Exscan(&position, &offset, 1, ADIOS2_MPI_SIZE_T,
+                                      MPI_SUM, m_Comm),
+                           ", aggregation Exscan absolute positions\n");
+
+    // consumer data starts before its own buffered data
+    size_t start = m_IsConsumer ? bufferSTL.m_AbsolutePosition - position : 0;
+    helper::CheckMPIReturn(
+        MPI_Bcast(&start, 1, ADIOS2_MPI_SIZE_T, 0, m_Comm),
+        ", aggregation Bcast consumer absolute position\n");
+
+    size_t total = 0;
+    helper::CheckMPIReturn(MPI_Reduce(&position, &total, 1, ADIOS2_MPI_SIZE_T,
+                                      MPI_SUM, 0, m_Comm),
+                           ", aggregation Reduce buffer sizes\n");
+
+    // Exscan result is undefined in rank 0
+    bufferSTL.m_AbsolutePosition =
+        m_IsConsumer ? start + total : start + offset;
+}
+
+void MPIAggregator::ISendPieces(const char *data, const size_t size,
+                                const int rank, const int tag, MPI_Comm comm,
+                                std::vector<MPI_Request> &requests,
+                                const std::string &hint)
+{
+    const size_t maxPiece =
+        static_cast<size_t>(std::numeric_limits<int>::max());
+    for (size_t position = 0; position < size; position += maxPiece)
+    {
+        const size_t piece = std::min(maxPiece, size - position);
+        requests.emplace_back();
+        helper::CheckMPIReturn(MPI_Isend(data + position,
+                                         static_cast<int>(piece), MPI_CHAR,
+                                         rank, tag, comm, &requests.back()),
+                               hint);
+    }
+}
+
+void MPIAggregator::IRecvPieces(char *data, const size_t size, const int rank,
+                                const int tag, MPI_Comm comm,
+                                std::vector<MPI_Request> &requests,
+                                const std::string &hint)
+{
+    // same tag and source, pieces match the sends in order
+    const size_t maxPiece =
+        static_cast<size_t>(std::numeric_limits<int>::max());
+    for (size_t position = 0; position < size; position += maxPiece)
+    {
+        const size_t piece = std::min(maxPiece, size - position);
+        requests.emplace_back();
+        helper::CheckMPIReturn(MPI_Irecv(data + position,
+                                         static_cast<int>(piece), MPI_CHAR,
+                                         rank, tag, comm, &requests.back()),
+                               hint);
+    }
+}
+
 } // end namespace aggregator
 } // end namespace adios2
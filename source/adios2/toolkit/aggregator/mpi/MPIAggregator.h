@@ -57,14 +57,18 @@ public:
 
     virtual void Init(const size_t subStreams, MPI_Comm parentComm);
 
+    /** number of IExchange/Wait/SwapBuffers iterations per flush, default is
+     * one per rank in m_Comm */
+    virtual int GetExchangeSteps() const noexcept;
+
     virtual std::vector<MPI_Request> IExchange(BufferSTL &bufferSTL,
                                                const int step);
 
-    std::vector<MPI_Request> IExchangeAbsolutePosition(BufferSTL &bufferSTL,
-                                                       const int step);
+    virtual std::vector<MPI_Request>
+    IExchangeAbsolutePosition(BufferSTL &bufferSTL, const int step);
 
-    void WaitAbsolutePosition(std::vector<MPI_Request> &requests,
-                              const int step);
+    virtual void WaitAbsolutePosition(std::vector<MPI_Request> &requests,
+                                      const int step);
 
     virtual void Wait(std::vector<MPI_Request> &requests, const int step);
 
@@ -75,7 +79,7 @@ public:
     virtual BufferSTL &GetConsumerBuffer(BufferSTL &bufferSTL);
 
     /** closes current aggregator, frees m_Comm */
-    void Close();
+    virtual void Close();
 
 protected:
     /** Init m_Comm splitting assigning ranks to subStreams (balanced except for
@@ -85,8 +89,37 @@ protected:
     /** handshakes a single rank with the rest of the m_Comm ranks */
     void HandshakeRank(const int rank = 0);
 
+    /**
+     * Sets absolute positions with collectives for aggregators writing ranks
+     * in m_Comm order, instead of passing them along the ranks. The consumer
+     * gets the end of all data in its m_AbsolutePosition.
+     * @param bufferSTL original buffer from serializer
+     * @param position size of this rank's own data in bufferSTL
+     */
+    void ScanAbsolutePosition(BufferSTL &bufferSTL, const size_t position);
+
+    /**
+     * MPI_Isend of size bytes in pieces of at most INT_MAX, as MPI counts
+     * are int, appending their requests. Received in order by IRecvPieces
+     * with the same tag.
+     */
+    void ISendPieces(const char *data, const size_t size, const int rank,
+                     const int tag, MPI_Comm comm,
+                     std::vector<MPI_Request> &requests,
+                     const std::string &hint);
+
+    /** MPI_Irecv counterpart of ISendPieces */
+    void IRecvPieces(char *data, const size_t size, const int rank,
+                     const int tag, MPI_Comm comm,
+                     std::vector<MPI_Request> &requests,
+                     const std::string &hint);
+
     /** assigning extra buffers for aggregation */
     std::vector<BufferSTL> m_Buffers;
+
+    /** size of this rank's own data, saved at step 0 as receiving into the
+     * original buffer overwrites its m_Position */
+    size_t m_OwnPosition = 0;
 };
 
 } // end namespace aggregator
@@ -0,0 +1,159 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIGatherv.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "MPIGatherv.h"
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <limits>    //std::numeric_limits
+#include <stdexcept> //std::runtime_error
+/// \endcond
+
+#include "adios2/ADIOSMPI.h"
+#include "adios2/helper/adiosFunctions.h" //helper::CheckMPIReturn
+
+namespace adios2
+{
+namespace aggregator
+{
+
+MPIGatherv::MPIGatherv() : MPIAggregator() {}
+
+void MPIGatherv::Init(const size_t subStreams, MPI_Comm parentComm)
+{
+    InitComm(subStreams, parentComm);
+    HandshakeRank(0);
+
+    // receiving buffer for all producers
+    if (m_IsConsumer)
+    {
+        m_Buffers.emplace_back();
+    }
+}
+
+int MPIGatherv::GetExchangeSteps() const noexcept
+{
+    return (m_Size > 1) ? 2 : 1;
+}
+
+std::vector<MPI_Request> MPIGatherv::IExchange(BufferSTL &bufferSTL,
+                                               const int step)
+{
+    std::vector<MPI_Request> requests(1, MPI_REQUEST_NULL);
+    if (step != 0 || m_Size == 1)
+    {
+        return requests;
+    }
+
+    const size_t position = bufferSTL.m_Position;
+    std::vector<size_t> sizes;
+    if (m_IsConsumer)
+    {
+        sizes.resize(static_cast<size_t>(m_Size));
+    }
+
+    helper::CheckMPIReturn(MPI_Gather(&position, 1, ADIOS2_MPI_SIZE_T,
+                                      sizes.data(), 1, ADIOS2_MPI_SIZE_T, 0,
+                                      m_Comm),
+                           ", aggregation Gather buffer sizes\n");
+
+    // displacements are int, all ranks must agree before Igatherv
+    size_t total = 0;
+    if (m_IsConsumer)
+    {
+        m_Counts.assign(static_cast<size_t>(m_Size), 0);
+        m_Displacements.assign(static_cast<size_t>(m_Size), 0);
+
+        // consumer writes its own buffer while receiving the others
+        for (int r = 1; r < m_Size; ++r)
+        {
+            m_Displacements[r] = static_cast<int>(total);
+            m_Counts[r] = static_cast<int>(sizes[r]);
+            total += sizes[r];
+        }
+    }
+
+    helper::CheckMPIReturn(
+        MPI_Bcast(&total, 1, ADIOS2_MPI_SIZE_T, 0, m_Comm),
+        ", aggregation Bcast gathered size\n");
+
+    if (total > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+        throw std::runtime_error(
+            "ERROR: aggregated buffers of " + std::to_string(total) +
+            " bytes exceed the MPI_Igatherv int limit, use AggregationType "
+            "MPIChain or MPITree, or increase SubStreams, in call to "
+            "aggregation\n");
+    }
+
+    char *receiveData = nullptr;
+    if (m_IsConsumer)
+    {
+        BufferSTL &receiveBuffer = m_Buffers.front();
+        if (receiveBuffer.m_Buffer.size() < total)
+        {
+            receiveBuffer.Resize(
+                total, "in aggregation, when resizing receiving buffer to "
+                       "size " +
+                           std::to_string(total));
+        }
+        receiveBuffer.m_Position = total;
+        receiveData = receiveBuffer.m_Buffer.data();
+    }
+
+    helper::CheckMPIReturn(
+        MPI_Igatherv(bufferSTL.m_Buffer.data(),
+                     m_IsConsumer ? 0 : static_cast<int>(position), MPI_CHAR,
+                     receiveData, m_Counts.data(), m_Displacements.data(),
+                     MPI_CHAR, 0, m_Comm, &requests[0]),
+        ", aggregation Igatherv data\n");
+
+    return requests;
+}
+
+std::vector<MPI_Request>
+MPIGatherv::IExchangeAbsolutePosition(BufferSTL &bufferSTL, const int step)
+{
+    if (step == 0)
+    {
+        ScanAbsolutePosition(bufferSTL, bufferSTL.m_Position);
+    }
+    return std::vector<MPI_Request>();
+}
+
+void MPIGatherv::WaitAbsolutePosition(std::vector<MPI_Request> & /*requests*/,
+                                      const int /*step*/)
+{
+}
+
+void MPIGatherv::Wait(std::vector<MPI_Request> &requests, const int step)
+{
+    MPI_Status status;
+    helper::CheckMPIReturn(MPI_Wait(&requests.front(), &status),
+                           ", aggregation waiting for Igatherv at iteration " +
+                               std::to_string(step) + "\n");
+}
+
+void MPIGatherv::SwapBuffers(const int /*step*/) noexcept
+{
+    m_CurrentBufferOrder = (m_CurrentBufferOrder == 0) ? 1 : 0;
+}
+
+void MPIGatherv::ResetBuffers() noexcept { m_CurrentBufferOrder = 0; }
+
+BufferSTL &MPIGatherv::GetConsumerBuffer(BufferSTL &bufferSTL)
+{
+    if (m_CurrentBufferOrder == 0)
+    {
+        return bufferSTL;
+    }
+    return m_Buffers.front();
+}
+
+} // end namespace aggregator
+} // end namespace adios2
@@ -0,0 +1,64 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIGatherv.h : single collective aggregation, the consumer gathers all
+ * producer buffers with MPI_Igatherv while writing its own buffer
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPIGATHERV_H_
+#define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPIGATHERV_H_
+
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
+
+namespace adios2
+{
+namespace aggregator
+{
+
+class MPIGatherv : public MPIAggregator
+{
+
+public:
+    MPIGatherv();
+
+    ~MPIGatherv() = default;
+
+    void Init(const size_t subStreams, MPI_Comm parentComm) final;
+
+    /** consumer own buffer, then all producer buffers */
+    int GetExchangeSteps() const noexcept final;
+
+    std::vector<MPI_Request> IExchange(BufferSTL &bufferSTL,
+                                       const int step) final;
+
+    std::vector<MPI_Request> IExchangeAbsolutePosition(BufferSTL &bufferSTL,
+                                                       const int step) final;
+
+    void WaitAbsolutePosition(std::vector<MPI_Request> &requests,
+                              const int step) final;
+
+    void Wait(std::vector<MPI_Request> &requests, const int step) final;
+
+    void SwapBuffers(const int step) noexcept final;
+
+    void ResetBuffers() noexcept final;
+
+    BufferSTL &GetConsumerBuffer(BufferSTL &bufferSTL) final;
+
+private:
+    /** consumer only: bytes received from each rank and their displacements
+     * in the receiving buffer, must live until the Igatherv completes */
+    std::vector<int> m_Counts;
+    std::vector<int> m_Displacements;
+
+    /** 0: sender is original buffer, 1: sender is gathered buffer */
+    unsigned int m_CurrentBufferOrder = 0;
+};
+
+} // end namespace aggregator
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPIGATHERV_H_ */
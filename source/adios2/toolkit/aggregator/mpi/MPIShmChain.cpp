@@ -0,0 +1,367 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIShmChain.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "MPIShmChain.h"
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <cstring> //std::memcpy
+/// \endcond
+
+#include "adios2/ADIOSMPI.h"
+#include "adios2/helper/adiosFunctions.h" //helper::CheckMPIReturn
+
+namespace adios2
+{
+namespace aggregator
+{
+
+MPIShmChain::MPIShmChain()
+: MPIAggregator(), m_NodeComm(MPI_COMM_NULL), m_LeadersComm(MPI_COMM_NULL),
+  m_Window(MPI_WIN_NULL)
+{
+}
+
+MPIShmChain::~MPIShmChain()
+{
+    if (m_Window != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&m_Window);
+    }
+    if (m_LeadersComm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_LeadersComm);
+    }
+    if (m_NodeComm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_NodeComm);
+    }
+}
+
+void MPIShmChain::Init(const size_t subStreams, MPI_Comm parentComm)
+{
+    InitComm(subStreams, parentComm);
+
+    // key = m_Rank keeps consumer as node rank 0 and leader rank 0
+    helper::CheckMPIReturn(MPI_Comm_split_type(m_Comm, MPI_COMM_TYPE_SHARED,
+                                               m_Rank, MPI_INFO_NULL,
+                                               &m_NodeComm),
+                           ", aggregation splitting shared memory node "
+                           "communicator, in call to Open\n");
+    MPI_Comm_rank(m_NodeComm, &m_NodeRank);
+    MPI_Comm_size(m_NodeComm, &m_NodeSize);
+
+    helper::CheckMPIReturn(
+        MPI_Comm_split(m_Comm, (m_NodeRank == 0) ? 0 : MPI_UNDEFINED, m_Rank,
+                       &m_LeadersComm),
+        ", aggregation splitting node leaders communicator, in call to "
+        "Open\n");
+
+    if (m_LeadersComm != MPI_COMM_NULL)
+    {
+        MPI_Comm_rank(m_LeadersComm, &m_LeaderRank);
+        MPI_Comm_size(m_LeadersComm, &m_Leaders);
+    }
+    MPI_Bcast(&m_Leaders, 1, MPI_INT, 0, m_Comm);
+
+    // receiving buffer for other node leaders data
+    if (m_IsConsumer)
+    {
+        m_Buffers.emplace_back();
+    }
+}
+
+int MPIShmChain::GetExchangeSteps() const noexcept { return m_Leaders; }
+
+std::vector<MPI_Request> MPIShmChain::IExchange(BufferSTL &bufferSTL,
+                                                const int step)
+{
+    // leader data on tag 0 and window data on tag 1, in INT_MAX pieces as
+    // a window holds all node ranks data
+    std::vector<MPI_Request> requests;
+
+    if (step == 0)
+    {
+        m_ConsumerPosition = bufferSTL.m_Position;
+        GatherNode(bufferSTL);
+        GatherLeadersSizes();
+
+        // consumer writes its node in one call
+        if (m_IsConsumer && m_WindowSize > 0)
+        {
+            const size_t newPosition = m_ConsumerPosition + m_WindowSize;
+            if (bufferSTL.m_Buffer.size() < newPosition)
+            {
+                bufferSTL.Resize(newPosition,
+                                 "in aggregation, when appending node buffers "
+                                 "to consumer buffer");
+            }
+            std::memcpy(bufferSTL.m_Buffer.data() + m_ConsumerPosition,
+                        m_WindowBuffer, m_WindowSize);
+            bufferSTL.m_Position = newPosition;
+        }
+    }
+
+    const int sender = step + 1;
+
+    if (m_LeaderRank == sender)
+    {
+        ISendPieces(bufferSTL.m_Buffer.data(), m_NodeSizes.front(), 0, 0,
+                    m_LeadersComm, requests,
+                    ", aggregation Isend leader data at iteration " +
+                        std::to_string(step) + "\n");
+
+        ISendPieces(m_WindowBuffer, m_WindowSize, 0, 1, m_LeadersComm,
+                    requests, ", aggregation Isend node data at iteration " +
+                                  std::to_string(step) + "\n");
+    }
+
+    if (m_IsConsumer && sender < m_Leaders)
+    {
+        const size_t leaderSize = m_LeadersSizes[2 * sender];
+        const size_t windowSize = m_LeadersSizes[2 * sender + 1];
+
+        BufferSTL &receiveBuffer = GetReceiver(bufferSTL);
+        if (receiveBuffer.m_Buffer.size() < leaderSize + windowSize)
+        {
+            receiveBuffer.Resize(
+                leaderSize + windowSize,
+                "in aggregation, when resizing receiving buffer to size " +
+                    std::to_string(leaderSize + windowSize));
+        }
+        receiveBuffer.m_Position = leaderSize + windowSize;
+
+        IRecvPieces(receiveBuffer.m_Buffer.data(), leaderSize, sender, 0,
+                    m_LeadersComm, requests,
+                    ", aggregation Irecv leader data at iteration " +
+                        std::to_string(step) + "\n");
+
+        IRecvPieces(receiveBuffer.m_Buffer.data() + leaderSize, windowSize,
+                    sender, 1, m_LeadersComm, requests,
+                    ", aggregation Irecv node data at iteration " +
+                        std::to_string(step) + "\n");
+    }
+
+    return requests;
+}
+
+std::vector<MPI_Request>
+MPIShmChain::IExchangeAbsolutePosition(BufferSTL &bufferSTL, const int step)
+{
+    std::vector<MPI_Request> requests;
+    if (step != 0)
+    {
+        return requests;
+    }
+
+    size_t nodeStart = 0;
+
+    if (m_LeadersComm != MPI_COMM_NULL)
+    {
+        std::vector<size_t> nodeStarts;
+
+        if (m_IsConsumer)
+        {
+            nodeStarts.resize(static_cast<size_t>(m_Leaders));
+            // consumer data starts where it was before appending its node
+            size_t position = bufferSTL.m_AbsolutePosition - m_ConsumerPosition;
+            for (int l = 0; l < m_Leaders; ++l)
+            {
+                nodeStarts[l] = position;
+                position += m_LeadersSizes[2 * l] + m_LeadersSizes[2 * l + 1];
+            }
+            bufferSTL.m_AbsolutePosition = position;
+        }
+
+        helper::CheckMPIReturn(MPI_Scatter(nodeStarts.data(), 1,
+                                           ADIOS2_MPI_SIZE_T, &nodeStart, 1,
+                                           ADIOS2_MPI_SIZE_T, 0, m_LeadersComm),
+                               ", aggregation Scatter node absolute "
+                               "positions\n");
+    }
+
+    if (m_NodeSize > 1)
+    {
+        helper::CheckMPIReturn(
+            MPI_Bcast(&nodeStart, 1, ADIOS2_MPI_SIZE_T, 0, m_NodeComm),
+            ", aggregation Bcast node absolute position\n");
+    }
+
+    if (!m_IsConsumer)
+    {
+        bufferSTL.m_AbsolutePosition =
+            (m_NodeRank == 0)
+                ? nodeStart
+                : nodeStart + m_NodeSizes.front() + m_WindowOffsets[m_NodeRank];
+    }
+
+    return requests;
+}
+
+void MPIShmChain::WaitAbsolutePosition(
+    std::vector<MPI_Request> & /*requests*/, const int /*step*/)
+{
+}
+
+void MPIShmChain::Wait(std::vector<MPI_Request> &requests, const int step)
+{
+    std::vector<MPI_Status> statuses(requests.size());
+    helper::CheckMPIReturn(MPI_Waitall(static_cast<int>(requests.size()),
+                                       requests.data(), statuses.data()),
+                           ", aggregation waiting for node data at iteration " +
+                               std::to_string(step) + "\n");
+}
+
+void MPIShmChain::SwapBuffers(const int /*step*/) noexcept
+{
+    m_CurrentBufferOrder = (m_CurrentBufferOrder == 0) ? 1 : 0;
+}
+
+void MPIShmChain::ResetBuffers() noexcept { m_CurrentBufferOrder = 0; }
+
+BufferSTL &MPIShmChain::GetConsumerBuffer(BufferSTL &bufferSTL)
+{
+    return GetSender(bufferSTL);
+}
+
+void MPIShmChain::Close()
+{
+    if (m_Window != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&m_Window);
+        m_WindowBuffer = nullptr;
+        m_WindowCapacity = 0;
+    }
+    if (m_LeadersComm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_LeadersComm);
+    }
+    if (m_NodeComm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_NodeComm);
+    }
+    MPIAggregator::Close();
+}
+
+// PRIVATE
+void MPIShmChain::GatherNode(BufferSTL &bufferSTL)
+{
+    const size_t position = bufferSTL.m_Position;
+    m_NodeSizes.resize(static_cast<size_t>(m_NodeSize));
+    m_WindowOffsets.assign(static_cast<size_t>(m_NodeSize), 0);
+    m_WindowSize = 0;
+
+    if (m_NodeSize == 1)
+    {
+        m_NodeSizes.front() = position;
+        return;
+    }
+
+    helper::CheckMPIReturn(MPI_Allgather(&position, 1, ADIOS2_MPI_SIZE_T,
+                                         m_NodeSizes.data(), 1,
+                                         ADIOS2_MPI_SIZE_T, m_NodeComm),
+                           ", aggregation Allgather node buffer sizes\n");
+
+    for (int r = 1; r < m_NodeSize; ++r)
+    {
+        m_WindowOffsets[r] = m_WindowSize;
+        m_WindowSize += m_NodeSizes[r];
+    }
+
+    // all node ranks have the same sizes, so they agree on collectives
+    if (m_WindowSize == 0)
+    {
+        return;
+    }
+
+    if (m_WindowSize > m_WindowCapacity)
+    {
+        if (m_Window != MPI_WIN_NULL)
+        {
+            MPI_Win_free(&m_Window);
+        }
+
+        // extra room to avoid reallocating for slowly growing buffers
+        const size_t capacity = m_WindowSize + m_WindowSize / 2;
+        char *localBuffer = nullptr;
+
+        helper::CheckMPIReturn(
+            MPI_Win_allocate_shared(
+                static_cast<MPI_Aint>((m_NodeRank == 0) ? capacity : 0), 1,
+                MPI_INFO_NULL, m_NodeComm, &localBuffer, &m_Window),
+            ", aggregation allocating shared memory window of " +
+                std::to_string(capacity) + " bytes\n");
+
+        MPI_Aint leaderSize = 0;
+        int displacementUnit = 1;
+        helper::CheckMPIReturn(MPI_Win_shared_query(m_Window, 0, &leaderSize,
+                                                    &displacementUnit,
+                                                    &m_WindowBuffer),
+                               ", aggregation querying leader shared memory "
+                               "window\n");
+        m_WindowCapacity = capacity;
+    }
+
+    helper::CheckMPIReturn(MPI_Win_fence(0, m_Window),
+                           ", aggregation opening shared memory window\n");
+
+    if (m_NodeRank > 0 && position > 0)
+    {
+        std::memcpy(m_WindowBuffer + m_WindowOffsets[m_NodeRank],
+                    bufferSTL.m_Buffer.data(), position);
+    }
+
+    helper::CheckMPIReturn(MPI_Win_fence(0, m_Window),
+                           ", aggregation closing shared memory window\n");
+}
+
+void MPIShmChain::GatherLeadersSizes()
+{
+    if (m_LeadersComm == MPI_COMM_NULL)
+    {
+        return;
+    }
+
+    const size_t sizes[2] = {m_NodeSizes.front(), m_WindowSize};
+    if (m_IsConsumer)
+    {
+        m_LeadersSizes.resize(2 * static_cast<size_t>(m_Leaders));
+    }
+
+    helper::CheckMPIReturn(MPI_Gather(sizes, 2, ADIOS2_MPI_SIZE_T,
+                                      m_LeadersSizes.data(), 2,
+                                      ADIOS2_MPI_SIZE_T, 0, m_LeadersComm),
+                           ", aggregation Gather node leaders sizes\n");
+}
+
+BufferSTL &MPIShmChain::GetSender(BufferSTL &bufferSTL)
+{
+    if (m_CurrentBufferOrder == 0)
+    {
+        return bufferSTL;
+    }
+    else
+    {
+        return m_Buffers.front();
+    }
+}
+
+BufferSTL &MPIShmChain::GetReceiver(BufferSTL &bufferSTL)
+{
+    if (m_CurrentBufferOrder == 0)
+    {
+        return m_Buffers.front();
+    }
+    else
+    {
+        return bufferSTL;
+    }
+}
+
+} // end namespace aggregator
+} // end namespace adios2
@@ -0,0 +1,113 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIShmChain.h : two-level aggregation, ranks on the same node gather into
+ * their node leader through an MPI-3 shared memory window, node leaders send
+ * to the substream consumer
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_
+#define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_
+
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
+
+namespace adios2
+{
+namespace aggregator
+{
+
+class MPIShmChain : public MPIAggregator
+{
+
+public:
+    MPIShmChain();
+
+    ~MPIShmChain();
+
+    void Init(const size_t subStreams, MPI_Comm parentComm) final;
+
+    /** one exchange step per node leader in the substream */
+    int GetExchangeSteps() const noexcept final;
+
+    /**
+     * Step 0 gathers node buffers into the node leader shared window, later
+     * steps send the data of leader step + 1 to the consumer
+     */
+    std::vector<MPI_Request> IExchange(BufferSTL &bufferSTL,
+                                       const int step) final;
+
+    /** Absolute positions are computed from gathered sizes at step 0, no
+     * pending requests are returned */
+    std::vector<MPI_Request> IExchangeAbsolutePosition(BufferSTL &bufferSTL,
+                                                       const int step) final;
+
+    void WaitAbsolutePosition(std::vector<MPI_Request> &requests,
+                              const int step) final;
+
+    void Wait(std::vector<MPI_Request> &requests, const int step) final;
+
+    void SwapBuffers(const int step) noexcept final;
+
+    void ResetBuffers() noexcept final;
+
+    BufferSTL &GetConsumerBuffer(BufferSTL &bufferSTL) final;
+
+    /** frees shared window and node communicators, then m_Comm */
+    void Close() final;
+
+private:
+    /** ranks in m_Comm sharing memory with this rank */
+    MPI_Comm m_NodeComm;
+    int m_NodeRank = 0;
+    int m_NodeSize = 1;
+
+    /** node leaders (m_NodeRank = 0) in m_Comm, MPI_COMM_NULL otherwise. The
+     * consumer is always leader 0 */
+    MPI_Comm m_LeadersComm;
+    int m_LeaderRank = -1;
+
+    /** number of nodes in m_Comm, known by all ranks */
+    int m_Leaders = 1;
+
+    /** shared window allocated by the node leader, holds non-leader buffers
+     */
+    MPI_Win m_Window;
+    char *m_WindowBuffer = nullptr;
+    size_t m_WindowCapacity = 0;
+
+    /** buffer sizes of all node ranks at current flush */
+    std::vector<size_t> m_NodeSizes;
+
+    /** offsets in m_WindowBuffer for node ranks, 0 for leader */
+    std::vector<size_t> m_WindowOffsets;
+
+    /** size of non-leader data in node at current flush */
+    size_t m_WindowSize = 0;
+
+    /** consumer only: leader and window sizes for each node leader */
+    std::vector<size_t> m_LeadersSizes;
+
+    /** consumer only: consumer buffer position before appending window */
+    size_t m_ConsumerPosition = 0;
+
+    /** same as in MPIChain: 0 sender is original, 1 sender is extra buffer */
+    unsigned int m_CurrentBufferOrder = 0;
+
+    /** copies node buffers to leader shared window (grows if needed) */
+    void GatherNode(BufferSTL &bufferSTL);
+
+    /** gathers leader and window sizes in consumer */
+    void GatherLeadersSizes();
+
+    BufferSTL &GetSender(BufferSTL &bufferSTL);
+
+    BufferSTL &GetReceiver(BufferSTL &bufferSTL);
+};
+
+} // end namespace aggregator
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_ */
@@ -0,0 +1,244 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPITree.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "MPITree.h"
+
+#include "adios2/ADIOSMPI.h"
+#include "adios2/helper/adiosFunctions.h" //helper::CheckMPIReturn
+
+namespace adios2
+{
+namespace aggregator
+{
+
+MPITree::MPITree() : MPIAggregator() {}
+
+void MPITree::Init(const size_t subStreams, MPI_Comm parentComm)
+{
+    InitComm(subStreams, parentComm);
+    HandshakeRank(0);
+
+    // receiving buffer for consumer children subtrees
+    if (m_IsConsumer)
+    {
+        m_Buffers.emplace_back();
+    }
+}
+
+int MPITree::GetExchangeSteps() const noexcept
+{
+    int steps = 1;
+    while ((1 << (steps - 1)) < m_Size)
+    {
+        ++steps;
+    }
+    return steps;
+}
+
+std::vector<MPI_Request> MPITree::IExchange(BufferSTL &bufferSTL,
+                                            const int step)
+{
+    // producer size and data sends, or consumer data receives
+    std::vector<MPI_Request> requests;
+
+    if (step == 0)
+    {
+        m_OwnPosition = bufferSTL.m_Position;
+    }
+
+    if (!m_IsConsumer)
+    {
+        if (step == 0)
+        {
+            ForwardSubtree(bufferSTL, requests, step);
+        }
+        return requests;
+    }
+
+    const int child = 1 << step;
+    if (child >= m_Size)
+    {
+        return requests;
+    }
+
+    size_t bufferSize = 0;
+    helper::CheckMPIReturn(MPI_Recv(&bufferSize, 1, ADIOS2_MPI_SIZE_T, child,
+                                    0, m_Comm, MPI_STATUS_IGNORE),
+                           ", aggregation Recv size at iteration " +
+                               std::to_string(step) + "\n");
+
+    BufferSTL &receiveBuffer = GetReceiver(bufferSTL);
+    if (receiveBuffer.m_Buffer.size() < bufferSize)
+    {
+        receiveBuffer.Resize(
+            bufferSize,
+            "in aggregation, when resizing receiving buffer to size " +
+                std::to_string(bufferSize));
+    }
+    receiveBuffer.m_Position = bufferSize;
+
+    IRecvPieces(receiveBuffer.m_Buffer.data(), bufferSize, child, 1, m_Comm,
+                requests, ", aggregation Irecv data at iteration " +
+                              std::to_string(step) + "\n");
+
+    return requests;
+}
+
+std::vector<MPI_Request>
+MPITree::IExchangeAbsolutePosition(BufferSTL &bufferSTL, const int step)
+{
+    if (step == 0)
+    {
+        ScanAbsolutePosition(bufferSTL, m_OwnPosition);
+    }
+    return std::vector<MPI_Request>();
+}
+
+void MPITree::WaitAbsolutePosition(std::vector<MPI_Request> & /*requests*/,
+                                   const int /*step*/)
+{
+}
+
+void MPITree::Wait(std::vector<MPI_Request> &requests, const int step)
+{
+    std::vector<MPI_Status> statuses(requests.size());
+    helper::CheckMPIReturn(MPI_Waitall(static_cast<int>(requests.size()),
+                                       requests.data(), statuses.data()),
+                           ", aggregation waiting for subtree data at "
+                           "iteration " +
+                               std::to_string(step) + "\n");
+}
+
+void MPITree::SwapBuffers(const int /*step*/) noexcept
+{
+    m_CurrentBufferOrder = (m_CurrentBufferOrder == 0) ? 1 : 0;
+}
+
+void MPITree::ResetBuffers() noexcept { m_CurrentBufferOrder = 0; }
+
+BufferSTL &MPITree::GetConsumerBuffer(BufferSTL &bufferSTL)
+{
+    return GetSender(bufferSTL);
+}
+
+// PRIVATE
+std::vector<int> MPITree::GetChildren() const noexcept
+{
+    std::vector<int> children;
+    const int lowBit = (m_Rank == 0) ? m_Size : (m_Rank & -m_Rank);
+
+    for (int distance = 1; distance < lowBit; distance <<= 1)
+    {
+        if (m_Rank + distance >= m_Size)
+        {
+            break;
+        }
+        children.push_back(m_Rank + distance);
+    }
+    return children;
+}
+
+void MPITree::ForwardSubtree(BufferSTL &bufferSTL,
+                             std::vector<MPI_Request> &requests,
+                             const int step)
+{
+    const std::vector<int> children = GetChildren();
+
+    if (!children.empty())
+    {
+        const size_t nChildren = children.size();
+        std::vector<size_t> sizes(nChildren);
+        std::vector<MPI_Request> childRequests(nChildren);
+
+        for (size_t c = 0; c < nChildren; ++c)
+        {
+            helper::CheckMPIReturn(
+                MPI_Irecv(&sizes[c], 1, ADIOS2_MPI_SIZE_T, children[c], 0,
+                          m_Comm, &childRequests[c]),
+                ", aggregation Irecv subtree size at iteration " +
+                    std::to_string(step) + "\n");
+        }
+
+        std::vector<MPI_Status> statuses(nChildren);
+        helper::CheckMPIReturn(
+            MPI_Waitall(static_cast<int>(nChildren), childRequests.data(),
+                        statuses.data()),
+            ", aggregation waiting for subtree sizes at iteration " +
+                std::to_string(step) + "\n");
+
+        // resize once, then receive all subtrees concurrently
+        size_t newPosition = bufferSTL.m_Position;
+        for (const size_t size : sizes)
+        {
+            newPosition += size;
+        }
+        if (bufferSTL.m_Buffer.size() < newPosition)
+        {
+            bufferSTL.Resize(newPosition,
+                             "in aggregation, when appending subtree buffers");
+        }
+
+        std::vector<MPI_Request> dataRequests;
+        for (size_t c = 0; c < nChildren; ++c)
+        {
+            IRecvPieces(bufferSTL.m_Buffer.data() + bufferSTL.m_Position,
+                        sizes[c], children[c], 1, m_Comm, dataRequests,
+                        ", aggregation Irecv subtree data at iteration " +
+                            std::to_string(step) + "\n");
+            bufferSTL.m_Position += sizes[c];
+        }
+
+        statuses.resize(dataRequests.size());
+        helper::CheckMPIReturn(
+            MPI_Waitall(static_cast<int>(dataRequests.size()),
+                        dataRequests.data(), statuses.data()),
+            ", aggregation waiting for subtree data at iteration " +
+                std::to_string(step) + "\n");
+    }
+
+    const int parent = m_Rank - (m_Rank & -m_Rank);
+
+    requests.emplace_back();
+    helper::CheckMPIReturn(MPI_Isend(&bufferSTL.m_Position, 1,
+                                     ADIOS2_MPI_SIZE_T, parent, 0, m_Comm,
+                                     &requests.back()),
+                           ", aggregation Isend size at iteration " +
+                               std::to_string(step) + "\n");
+
+    ISendPieces(bufferSTL.m_Buffer.data(), bufferSTL.m_Position, parent, 1,
+                m_Comm, requests, ", aggregation Isend data at iteration " +
+                                      std::to_string(step) + "\n");
+}
+
+BufferSTL &MPITree::GetSender(BufferSTL &bufferSTL)
+{
+    if (m_CurrentBufferOrder == 0)
+    {
+        return bufferSTL;
+    }
+    else
+    {
+        return m_Buffers.front();
+    }
+}
+
+BufferSTL &MPITree::GetReceiver(BufferSTL &bufferSTL)
+{
+    if (m_CurrentBufferOrder == 0)
+    {
+        return m_Buffers.front();
+    }
+    else
+    {
+        return bufferSTL;
+    }
+}
+
+} // end namespace aggregator
+} // end namespace adios2
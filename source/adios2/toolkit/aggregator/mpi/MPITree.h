@@ -0,0 +1,77 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPITree.h : binomial tree aggregation, each rank forwards the contiguous
+ * data of its subtree to its parent in log(size) depth
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITREE_H_
+#define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITREE_H_
+
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
+
+namespace adios2
+{
+namespace aggregator
+{
+
+/**
+ * Rank r > 0 has parent r - lowbit(r) and children r + 2^k for 2^k <
+ * lowbit(r), so subtrees hold consecutive ranks. Producers append their
+ * children data after their own buffer and send it once. The consumer
+ * receives the subtree of child 2^step while writing the previous one.
+ */
+class MPITree : public MPIAggregator
+{
+
+public:
+    MPITree();
+
+    ~MPITree() = default;
+
+    void Init(const size_t subStreams, MPI_Comm parentComm) final;
+
+    /** own buffer plus one step per consumer child */
+    int GetExchangeSteps() const noexcept final;
+
+    std::vector<MPI_Request> IExchange(BufferSTL &bufferSTL,
+                                       const int step) final;
+
+    std::vector<MPI_Request> IExchangeAbsolutePosition(BufferSTL &bufferSTL,
+                                                       const int step) final;
+
+    void WaitAbsolutePosition(std::vector<MPI_Request> &requests,
+                              const int step) final;
+
+    void Wait(std::vector<MPI_Request> &requests, const int step) final;
+
+    void SwapBuffers(const int step) noexcept final;
+
+    void ResetBuffers() noexcept final;
+
+    BufferSTL &GetConsumerBuffer(BufferSTL &bufferSTL) final;
+
+private:
+    /** same as in MPIChain: 0 sender is original, 1 sender is extra buffer */
+    unsigned int m_CurrentBufferOrder = 0;
+
+    /** @return m_Comm ranks of this rank's children, ascending */
+    std::vector<int> GetChildren() const noexcept;
+
+    /** receives all children subtrees after own data, then sends the result
+     * to parent, producers only */
+    void ForwardSubtree(BufferSTL &bufferSTL,
+                        std::vector<MPI_Request> &requests, const int step);
+
+    BufferSTL &GetSender(BufferSTL &bufferSTL);
+
+    BufferSTL &GetReceiver(BufferSTL &bufferSTL);
+};
+
+} // end namespace aggregator
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPITREE_H_ */
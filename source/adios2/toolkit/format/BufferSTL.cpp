@@ -36,4 +36,140 @@ size_t BufferSTL::GetAvailableSize() const
     return m_Buffer.size() - m_Position;
 }
 
+void BufferSTL::NewChunk(const size_t size, const std::string hint)
+{
+    m_Chunks.push_back(std::vector<char>());
+    m_Chunks.back().swap(m_Buffer);
+    m_ChunksPositions.push_back(m_Position);
+    m_ChunksSize += m_Position;
+    m_Position = 0;
+
+    // smallest pooled chunk that fits, it is not reallocated
+    auto itFit = m_ChunksPool.end();
+    for (auto it = m_ChunksPool.begin(); it != m_ChunksPool.end(); ++it)
+    {
+        if (it->capacity() >= size &&
+            (itFit == m_ChunksPool.end() ||
+             it->capacity() < itFit->capacity()))
+        {
+            itFit = it;
+        }
+    }
+
+    if (itFit != m_ChunksPool.end())
+    {
+        m_Buffer.swap(*itFit);
+        m_ChunksPool.erase(itFit);
+    }
+
+    if (m_Buffer.size() < size)
+    {
+        Resize(size, hint);
+    }
+}
+
+void BufferSTL::ResetChunks() noexcept
+{
+    for (auto &chunk : m_Chunks)
+    {
+        m_ChunksPool.push_back(std::move(chunk));
+    }
+    m_Chunks.clear();
+    m_ChunksPositions.clear();
+    m_ChunksSize = 0;
+    m_References.clear();
+    m_ReferencesSize = 0;
+}
+
+void BufferSTL::AddReference(const char *data, const size_t size)
+{
+    Reference reference;
+    reference.Position = m_ChunksSize + m_Position;
+    reference.Data = data;
+    reference.Size = size;
+    m_References.push_back(reference);
+    m_ReferencesSize += size;
+}
+
+size_t BufferSTL::GetReferencesSize(const size_t position) const noexcept
+{
+    size_t size = 0;
+    for (auto it = m_References.rbegin(); it != m_References.rend(); ++it)
+    {
+        if (it->Position <= position)
+        {
+            break;
+        }
+        size += it->Size;
+    }
+    return size;
+}
+
+std::vector<char> &BufferSTL::GetChunk(size_t &position)
+{
+    for (size_t c = 0; c < m_Chunks.size(); ++c)
+    {
+        if (position < m_ChunksPositions[c])
+        {
+            return m_Chunks[c];
+        }
+        position -= m_ChunksPositions[c];
+    }
+    return m_Buffer;
+}
+
+size_t BufferSTL::GetSize() const noexcept
+{
+    return m_ChunksSize + m_Position;
+}
+
+std::vector<BufferSTL::Segment>
+BufferSTL::GetSegments(const size_t position) const
+{
+    std::vector<Segment> segments;
+    segments.reserve(m_Chunks.size() + 2 * m_References.size() + 1);
+
+    size_t chunkStart = 0; // over all chunks
+    auto itReference = m_References.begin();
+
+    // splits a chunk at each reference inside or at its end
+    auto lf_AddChunk = [&](const char *data, const size_t size) {
+        size_t offset = 0;
+        while (itReference != m_References.end() &&
+               itReference->Position <= chunkStart + size)
+        {
+            const size_t split = itReference->Position - chunkStart;
+            if (split > offset)
+            {
+                segments.emplace_back(data + offset, split - offset);
+                offset = split;
+            }
+            segments.emplace_back(itReference->Data, itReference->Size);
+            ++itReference;
+        }
+        if (size > offset)
+        {
+            segments.emplace_back(data + offset, size - offset);
+        }
+        chunkStart += size;
+    };
+
+    for (size_t c = 0; c < m_Chunks.size(); ++c)
+    {
+        lf_AddChunk(m_Chunks[c].data(), m_ChunksPositions[c]);
+    }
+    lf_AddChunk(m_Buffer.data(), position);
+    return segments;
+}
+
+void BufferSTL::SwapChunks(BufferSTL &other) noexcept
+{
+    m_Buffer.swap(other.m_Buffer);
+    m_Chunks.swap(other.m_Chunks);
+    m_ChunksPositions.swap(other.m_ChunksPositions);
+    std::swap(m_ChunksSize, other.m_ChunksSize);
+    m_References.swap(other.m_References);
+    std::swap(m_ReferencesSize, other.m_ReferencesSize);
+}
+
 } // end namespace adios2
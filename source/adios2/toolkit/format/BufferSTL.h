@@ -12,6 +12,7 @@
 #define ADIOS2_TOOLKIT_FORMAT_BUFFERSTL_H_
 
 #include <string>
+#include <utility> //std::pair
 #include <vector>
 
 #include "adios2/ADIOSTypes.h"
@@ -22,10 +23,40 @@ namespace adios2
 class BufferSTL
 {
 public:
+    /** gather segment: {address, size in bytes} */
+    using Segment = std::pair<const char *, size_t>;
+
     std::vector<char> m_Buffer;
     size_t m_Position = 0;
     size_t m_AbsolutePosition = 0;
 
+    /**
+     * Full chunks, in order, preceding m_Buffer. m_Position is local to
+     * m_Buffer (the current chunk), contents are written with GetSegments
+     */
+    std::vector<std::vector<char>> m_Chunks;
+
+    /** used bytes of each m_Chunks entry */
+    std::vector<size_t> m_ChunksPositions;
+
+    /** sum of m_ChunksPositions */
+    size_t m_ChunksSize = 0;
+
+    /** memory owned by the caller, written in place of a copy */
+    struct Reference
+    {
+        /** inserted before this position over all chunks */
+        size_t Position;
+        const char *Data;
+        size_t Size;
+    };
+
+    /** references in insertion order, non-decreasing Position */
+    std::vector<Reference> m_References;
+
+    /** sum of m_References sizes */
+    size_t m_ReferencesSize = 0;
+
     BufferSTL() = default;
     ~BufferSTL() = default;
 
@@ -33,8 +64,60 @@ public:
 
     size_t GetAvailableSize() const;
 
+    /**
+     * Moves the current m_Buffer up to m_Position to m_Chunks and continues
+     * in a chunk of at least size bytes, reused from previous steps if
+     * possible, instead of reallocating and copying m_Buffer
+     * @param size minimum size of the new current chunk
+     * @param hint for exception handling
+     */
+    void NewChunk(const size_t size, const std::string hint);
+
+    /** Returns full chunks to the reuse pool and drops references, m_Buffer
+     * is kept */
+    void ResetChunks() noexcept;
+
+    /**
+     * Inserts caller memory at the current position, it must remain valid
+     * until the contents are written
+     * @param data caller memory
+     * @param size in bytes
+     */
+    void AddReference(const char *data, const size_t size);
+
+    /**
+     * @param position over all chunks
+     * @return size of references inserted after position
+     */
+    size_t GetReferencesSize(const size_t position) const noexcept;
+
+    /**
+     * Maps a position over all chunks (m_ChunksSize + m_Position for the
+     * current chunk) to the chunk holding it
+     * @param position input: over all chunks, output: local to the chunk
+     * @return chunk holding position
+     */
+    std::vector<char> &GetChunk(size_t &position);
+
+    /** @return used bytes in all chunks, m_ChunksSize + m_Position */
+    size_t GetSize() const noexcept;
+
+    /**
+     * @param position used bytes of the current chunk m_Buffer
+     * @return used contents of m_Chunks and m_Buffer with the references
+     * inserted, in order
+     */
+    std::vector<Segment> GetSegments(const size_t position) const;
+
+    /** exchanges m_Buffer, chunks and references with other, positions are
+     * untouched */
+    void SwapChunks(BufferSTL &other) noexcept;
+
 private:
     const bool m_DebugMode = false;
+
+    /** chunks drained by ResetChunks, already allocated and initialized */
+    std::vector<std::vector<char>> m_ChunksPool;
 };
 
 } // end namespace adios2
@@ -10,11 +10,17 @@
 #include "BP3Base.h"
 #include "BP3Base.tcc"
 
-#include <algorithm> // std::transform
+#include <algorithm> // std::transform, std::max
 #include <iostream>  //std::cout Warnings
 
 #include "adios2/ADIOSTypes.h"            //PathSeparator
 #include "adios2/helper/adiosFunctions.h" //CreateDirectory, StringToTimeUnit,
+#include "adios2/toolkit/aggregator/mpi/MPIChain.h"
+#ifdef ADIOS2_HAVE_MPI
+#include "adios2/toolkit/aggregator/mpi/MPIGatherv.h"
+#include "adios2/toolkit/aggregator/mpi/MPIShmChain.h"
+#include "adios2/toolkit/aggregator/mpi/MPITree.h"
+#endif
 
 namespace adios2
 {
@@ -22,10 +28,12 @@ namespace format
 {
 
 BP3Base::BP3Base(MPI_Comm mpiComm, const bool debugMode)
-: m_MPIComm(mpiComm), m_DebugMode(debugMode)
+: m_MPIComm(mpiComm), m_Aggregator(new aggregator::MPIAggregator()),
+  m_DebugMode(debugMode)
 {
     MPI_Comm_rank(m_MPIComm, &m_RankMPI);
     MPI_Comm_size(m_MPIComm, &m_SizeMPI);
+    m_SubStreams = m_SizeMPI;
     m_Profiler.IsActive = true; // default
 }
 
@@ -66,6 +74,10 @@ void BP3Base::InitParameters(const Params &parameters)
         {
             InitParameterMaxBufferSize(value);
         }
+        else if (key == "bufferchunksize")
+        {
+            InitParameterBufferChunkSize(value);
+        }
         else if (key == "threads")
         {
             InitParameterThreads(value);
@@ -86,8 +98,26 @@ void BP3Base::InitParameters(const Params &parameters)
         {
             InitParameterSubStreams(value);
         }
+        else if (key == "asyncwrite")
+        {
+            InitParameterAsyncWrite(value);
+        }
+        else if (key == "incrementalmetadata")
+        {
+            InitParameterIncrementalMetadata(value);
+        }
+        else if (key == "deferredbyreference")
+        {
+            InitParameterDeferredByReference(value);
+        }
+        else if (key == "aggregationtype")
+        {
+            InitParameterAggregationType(value);
+        }
     }
 
+    InitAggregator();
+
     // default timer for buffering
     if (m_Profiler.IsActive && useDefaultProfileUnits)
     {
@@ -103,6 +133,7 @@ void BP3Base::InitParameters(const Params &parameters)
         lf_EmplaceTimer("minmax");
         lf_EmplaceTimer("meta_sort_merge");
         lf_EmplaceTimer("aggregation");
+        lf_EmplaceTimer("async_wait");
 
         m_Profiler.Bytes.emplace("buffering", 0);
     }
@@ -215,6 +246,7 @@ void BP3Base::ResetBuffer(BufferSTL &bufferSTL,
 {
     ProfilerStart("buffering");
     bufferSTL.m_Position = 0;
+    bufferSTL.ResetChunks();
     if (resetAbsolutePosition)
     {
         bufferSTL.m_AbsolutePosition = 0;
@@ -230,8 +262,10 @@ BP3Base::ResizeResult BP3Base::ResizeBuffer(const size_t dataIn,
                                             const std::string hint)
 {
     ProfilerStart("buffering");
-    const size_t currentCapacity = m_Data.m_Buffer.capacity();
+    // size, not capacity: the buffer shrinks when closing a process group
+    const size_t currentCapacity = m_Data.m_Buffer.size();
     const size_t requiredCapacity = dataIn + m_Data.m_Position;
+    const bool chunked = m_ChunkedData && m_BufferChunkSize > 0;
 
     ResizeResult result = ResizeResult::Unchanged;
 
@@ -251,6 +285,30 @@ BP3Base::ResizeResult BP3Base::ResizeBuffer(const size_t dataIn,
     {
         // do nothing, unchanged is default
     }
+    else if (chunked)
+    {
+        // full chunks are kept as they are, not copied
+        if (m_Data.m_ChunksSize + requiredCapacity > m_MaxBufferSize)
+        {
+            result = ResizeResult::Flush;
+        }
+        else
+        {
+            const size_t chunkSize = std::max(m_BufferChunkSize, dataIn);
+            const std::string chunkHint(" when adding buffer chunk of " +
+                                        std::to_string(chunkSize) +
+                                        "bytes, " + hint);
+            if (m_Data.m_Position == 0)
+            {
+                m_Data.Resize(chunkSize, chunkHint);
+            }
+            else
+            {
+                m_Data.NewChunk(chunkSize, chunkHint);
+            }
+            result = ResizeResult::Success;
+        }
+    }
     else if (requiredCapacity > m_MaxBufferSize)
     {
         if (currentCapacity < m_MaxBufferSize)
@@ -328,6 +386,7 @@ void BP3Base::InitParameterProfileUnits(const std::string value)
     lf_EmplaceTimer("minmax", timeUnit);
     lf_EmplaceTimer("meta_sort_merge", timeUnit);
     lf_EmplaceTimer("aggregation", timeUnit);
+    lf_EmplaceTimer("async_wait", timeUnit);
 
     m_Profiler.Bytes.emplace("buffering", 0);
 }
@@ -467,6 +526,56 @@ void BP3Base::InitParameterMaxBufferSize(const std::string value)
     }
 }
 
+void BP3Base::InitParameterBufferChunkSize(const std::string value)
+{
+    if (m_DebugMode)
+    {
+        if (value.size() < 2)
+        {
+            throw std::invalid_argument(
+                "ERROR: couldn't convert value of BufferChunkSize IO "
+                "SetParameter, valid syntax: BufferChunkSize=1Gb, "
+                "BufferChunkSize=64Mb, BufferChunkSize=16Kb (minimum), "
+                "in call to Open\n");
+        }
+    }
+
+    const std::string number(value.substr(0, value.size() - 2));
+    const std::string units(value.substr(value.size() - 2));
+    const size_t factor = helper::BytesFactor(units, m_DebugMode);
+
+    if (m_DebugMode)
+    {
+        bool success = true;
+        std::string description;
+
+        try
+        {
+            m_BufferChunkSize =
+                static_cast<size_t>(std::stoul(number) * factor);
+        }
+        catch (std::exception &e)
+        {
+            success = false;
+            description = std::string(e.what());
+        }
+
+        if (!success || m_BufferChunkSize < DefaultInitialBufferSize)
+        {
+            throw std::invalid_argument(
+                "ERROR: couldn't convert value of BufferChunkSize IO "
+                "SetParameter, valid syntax: BufferChunkSize=1Gb, "
+                "BufferChunkSize=64Mb, BufferChunkSize=16Kb (minimum), "
+                "additional description: " +
+                description + " in call to Open\n");
+        }
+    }
+    else
+    {
+        m_BufferChunkSize = static_cast<size_t>(std::stoul(number) * factor);
+    }
+}
+
 void BP3Base::InitParameterThreads(const std::string value)
 {
     int threads = -1;
@@ -544,6 +653,23 @@ void BP3Base::InitParameterCollectiveMetadata(const std::string value)
                        "valid: CollectiveMetadata On or Off");
 }
 
+void BP3Base::InitParameterAsyncWrite(const std::string value)
+{
+    InitOnOffParameter(value, m_AsyncWrite, "valid: AsyncWrite On or Off");
+}
+
+void BP3Base::InitParameterIncrementalMetadata(const std::string value)
+{
+    InitOnOffParameter(value, m_IncrementalMetadata,
+                       "valid: IncrementalMetadata On or Off");
+}
+
+void BP3Base::InitParameterDeferredByReference(const std::string value)
+{
+    InitOnOffParameter(value, m_DeferredByReference,
+                       "valid: DeferredByReference On or Off");
+}
+
 void BP3Base::InitParameterFlushStepsCount(const std::string value)
 {
     long long int flushStepsCount = -1;
@@ -682,6 +808,46 @@ std::string BP3Base::ReadBP3String(const std::vector<char> &buffer,
     return values;
 }
 
+BP3Base::BPOpInfo BP3Base::ReadBPOpInfo(const std::vector<char> &buffer,
+                                        size_t &position) const noexcept
+{
+    BPOpInfo opInfo;
+    opInfo.IsActive = true;
+    opInfo.Type = ReadBP3String(buffer, position);
+    opInfo.PreDataType = helper::ReadValue<int8_t>(buffer, position);
+
+    const size_t dimensionsSize =
+        static_cast<size_t>(helper::ReadValue<uint8_t>(buffer, position));
+    position += 2; // skip length (not required)
+
+    opInfo.PreCount.reserve(dimensionsSize);
+    opInfo.PreShape.reserve(dimensionsSize);
+    opInfo.PreStart.reserve(dimensionsSize);
+
+    for (size_t d = 0; d < dimensionsSize; ++d)
+    {
+        opInfo.PreCount.push_back(static_cast<size_t>(
+            helper::ReadValue<uint64_t>(buffer, position)));
+        opInfo.PreShape.push_back(static_cast<size_t>(
+            helper::ReadValue<uint64_t>(buffer, position)));
+        opInfo.PreStart.push_back(static_cast<size_t>(
+            helper::ReadValue<uint64_t>(buffer, position)));
+    }
+
+    position += 2; // skip metadata length (not required)
+    opInfo.PreSize = helper::ReadValue<uint64_t>(buffer, position);
+    opInfo.PostSize = helper::ReadValue<uint64_t>(buffer, position);
+
+    const uint8_t parametersCount = helper::ReadValue<uint8_t>(buffer, position);
+    for (uint8_t p = 0; p < parametersCount; ++p)
+    {
+        const std::string key(ReadBP3String(buffer, position));
+        opInfo.Parameters[key] = ReadBP3String(buffer, position);
+    }
+
+    return opInfo;
+}
+
 void BP3Base::ProfilerStart(const std::string process) noexcept
 {
     if (m_Profiler.IsActive)
@@ -713,7 +879,7 @@ std::string BP3Base::GetBPSubStreamName(const std::string &name,
     }
 
     const size_t index =
-        m_Aggregator.m_IsActive ? m_Aggregator.m_SubStreamIndex : rank;
+        m_Aggregator->m_IsActive ? m_Aggregator->m_SubStreamIndex : rank;
 
     const std::string bpRankName(bpName + ".dir" + PathSeparator + bpRoot +
                                  "." + std::to_string(index));
@@ -770,10 +936,68 @@ void BP3Base::InitParameterSubStreams(const std::string value)
         subStreams = std::stoi(value);
     }
 
-    if (subStreams < m_SizeMPI)
+    m_SubStreams = subStreams;
+}
+
+void BP3Base::InitParameterAggregationType(const std::string value)
+{
+    std::string type(value);
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+
+    if (type == "mpichain")
+    {
+        m_AggregationType = "MPIChain";
+    }
+    else if (type == "mpishmchain")
+    {
+        m_AggregationType = "MPIShmChain";
+    }
+    else if (type == "mpitree")
+    {
+        m_AggregationType = "MPITree";
+    }
+    else if (type == "mpigatherv")
+    {
+        m_AggregationType = "MPIGatherv";
+    }
+    else if (m_DebugMode)
+    {
+        throw std::invalid_argument(
+            "ERROR: unknown AggregationType " + value +
+            ", valid: MPIChain, MPIShmChain, MPITree or MPIGatherv, in call "
+            "to Open\n");
+    }
+}
+
+void BP3Base::InitAggregator()
+{
+    if (m_SubStreams >= m_SizeMPI)
+    {
+        return;
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    if (m_AggregationType == "MPIShmChain")
+    {
+        m_Aggregator.reset(new aggregator::MPIShmChain());
+    }
+    else if (m_AggregationType == "MPITree")
     {
-        m_Aggregator.Init(subStreams, m_MPIComm);
+        m_Aggregator.reset(new aggregator::MPITree());
     }
+    else if (m_AggregationType == "MPIGatherv")
+    {
+        m_Aggregator.reset(new aggregator::MPIGatherv());
+    }
+    else
+    {
+        m_Aggregator.reset(new aggregator::MPIChain());
+    }
+#else
+    m_Aggregator.reset(new aggregator::MPIChain());
+#endif
+
+    m_Aggregator->Init(static_cast<size_t>(m_SubStreams), m_MPIComm);
 }
 
 #define declare_template_instantiation(T)                                      \
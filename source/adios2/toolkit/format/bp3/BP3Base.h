@@ -13,6 +13,7 @@
 
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <bitset>
+#include <memory> //std::unique_ptr
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -23,7 +24,8 @@
 #include "adios2/ADIOSMacros.h"
 #include "adios2/ADIOSTypes.h"
 #include "adios2/core/Variable.h"
-#include "adios2/toolkit/aggregator/mpi/MPIChain.h"
+#include "adios2/helper/adiosThreadPool.h"
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
 #include "adios2/toolkit/format/BufferSTL.h"
 #include "adios2/toolkit/profiling/iochrono/IOChrono.h"
 
@@ -91,11 +93,13 @@ public:
 
         /** number of current PGs */
         uint64_t DataPGCount = 0;
-        /** current PG initial ( relative ) position in data buffer */
+        /** current PG initial ( relative ) position in data buffer, over all
+         * data buffer chunks */
         size_t DataPGLengthPosition = 0;
         /** number of variables in current PG */
         uint32_t DataPGVarsCount = 0;
-        /** current PG variable count ( relative ) position */
+        /** current PG variable count ( relative ) position, over all data
+         * buffer chunks */
         size_t DataPGVarsCountPosition = 0;
         /** true: currently writing to a pg, false: no current pg */
         bool DataPGIsOpen = false;
@@ -120,6 +124,16 @@ public:
         uint8_t Version = 3;
         bool IsLittleEndian = true;
         bool HasSubFiles = false;
+        /** MetadataRecord flag in the reserved minifooter byte */
+        uint8_t Record = 0;
+    };
+
+    /** IncrementalMetadata: flags each footer appended to the metadata file,
+     * footers of files with a single metadata index keep 0 */
+    enum MetadataRecord
+    {
+        metadata_record = 1,      //!< more records may follow
+        metadata_record_final = 2 //!< written at Close
     };
 
     MPI_Comm m_MPIComm;  ///< MPI communicator from Engine
@@ -142,6 +156,14 @@ public:
     /** max buffer size, set by the user */
     size_t m_MaxBufferSize = DefaultMaxBufferSize;
 
+    /** Parameter to grow the data buffer by appending chunks of at least this
+     * size instead of reallocating and copying it. Default: 0 (contiguous) */
+    size_t m_BufferChunkSize = 0;
+
+    /** true: m_BufferChunkSize is used, set by engines that write m_Data
+     * with BufferSTL::GetSegments */
+    bool m_ChunkedData = false;
+
     /** contains bp1 format metadata indices*/
     MetadataSet m_MetadataSet;
 
@@ -159,14 +181,43 @@ public:
      * EndStep */
     size_t m_FlushStepsCount = 1;
 
+    /** Parameter to write data buffers to transports in a background thread
+     * while the application fills a second buffer. Default: Off */
+    bool m_AsyncWrite = false;
+
+    /** Parameter to append a metadata record with the new steps indices and
+     * a minifooter to the metadata file at each flush, instead of rewriting
+     * the whole index, so readers can follow a file being written.
+     * Default: Off */
+    bool m_IncrementalMetadata = false;
+
+    /** Parameter to write deferred array payloads from application memory
+     * at EndStep or Close instead of copying them at PerformPuts, requires
+     * chunked data buffers. Default: Off */
+    bool m_DeferredByReference = false;
+
+    /** Parameter for threads used in large payload copies to buffer,
+     * metadata parsing and concurrent block reads */
+    unsigned int m_Threads = 1;
+
+    /** runs m_Threads work, set by engines from core::IO, nullptr: threads
+     * are created per call */
+    helper::ThreadPool *m_ThreadPool = nullptr;
+
     /** from host language in data information at read */
     bool m_IsRowMajor = true;
 
     /** if reader and writer have different ordering (column vs row major) */
     bool m_ReverseDimensions = false;
 
-    /** manages all communication tasks in aggregation */
-    aggregator::MPIChain m_Aggregator;
+    /** Parameter to select the aggregator used with SubStreams < MPI size:
+     * MPIChain (default), MPIShmChain (node-local shared memory gather),
+     * MPITree (binomial tree forwarding) or MPIGatherv (one collective) */
+    std::string m_AggregationType = "MPIChain";
+
+    /** manages all communication tasks in aggregation, inactive
+     * MPIAggregator if SubStreams is not set */
+    std::unique_ptr<aggregator::MPIAggregator> m_Aggregator;
 
     /**
      * Unique constructor
@@ -250,8 +301,6 @@ public:
     ResizeResult ResizeBuffer(const size_t dataIn, const std::string hint);
 
 protected:
-    /** might be used in large payload copies to buffer */
-    unsigned int m_Threads = 1;
     const bool m_DebugMode = false;
 
     /** method type for file I/O */
@@ -371,6 +420,26 @@ protected:
         char IsColumnMajor;
     };
 
+    /** Operation (e.g. compression) metadata stored in characteristic ID 11
+     * (characteristic_transform_type) */
+    struct BPOpInfo
+    {
+        /** operator parameters required at read, e.g. zfp Rate */
+        Params Parameters;
+        /** from core::Operator m_Type, e.g. bzip2, zfp, SZ */
+        std::string Type;
+        /** dimensions of the block before the operation */
+        Dims PreShape;
+        Dims PreStart;
+        Dims PreCount;
+        /** payload size in bytes before the operation */
+        uint64_t PreSize = 0;
+        /** payload size in bytes after the operation, as stored in data */
+        uint64_t PostSize = 0;
+        int8_t PreDataType = type_unknown;
+        bool IsActive = false;
+    };
+
     template <class T>
     struct Stats
     {
@@ -389,6 +458,7 @@ protected:
         std::bitset<32> Bitmap;
         uint8_t BitFinite;
         bool IsValue = false;
+        BPOpInfo Op;
     };
 
     template <class T>
@@ -440,6 +510,9 @@ protected:
      *  max_buffer_size=100Mb or  max_buffer_size=1Gb */
     void InitParameterMaxBufferSize(const std::string value);
 
+    /** set chunk size in Gb, Mb or Kb, BufferChunkSize=64Mb */
+    void InitParameterBufferChunkSize(const std::string value);
+
     /** Set available number of threads for vector operations */
     void InitParameterThreads(const std::string value);
 
@@ -452,9 +525,29 @@ protected:
     /** set steps count to flush */
     void InitParameterFlushStepsCount(const std::string value);
 
+    /** turns on/off background writes of data buffers */
+    void InitParameterAsyncWrite(const std::string value);
+
+    /** turns on/off metadata records appended at each flush */
+    void InitParameterIncrementalMetadata(const std::string value);
+
+    /** turns on/off deferred payloads written from application memory */
+    void InitParameterDeferredByReference(const std::string value);
+
     /** set number of substreams, turns on aggregation if less < MPI_Size */
     void InitParameterSubStreams(const std::string value);
 
+    /** aggregator type for substreams: MPIChain (default), MPIShmChain,
+     * MPITree or MPIGatherv */
+    void InitParameterAggregationType(const std::string value);
+
+    /** creates m_Aggregator from m_AggregationType if m_SubStreams <
+     * MPI_Size, must be called after all parameters are parsed */
+    void InitAggregator();
+
+    /** number of substreams set by the user, MPI_Size: no aggregation */
+    int m_SubStreams = 0;
+
     /**
      * Returns data type index from enum Datatypes
      * @param variable input variable
@@ -509,6 +602,16 @@ protected:
     std::string ReadBP3String(const std::vector<char> &buffer,
                               size_t &position) const noexcept;
 
+    /**
+     * Reads the operation characteristic (characteristic_transform_type)
+     * written by BP3Serializer, position is past the characteristic ID
+     * @param buffer
+     * @param position
+     * @return operation info with IsActive = true
+     */
+    BPOpInfo ReadBPOpInfo(const std::vector<char> &buffer,
+                          size_t &position) const noexcept;
+
     void ProfilerStart(const std::string process) noexcept;
 
     void ProfilerStop(const std::string process) noexcept;
@@ -503,7 +503,12 @@ BP3Base::ParseCharacteristics(const std::vector<char> &buffer, size_t &position,
             }     // for
             break;
         }
-        // TODO: implement compression and BP1 Stats characteristics
+        case (characteristic_transform_type):
+        {
+            characteristics.Statistics.Op = ReadBPOpInfo(buffer, position);
+            break;
+        }
+        // TODO: implement BP1 Stats characteristics
         default:
         {
             throw std::invalid_argument("ERROR: characteristic ID " +
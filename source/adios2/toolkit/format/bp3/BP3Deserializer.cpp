@@ -11,12 +11,23 @@
 #include "BP3Deserializer.h"
 #include "BP3Deserializer.tcc"
 
-#include <future>
 #include <unordered_set>
 #include <vector>
 
 #include "adios2/helper/adiosFunctions.h" //helper::ReadValue<T>
 
+#ifdef ADIOS2_HAVE_BZIP2
+#include "adios2/operator/compress/CompressBZip2.h"
+#endif
+
+#ifdef ADIOS2_HAVE_ZFP
+#include "adios2/operator/compress/CompressZfp.h"
+#endif
+
+#ifdef ADIOS2_HAVE_SZ
+#include "adios2/operator/compress/CompressSZ.h"
+#endif
+
 #ifdef _WIN32
 #pragma warning(disable : 4503) // Windows complains about SubFileInfoMap levels
 #endif
@@ -35,16 +46,83 @@ BP3Deserializer::BP3Deserializer(MPI_Comm mpiComm, const bool debugMode)
 
 void BP3Deserializer::ParseMetadata(const BufferSTL &bufferSTL, core::IO &io)
 {
-    ParseMinifooter(bufferSTL);
+    {
+        std::lock_guard<std::mutex> lock(m_BlocksIndicesMutex);
+        m_BlocksIndices.clear();
+    }
+
+    ParseMinifooter(bufferSTL, bufferSTL.m_Buffer.size());
     ParsePGIndex(bufferSTL, io);
     ParseVariablesIndex(bufferSTL, io);
     ParseAttributesIndex(bufferSTL, io);
 }
 
+bool BP3Deserializer::ParseMetadataRecords(const BufferSTL &bufferSTL,
+                                           core::IO &io)
+{
+    const auto &buffer = bufferSTL.m_Buffer;
+
+    if (m_MetadataRecordsEnd == 0)
+    {
+        const size_t firstEnd = GetMetadataRecordEnd(buffer, 0);
+        if (firstEnd == 0)
+        {
+            // writer hasn't appended its first record yet
+            m_MetadataSet.StepsCount = 0;
+            return false;
+        }
+
+        // reserved minifooter byte, 0 for a single index
+        if (buffer[firstEnd - 3] == 0)
+        {
+            ParseMetadata(bufferSTL, io);
+            m_MetadataRecordsEnd = buffer.size();
+            return true;
+        }
+        m_MetadataSet.StepsCount = 0;
+    }
+
+    size_t recordEnd = GetMetadataRecordEnd(buffer, m_MetadataRecordsEnd);
+    if (recordEnd == 0)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_BlocksIndicesMutex);
+        m_BlocksIndices.clear();
+    }
+
+    while (recordEnd != 0)
+    {
+        ParseMinifooter(bufferSTL, recordEnd);
+        ParsePGIndex(bufferSTL, io, true);
+        ParseVariablesIndex(bufferSTL, io);
+        ParseAttributesIndex(bufferSTL, io);
+        m_MetadataRecordsEnd = recordEnd;
+
+        if (m_Minifooter.Record == metadata_record_final)
+        {
+            return true;
+        }
+        recordEnd = GetMetadataRecordEnd(buffer, m_MetadataRecordsEnd);
+    }
+    return false;
+}
+
 void BP3Deserializer::ClipContiguousMemory(
     const std::string &variableName, core::IO &io,
     const std::vector<char> &contiguousMemory, const Box<Dims> &blockBox,
     const Box<Dims> &intersectionBox) const
+{
+    ClipContiguousMemory(variableName, io, contiguousMemory.data(),
+                         contiguousMemory.size(), blockBox, intersectionBox);
+}
+
+void BP3Deserializer::ClipContiguousMemory(
+    const std::string &variableName, core::IO &io,
+    const char *contiguousMemory, const size_t contiguousSize,
+    const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const
 {
     // get variable pointer and set data in it with local dimensions
     const std::string type(io.InquireVariableType(variableName));
@@ -58,7 +136,8 @@ void BP3Deserializer::ClipContiguousMemory(
         core::Variable<T> *variable = io.InquireVariable<T>(variableName);     \
         if (variable != nullptr)                                               \
         {                                                                      \
-            ClipContiguousMemoryCommon(*variable, contiguousMemory, blockBox,  \
+            ClipContiguousMemoryCommon(*variable, contiguousMemory,            \
+                                       contiguousSize, blockBox,               \
                                        intersectionBox);                       \
         }                                                                      \
     }
@@ -66,6 +145,76 @@ void BP3Deserializer::ClipContiguousMemory(
 #undef declare_type
 }
 
+void BP3Deserializer::PostDataOperations(
+    const helper::SubFileInfo &blockInfo, const char *operatedMemory,
+    const size_t operatedSize, std::vector<char> &contiguousMemory) const
+{
+    // only a single operation per block is supported
+    const helper::BlockOperationInfo &operation =
+        blockInfo.OperationsInfo.front();
+
+    std::vector<char> preOperatedMemory(operation.PreSize);
+
+    if (operation.Type == "bzip2")
+    {
+#ifdef ADIOS2_HAVE_BZIP2
+        core::compress::CompressBZip2 op(operation.Parameters, m_DebugMode);
+        op.Decompress(operatedMemory, operatedSize,
+                      preOperatedMemory.data(), preOperatedMemory.size());
+#else
+        throw std::runtime_error(
+            "ERROR: this version of ADIOS2 didn't compile with the "
+            "bzip2 library, can't read compressed data, in call to Get\n");
+#endif
+    }
+    else if (operation.Type == "zfp")
+    {
+#ifdef ADIOS2_HAVE_ZFP
+        core::compress::CompressZfp op(operation.Parameters, m_DebugMode);
+        op.Decompress(operatedMemory, operatedSize,
+                      preOperatedMemory.data(), operation.PreCount,
+                      operation.PreType, operation.Parameters);
+#else
+        throw std::runtime_error(
+            "ERROR: this version of ADIOS2 didn't compile with the "
+            "zfp library, can't read compressed data, in call to Get\n");
+#endif
+    }
+    else if (operation.Type == "SZ")
+    {
+#ifdef ADIOS2_HAVE_SZ
+        core::compress::CompressSZ op(operation.Parameters, m_DebugMode);
+        op.Decompress(operatedMemory, operatedSize,
+                      preOperatedMemory.data(), operation.PreCount,
+                      operation.PreType, operation.Parameters);
+#else
+        throw std::runtime_error(
+            "ERROR: this version of ADIOS2 didn't compile with the "
+            "SZ library, can't read compressed data, in call to Get\n");
+#endif
+    }
+    else
+    {
+        throw std::runtime_error("ERROR: operator type " + operation.Type +
+                                 " not supported for reading, in call to "
+                                 "Get\n");
+    }
+
+    // extract intersection range
+    const size_t start = helper::LinearIndex(blockInfo.BlockBox,
+                                             blockInfo.IntersectionBox.first,
+                                             m_IsRowMajor) *
+                         operation.PreSizeOf;
+    const size_t end = (helper::LinearIndex(blockInfo.BlockBox,
+                                            blockInfo.IntersectionBox.second,
+                                            m_IsRowMajor) +
+                        1) *
+                       operation.PreSizeOf;
+
+    contiguousMemory.assign(preOperatedMemory.begin() + start,
+                            preOperatedMemory.begin() + end);
+}
+
 void BP3Deserializer::SetVariableNextStepData(const std::string &variableName,
                                               core::IO &io) const
 {
@@ -88,7 +237,35 @@ void BP3Deserializer::SetVariableNextStepData(const std::string &variableName,
 }
 
 // PRIVATE
-void BP3Deserializer::ParseMinifooter(const BufferSTL &bufferSTL)
+size_t
+BP3Deserializer::GetMetadataRecordEnd(const std::vector<char> &buffer,
+                                      const size_t start) const noexcept
+{
+    // pg index count and length, vars and attributes count and length
+    const size_t size = buffer.size();
+    size_t position = start + 8;
+    if (position + 8 > size)
+    {
+        return 0;
+    }
+    position += helper::ReadValue<uint64_t>(buffer, position) + 4;
+    if (position + 8 > size)
+    {
+        return 0;
+    }
+    position += helper::ReadValue<uint64_t>(buffer, position) + 4;
+    if (position + 8 > size)
+    {
+        return 0;
+    }
+    position += helper::ReadValue<uint64_t>(buffer, position) +
+                m_MetadataSet.MiniFooterSize;
+
+    return (position <= size) ? position : 0;
+}
+
+void BP3Deserializer::ParseMinifooter(const BufferSTL &bufferSTL,
+                                      const size_t footerEnd)
 {
     auto lf_GetEndianness = [](const uint8_t endianness, bool &isLittleEndian) {
 
@@ -104,11 +281,11 @@ void BP3Deserializer::ParseMinifooter(const BufferSTL &bufferSTL)
     };
 
     const auto &buffer = bufferSTL.m_Buffer;
-    const size_t bufferSize = buffer.size();
+    const size_t bufferSize = footerEnd;
     size_t position = bufferSize - 4;
     const uint8_t endianess = helper::ReadValue<uint8_t>(buffer, position);
     lf_GetEndianness(endianess, m_Minifooter.IsLittleEndian);
-    position += 1;
+    m_Minifooter.Record = helper::ReadValue<uint8_t>(buffer, position);
 
     const uint8_t subFilesIndex = helper::ReadValue<uint8_t>(buffer, position);
     if (subFilesIndex > 0)
@@ -137,7 +314,7 @@ void BP3Deserializer::ParseMinifooter(const BufferSTL &bufferSTL)
 }
 
 void BP3Deserializer::ParsePGIndex(const BufferSTL &bufferSTL,
-                                   const core::IO &io)
+                                   const core::IO &io, const bool isRecord)
 {
     const auto &buffer = bufferSTL.m_Buffer;
     size_t position = m_Minifooter.PGIndexStart;
@@ -147,8 +324,13 @@ void BP3Deserializer::ParsePGIndex(const BufferSTL &bufferSTL,
 
     size_t localPosition = 0;
 
+    // steps start at 1, a flush inside a step continues it in the next record
     std::unordered_set<uint32_t> stepsFound;
-    m_MetadataSet.StepsCount = 0;
+    if (!isRecord)
+    {
+        m_MetadataSet.StepsCount = 0;
+    }
+    const size_t previousSteps = m_MetadataSet.StepsCount;
 
     while (localPosition < length)
     {
@@ -161,7 +343,7 @@ void BP3Deserializer::ParsePGIndex(const BufferSTL &bufferSTL,
         m_MetadataSet.CurrentStep = static_cast<size_t>(index.Step - 1);
 
         // Count the number of unseen steps
-        if (stepsFound.insert(index.Step).second)
+        if (index.Step > previousSteps && stepsFound.insert(index.Step).second)
         {
             ++m_MetadataSet.StepsCount;
         }
@@ -306,45 +488,25 @@ void BP3Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
         return;
     }
 
-    // threads for reading Variables
-    std::vector<std::future<void>> asyncs(m_Threads);
-    std::vector<size_t> asyncPositions(m_Threads);
-
-    bool launched = false;
+    // positions are found serially, variables are defined on m_Threads
+    std::vector<size_t> elementPositions;
+    elementPositions.reserve(count);
 
     while (localPosition < length)
     {
-        // extract async positions
-        for (unsigned int t = 0; t < m_Threads; ++t)
-        {
-            asyncPositions[t] = position;
-            const size_t elementIndexSize = static_cast<size_t>(
-                helper::ReadValue<uint32_t>(buffer, position));
-            position += elementIndexSize;
-            localPosition = position - startPosition;
-
-            if (launched)
-            {
-                asyncs[t].get();
-            }
+        elementPositions.push_back(position);
 
-            if (localPosition <= length)
-            {
-                asyncs[t] = std::async(std::launch::async, lf_ReadElementIndex,
-                                       std::ref(io), std::ref(buffer),
-                                       asyncPositions[t]);
-            }
-        }
-        launched = true;
+        const size_t elementIndexSize = static_cast<size_t>(
+            helper::ReadValue<uint32_t>(buffer, position));
+        position += elementIndexSize;
+        localPosition = position - startPosition;
     }
 
-    for (auto &async : asyncs)
-    {
-        if (async.valid())
-        {
-            async.wait();
-        }
-    }
+    helper::RunTasks(m_ThreadPool, elementPositions.size(),
+                     [&](const size_t i) {
+                         lf_ReadElementIndex(io, buffer, elementPositions[i]);
+                     },
+                     m_Threads);
 }
 
 void BP3Deserializer::ParseAttributesIndex(const BufferSTL &bufferSTL,
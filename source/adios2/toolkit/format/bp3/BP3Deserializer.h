@@ -43,6 +43,18 @@ public:
 
     void ParseMetadata(const BufferSTL &bufferSTL, core::IO &io);
 
+    /**
+     * Parses a metadata file read from its start, either with a single index
+     * (ParseMetadata) or with IncrementalMetadata records. Records already
+     * parsed and incomplete trailing records are skipped, so it can be called
+     * again as the file grows.
+     * @param bufferSTL metadata file contents read so far
+     * @param io variables and attributes are defined or extended
+     * @return true: no more metadata can follow, false: the writer can still
+     * append records
+     */
+    bool ParseMetadataRecords(const BufferSTL &bufferSTL, core::IO &io);
+
     // Sync functions
     template <class T>
     std::map<std::string, helper::SubFileInfoMap>
@@ -78,6 +90,34 @@ public:
                               const Box<Dims> &blockBox,
                               const Box<Dims> &intersectionBox) const;
 
+    /**
+     * Pointer version, used for zero-copy reads from mapped files
+     * @param variableName
+     * @param io
+     * @param contiguousMemory intersection range of a block
+     * @param contiguousSize in bytes
+     * @param blockBox
+     * @param intersectionBox
+     */
+    void ClipContiguousMemory(const std::string &variableName, core::IO &io,
+                              const char *contiguousMemory,
+                              const size_t contiguousSize,
+                              const Box<Dims> &blockBox,
+                              const Box<Dims> &intersectionBox) const;
+
+    /**
+     * Restores an operated (e.g. compressed) block payload and extracts its
+     * intersection range, as expected by ClipContiguousMemory
+     * @param blockInfo read schedule of a block with OperationsInfo
+     * @param operatedMemory input operated block payload
+     * @param operatedSize input operated block payload size in bytes
+     * @param contiguousMemory output intersection range of original block
+     */
+    void PostDataOperations(const helper::SubFileInfo &blockInfo,
+                            const char *operatedMemory,
+                            const size_t operatedSize,
+                            std::vector<char> &contiguousMemory) const;
+
     void SetVariableNextStepData(const std::string &variableName,
                                  core::IO &io) const;
 
@@ -89,8 +129,51 @@ private:
 
     static std::mutex m_Mutex;
 
-    void ParseMinifooter(const BufferSTL &bufferSTL);
-    void ParsePGIndex(const BufferSTL &bufferSTL, const core::IO &io);
+    /** spatial index of the blocks of a variable in a step */
+    struct BlocksIndex
+    {
+        /** block boxes, one per position */
+        helper::BoxIndex Boxes;
+        /** block characteristics positions in metadata, same order */
+        std::vector<size_t> Positions;
+    };
+
+    /** key: {variable name, step}, built at first GetSubFileInfo and
+     * reused by later selections until the next ParseMetadata */
+    mutable std::map<std::pair<std::string, size_t>, BlocksIndex>
+        m_BlocksIndices;
+    mutable std::mutex m_BlocksIndicesMutex;
+
+    /**
+     * Returns the (cached) spatial index of the variable blocks in step
+     * @param variable
+     * @param step
+     * @param blockStarts variable.m_IndexStepBlockStarts at step
+     * @return nullptr if block boxes don't match the variable dimensions
+     * (e.g. local values), callers must then test every block
+     */
+    template <class T>
+    const BlocksIndex *
+    GetBlocksIndex(const core::Variable<T> &variable, const size_t step,
+                   const std::vector<size_t> &blockStarts) const;
+
+    /** end of the IncrementalMetadata records parsed so far */
+    size_t m_MetadataRecordsEnd = 0;
+
+    /**
+     * Returns the end of a complete metadata record
+     * @param buffer metadata file contents read so far
+     * @param start record (pg index) position
+     * @return 0 if the record isn't complete in buffer
+     */
+    size_t GetMetadataRecordEnd(const std::vector<char> &buffer,
+                                const size_t start) const noexcept;
+
+    /** @param footerEnd minifooter end, the buffer size for single indices */
+    void ParseMinifooter(const BufferSTL &bufferSTL, const size_t footerEnd);
+    /** @param isRecord true: steps add to the previous records steps */
+    void ParsePGIndex(const BufferSTL &bufferSTL, const core::IO &io,
+                      const bool isRecord = false);
     void ParseVariablesIndex(const BufferSTL &bufferSTL, core::IO &io);
     void ParseAttributesIndex(const BufferSTL &bufferSTL, core::IO &io);
 
@@ -114,7 +197,8 @@ private:
 
     template <class T>
     void ClipContiguousMemoryCommon(core::Variable<T> &variable,
-                                    const std::vector<char> &contiguousMemory,
+                                    const char *contiguousMemory,
+                                    const size_t contiguousSize,
                                     const Box<Dims> &blockBox,
                                     const Box<Dims> &intersectionBox) const;
 
@@ -126,9 +210,10 @@ private:
      * @param intersectionBox
      */
     template <class T>
-    void ClipContiguousMemoryCommonRow(
-        core::Variable<T> &variable, const std::vector<char> &contiguousMemory,
-        const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const;
+    void ClipContiguousMemoryCommonRow(core::Variable<T> &variable,
+                                       const char *contiguousMemory,
+                                       const Box<Dims> &blockBox,
+                                       const Box<Dims> &intersectionBox) const;
 
     /**
      * Column-major, one indexed data e.g. : Fortran, R
@@ -139,7 +224,7 @@ private:
      */
     template <class T>
     void ClipContiguousMemoryCommonColumn(
-        core::Variable<T> &variable, const std::vector<char> &contiguousMemory,
+        core::Variable<T> &variable, const char *contiguousMemory,
         const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const;
 
     template <class T>
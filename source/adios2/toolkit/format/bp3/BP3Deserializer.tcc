@@ -95,12 +95,19 @@ inline void BP3Deserializer::DefineVariableInIO<std::string>(
     }
 
     core::Variable<std::string> *variable = nullptr;
+    bool isNew = false;
     if (characteristics.Statistics.IsValue)
     {
         std::lock_guard<std::mutex> lock(m_Mutex);
-        variable = &io.DefineVariable<std::string>(variableName);
-        variable->m_Value =
-            characteristics.Statistics.Value; // assigning first step
+        // IncrementalMetadata: defined by a previous record
+        variable = io.InquireVariable<std::string>(variableName);
+        if (variable == nullptr)
+        {
+            variable = &io.DefineVariable<std::string>(variableName);
+            variable->m_Value =
+                characteristics.Statistics.Value; // assigning first step
+            isNew = true;
+        }
     }
     else
     {
@@ -121,7 +128,10 @@ inline void BP3Deserializer::DefineVariableInIO<std::string>(
 
     size_t currentStep = 0; // Starts at 1 in bp file
     std::unordered_set<uint32_t> stepsFound;
-    variable->m_AvailableStepsCount = 0;
+    if (isNew)
+    {
+        variable->m_AvailableStepsCount = 0;
+    }
     while (position < endPosition)
     {
         const size_t subsetPosition = position;
@@ -136,7 +146,8 @@ inline void BP3Deserializer::DefineVariableInIO<std::string>(
         {
             currentStep = subsetCharacteristics.Statistics.Step;
         }
-        if (stepsFound.insert(subsetCharacteristics.Statistics.Step).second)
+        if (stepsFound.insert(subsetCharacteristics.Statistics.Step).second &&
+            variable->m_IndexStepBlockStarts.count(currentStep) == 0)
         {
             ++variable->m_AvailableStepsCount;
         }
@@ -163,30 +174,41 @@ void BP3Deserializer::DefineVariableInIO(const ElementIndexHeader &header,
     }
 
     core::Variable<T> *variable = nullptr;
+    bool isNew = false;
     if (characteristics.Statistics.IsValue)
     {
         std::lock_guard<std::mutex> lock(m_Mutex);
-        variable = &io.DefineVariable<T>(variableName);
-        variable->m_Value = characteristics.Statistics.Value;
-        variable->m_Min = characteristics.Statistics.Value;
-        variable->m_Max = characteristics.Statistics.Value;
+        // IncrementalMetadata: defined by a previous record
+        variable = io.InquireVariable<T>(variableName);
+        if (variable == nullptr)
+        {
+            variable = &io.DefineVariable<T>(variableName);
+            variable->m_Value = characteristics.Statistics.Value;
+            variable->m_Min = characteristics.Statistics.Value;
+            variable->m_Max = characteristics.Statistics.Value;
+            isNew = true;
+        }
     }
     else
     {
         std::lock_guard<std::mutex> lock(m_Mutex);
-
-        if (m_ReverseDimensions)
+        variable = io.InquireVariable<T>(variableName);
+        if (variable == nullptr)
         {
-            std::reverse(characteristics.Shape.begin(),
-                         characteristics.Shape.end());
-        }
+            if (m_ReverseDimensions)
+            {
+                std::reverse(characteristics.Shape.begin(),
+                             characteristics.Shape.end());
+            }
 
-        variable = &io.DefineVariable<T>(variableName, characteristics.Shape,
-                                         Dims(characteristics.Shape.size(), 0),
-                                         characteristics.Shape);
+            variable = &io.DefineVariable<T>(
+                variableName, characteristics.Shape,
+                Dims(characteristics.Shape.size(), 0), characteristics.Shape);
 
-        variable->m_Min = characteristics.Statistics.Min;
-        variable->m_Max = characteristics.Statistics.Max;
+            variable->m_Min = characteristics.Statistics.Min;
+            variable->m_Max = characteristics.Statistics.Max;
+            isNew = true;
+        }
     }
 
     // going back to get variable index position
@@ -201,7 +223,10 @@ void BP3Deserializer::DefineVariableInIO(const ElementIndexHeader &header,
 
     size_t currentStep = 0; // Starts at 1 in bp file
     std::unordered_set<uint32_t> stepsFound;
-    variable->m_AvailableStepsCount = 0;
+    if (isNew)
+    {
+        variable->m_AvailableStepsCount = 0;
+    }
     while (position < endPosition)
     {
         const size_t subsetPosition = position;
@@ -228,7 +253,8 @@ void BP3Deserializer::DefineVariableInIO(const ElementIndexHeader &header,
         {
             currentStep = subsetCharacteristics.Statistics.Step;
         }
-        if (stepsFound.insert(subsetCharacteristics.Statistics.Step).second)
+        if (stepsFound.insert(subsetCharacteristics.Statistics.Step).second &&
+            variable->m_IndexStepBlockStarts.count(currentStep) == 0)
         {
             ++variable->m_AvailableStepsCount;
         }
@@ -253,6 +279,12 @@ void BP3Deserializer::DefineAttributeInIO(const ElementIndexHeader &header,
         attributeName = header.Path + PathSeparator + header.Name;
     }
 
+    // IncrementalMetadata: defined by a previous record
+    if (io.InquireAttribute<T>(attributeName) != nullptr)
+    {
+        return;
+    }
+
     if (characteristics.Statistics.IsValue)
     {
         io.DefineAttribute<T>(attributeName, characteristics.Statistics.Value);
@@ -289,8 +321,25 @@ BP3Deserializer::GetSubFileInfo(const core::Variable<T> &variable) const
 
         const std::vector<size_t> &blockStarts = itBlockStarts->second;
 
+        // only intersecting blocks characteristics are read again
+        std::vector<size_t> intersectingStarts;
+        const BlocksIndex *blocksIndex =
+            GetBlocksIndex(variable, step, blockStarts);
+        if (blocksIndex != nullptr)
+        {
+            const std::vector<size_t> positions =
+                blocksIndex->Boxes.Intersecting(selectionBox);
+            intersectingStarts.reserve(positions.size());
+            for (const size_t position : positions)
+            {
+                intersectingStarts.push_back(blocksIndex->Positions[position]);
+            }
+        }
+        const std::vector<size_t> &candidateStarts =
+            (blocksIndex != nullptr) ? intersectingStarts : blockStarts;
+
         // blockPosition gets updated by Read, can't be const
-        for (size_t blockPosition : blockStarts)
+        for (size_t blockPosition : candidateStarts)
         {
             const Characteristics<T> blockCharacteristics =
                 ReadElementIndexCharacteristics<T>(
@@ -309,6 +358,31 @@ BP3Deserializer::GetSubFileInfo(const core::Variable<T> &variable) const
             {
                 continue;
             }
+            const BPOpInfo &operation = blockCharacteristics.Statistics.Op;
+            if (operation.IsActive)
+            {
+                // operated payloads are read as a whole block
+                helper::BlockOperationInfo operationInfo;
+                operationInfo.Type = operation.Type;
+                operationInfo.Parameters = operation.Parameters;
+                operationInfo.PreType = helper::GetType<T>();
+                operationInfo.PreCount = operation.PreCount;
+                operationInfo.PreSizeOf = sizeof(T);
+                operationInfo.PreSize = static_cast<size_t>(operation.PreSize);
+                info.OperationsInfo.push_back(std::move(operationInfo));
+
+                info.Seeks.first = static_cast<size_t>(
+                    blockCharacteristics.Statistics.PayloadOffset);
+                info.Seeks.second =
+                    info.Seeks.first + static_cast<size_t>(operation.PostSize);
+
+                const size_t fileIndex = static_cast<size_t>(
+                    blockCharacteristics.Statistics.FileIndex);
+
+                infoMap[fileIndex][step].push_back(std::move(info));
+                continue;
+            }
+
             // if they intersect get info Seeks (first: start, second:
             // count)
             info.Seeks.first =
@@ -334,10 +408,64 @@ BP3Deserializer::GetSubFileInfo(const core::Variable<T> &variable) const
     return infoMap;
 }
 
+template <class T>
+const BP3Deserializer::BlocksIndex *
+BP3Deserializer::GetBlocksIndex(const core::Variable<T> &variable,
+                                const size_t step,
+                                const std::vector<size_t> &blockStarts) const
+{
+    std::lock_guard<std::mutex> lock(m_BlocksIndicesMutex);
+
+    const std::pair<std::string, size_t> key(variable.m_Name, step);
+    auto itBlocksIndex = m_BlocksIndices.find(key);
+    if (itBlocksIndex != m_BlocksIndices.end())
+    {
+        return itBlocksIndex->second.Positions.empty()
+                   ? nullptr
+                   : &itBlocksIndex->second;
+    }
+
+    // empty Positions marks a variable that can't be indexed
+    BlocksIndex &blocksIndex = m_BlocksIndices[key];
+
+    const size_t dimensionsSize = variable.m_Count.size();
+    if (dimensionsSize == 0 || blockStarts.empty())
+    {
+        return nullptr;
+    }
+
+    std::vector<Box<Dims>> boxes;
+    boxes.reserve(blockStarts.size());
+
+    for (size_t blockPosition : blockStarts)
+    {
+        const size_t position = blockPosition;
+        const Characteristics<T> blockCharacteristics =
+            ReadElementIndexCharacteristics<T>(
+                m_Metadata.m_Buffer, blockPosition,
+                static_cast<DataTypes>(GetDataType<T>()));
+
+        if (blockCharacteristics.Start.size() != dimensionsSize ||
+            blockCharacteristics.Count.size() != dimensionsSize)
+        {
+            blocksIndex.Positions.clear();
+            return nullptr;
+        }
+
+        boxes.push_back(helper::StartEndBox(blockCharacteristics.Start,
+                                            blockCharacteristics.Count));
+        blocksIndex.Positions.push_back(position);
+    }
+
+    blocksIndex.Boxes = helper::BoxIndex(std::move(boxes));
+    return &blocksIndex;
+}
+
 template <class T>
 void BP3Deserializer::ClipContiguousMemoryCommon(
-    core::Variable<T> &variable, const std::vector<char> &contiguousMemory,
-    const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const
+    core::Variable<T> &variable, const char *contiguousMemory,
+    const size_t contiguousSize, const Box<Dims> &blockBox,
+    const Box<Dims> &intersectionBox) const
 {
     const Dims &start = intersectionBox.first;
     if (start.size() == 1) // 1D copy memory
@@ -347,7 +475,7 @@ void BP3Deserializer::ClipContiguousMemoryCommon(
             (start[0] - variable.m_Start[0]) * sizeof(T);
         char *rawVariableData = reinterpret_cast<char *>(variable.m_Data);
 
-        std::copy(contiguousMemory.begin(), contiguousMemory.end(),
+        std::copy(contiguousMemory, contiguousMemory + contiguousSize,
                   &rawVariableData[normalizedStart]);
 
         return;
@@ -367,7 +495,7 @@ void BP3Deserializer::ClipContiguousMemoryCommon(
 
 template <class T>
 void BP3Deserializer::ClipContiguousMemoryCommonRow(
-    core::Variable<T> &variable, const std::vector<char> &contiguousMemory,
+    core::Variable<T> &variable, const char *contiguousMemory,
     const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const
 {
     const Dims &start = intersectionBox.first;
@@ -397,8 +525,8 @@ void BP3Deserializer::ClipContiguousMemoryCommonRow(
 
         char *rawVariableData = reinterpret_cast<char *>(variable.m_Data);
 
-        std::copy(contiguousMemory.begin() + contiguousStart,
-                  contiguousMemory.begin() + contiguousStart + stride,
+        std::copy(contiguousMemory + contiguousStart,
+                  contiguousMemory + contiguousStart + stride,
                   rawVariableData + variableStart);
 
         // here update each index recursively, always starting from the 2nd
@@ -431,7 +559,7 @@ void BP3Deserializer::ClipContiguousMemoryCommonRow(
 
 template <class T>
 void BP3Deserializer::ClipContiguousMemoryCommonColumn(
-    core::Variable<T> &variable, const std::vector<char> &contiguousMemory,
+    core::Variable<T> &variable, const char *contiguousMemory,
     const Box<Dims> &blockBox, const Box<Dims> &intersectionBox) const
 {
     const Dims &start = intersectionBox.first;
@@ -462,8 +590,8 @@ void BP3Deserializer::ClipContiguousMemoryCommonColumn(
 
         char *rawVariableData = reinterpret_cast<char *>(variable.m_Data);
 
-        std::copy(contiguousMemory.begin() + contiguousStart,
-                  contiguousMemory.begin() + contiguousStart + stride,
+        std::copy(contiguousMemory + contiguousStart,
+                  contiguousMemory + contiguousStart + stride,
                   rawVariableData + variableStart);
 
         // here update each index recursively, always starting from the 2nd
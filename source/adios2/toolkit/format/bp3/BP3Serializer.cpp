@@ -12,10 +12,10 @@
 #include "BP3Serializer.tcc"
 
 #include <chrono>
-#include <future>
 #include <string>
 #include <vector>
 
+#include "adios2/ADIOSMPI.h"
 #include "adios2/helper/adiosFunctions.h" //helper::GetType<T>, helper::ReadValue<T>,
                                           // ReduceValue<T>
 
@@ -42,10 +42,24 @@ void BP3Serializer::PutProcessGroupIndex(
     ProfilerStart("buffering");
     std::vector<char> &metadataBuffer = m_MetadataSet.PGIndex.Buffer;
 
+    // chunks are sized for their variables, the header may not fit
+    if (m_ChunkedData && m_BufferChunkSize > 0)
+    {
+        const std::string timeStepName(std::to_string(m_MetadataSet.TimeStep));
+        const size_t pgHeaderSize = 8 + 1 + 2 + ioName.size() + 4 + 2 +
+                                    timeStepName.size() + 4 + 1 + 2 +
+                                    3 * (transportsTypes.size() + 1) + 12;
+        if (m_Data.m_Position + pgHeaderSize > m_Data.m_Buffer.capacity())
+        {
+            m_Data.NewChunk(m_BufferChunkSize, "for process group header");
+        }
+    }
+
     std::vector<char> &dataBuffer = m_Data.m_Buffer;
     size_t &dataPosition = m_Data.m_Position;
 
-    m_MetadataSet.DataPGLengthPosition = dataPosition;
+    const size_t pgStartPosition = dataPosition;
+    m_MetadataSet.DataPGLengthPosition = m_Data.m_ChunksSize + dataPosition;
     dataPosition += 8; // skip pg length (8)
 
     const std::size_t metadataPGLengthPosition = metadataBuffer.size();
@@ -105,11 +119,10 @@ void BP3Serializer::PutProcessGroupIndex(
     }
 
     // update absolute position
-    m_Data.m_AbsolutePosition +=
-        dataPosition - m_MetadataSet.DataPGLengthPosition;
+    m_Data.m_AbsolutePosition += dataPosition - pgStartPosition;
     // pg vars count and position
     m_MetadataSet.DataPGVarsCount = 0;
-    m_MetadataSet.DataPGVarsCountPosition = dataPosition;
+    m_MetadataSet.DataPGVarsCountPosition = m_Data.m_ChunksSize + dataPosition;
     // add vars count and length
     dataPosition += 12;
     m_Data.m_AbsolutePosition += 12; // add vars count and length
@@ -168,7 +181,7 @@ void BP3Serializer::CloseStream(core::IO &io, const bool addMetadata)
 
     if (m_Profiler.IsActive)
     {
-        m_Profiler.Bytes.at("buffering") += m_Data.m_Position;
+        m_Profiler.Bytes.at("buffering") += m_Data.GetSize();
     }
     ProfilerStop("buffering");
 }
@@ -230,6 +243,7 @@ std::string BP3Serializer::GetRankProfilingJSON(
     lf_WriterTimer(rankLog, profiler.Timers.at("memcpy"));
     lf_WriterTimer(rankLog, profiler.Timers.at("minmax"));
     lf_WriterTimer(rankLog, profiler.Timers.at("meta_sort_merge"));
+    lf_WriterTimer(rankLog, profiler.Timers.at("async_wait"));
 
     const size_t transportsSize = transportsTypes.size();
 
@@ -311,6 +325,33 @@ void BP3Serializer::AggregateCollectiveMetadata(MPI_Comm comm,
     ProfilerStop("buffering");
 }
 
+void BP3Serializer::AggregateMetadataRecord(MPI_Comm comm,
+                                            BufferSTL &bufferSTL,
+                                            const bool isFinal)
+{
+    // offsets are absolute, the record starts at m_AbsolutePosition
+    AggregateCollectiveMetadata(comm, bufferSTL, false);
+
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    if (rank == 0)
+    {
+        // reserved byte after endianness in the minifooter
+        const uint8_t record = isFinal ? static_cast<uint8_t>(
+                                             metadata_record_final)
+                                       : static_cast<uint8_t>(metadata_record);
+        size_t recordPosition = bufferSTL.m_Position - 3;
+        helper::CopyToBuffer(bufferSTL.m_Buffer, recordPosition, &record);
+    }
+
+    // next record only carries the following steps, attributes are written
+    // with the first step
+    m_MetadataSet.PGIndex.Buffer.clear();
+    m_MetadataSet.PGIndex.LastUpdatedPosition = 0;
+    m_MetadataSet.DataPGCount = 0;
+    ResetIndices();
+}
+
 void BP3Serializer::UpdateOffsetsInMetadata()
 {
     auto lf_UpdatePGIndexOffsets = [&]() {
@@ -442,7 +483,7 @@ void BP3Serializer::UpdateOffsetsInMetadata()
     };
 
     // BODY OF FUNCTION STARTS HERE
-    if (m_Aggregator.m_IsConsumer)
+    if (m_Aggregator->m_IsConsumer)
     {
         return;
     }
@@ -607,6 +648,110 @@ void BP3Serializer::PutNameRecord(const std::string name,
     helper::CopyToBuffer(buffer, position, name.c_str(), length);
 }
 
+const core::VariableBase::OperatorInfo *
+BP3Serializer::GetOperatorInfo(const core::VariableBase &variable) const
+    noexcept
+{
+    if (!m_ApplyOperators || variable.m_SingleValue)
+    {
+        return nullptr;
+    }
+
+    for (const auto &operatorInfo : variable.m_OperatorsInfo)
+    {
+        const std::string &type = operatorInfo.Op.m_Type;
+        if (type == "bzip2" || type == "zfp" || type == "SZ")
+        {
+            return &operatorInfo;
+        }
+    }
+    return nullptr;
+}
+
+void BP3Serializer::PutOperationRecord(const BPOpInfo &opInfo,
+                                       uint8_t &characteristicsCounter,
+                                       std::vector<char> &buffer) noexcept
+{
+    const uint8_t id = characteristic_transform_type;
+    helper::InsertToBuffer(buffer, &id);
+
+    PutNameRecord(opInfo.Type, buffer);
+    helper::InsertToBuffer(buffer, &opInfo.PreDataType);
+
+    const uint8_t dimensions = static_cast<uint8_t>(opInfo.PreCount.size());
+    helper::InsertToBuffer(buffer, &dimensions); // count
+    const uint16_t dimensionsLength = static_cast<uint16_t>(24 * dimensions);
+    helper::InsertToBuffer(buffer, &dimensionsLength); // length
+    PutDimensionsRecord(opInfo.PreCount, opInfo.PreShape, opInfo.PreStart,
+                        buffer);
+
+    // metadata length (2) is written at the end
+    const size_t metadataLengthPosition = buffer.size();
+    buffer.insert(buffer.end(), 2, '\0');
+
+    helper::InsertToBuffer(buffer, &opInfo.PreSize);
+    m_OperationPostSizeInIndex = buffer.size();
+    helper::InsertToBuffer(buffer, &opInfo.PostSize);
+
+    const uint8_t parametersCount =
+        static_cast<uint8_t>(opInfo.Parameters.size());
+    helper::InsertToBuffer(buffer, &parametersCount);
+    for (const auto &parameter : opInfo.Parameters)
+    {
+        PutNameRecord(parameter.first, buffer);
+        PutNameRecord(parameter.second, buffer);
+    }
+
+    const uint16_t metadataLength =
+        static_cast<uint16_t>(buffer.size() - metadataLengthPosition - 2);
+    size_t backPosition = metadataLengthPosition;
+    helper::CopyToBuffer(buffer, backPosition, &metadataLength);
+
+    ++characteristicsCounter;
+}
+
+void BP3Serializer::PutOperationRecord(const BPOpInfo &opInfo,
+                                       uint8_t &characteristicsCounter,
+                                       std::vector<char> &buffer,
+                                       size_t &position) noexcept
+{
+    const uint8_t id = characteristic_transform_type;
+    helper::CopyToBuffer(buffer, position, &id);
+
+    PutNameRecord(opInfo.Type, buffer, position);
+    helper::CopyToBuffer(buffer, position, &opInfo.PreDataType);
+
+    const uint8_t dimensions = static_cast<uint8_t>(opInfo.PreCount.size());
+    helper::CopyToBuffer(buffer, position, &dimensions); // count
+    const uint16_t dimensionsLength = static_cast<uint16_t>(24 * dimensions);
+    helper::CopyToBuffer(buffer, position, &dimensionsLength); // length
+    PutDimensionsRecord(opInfo.PreCount, opInfo.PreShape, opInfo.PreStart,
+                        buffer, position, true);
+
+    const size_t metadataLengthPosition = position;
+    position += 2; // skip metadata length
+
+    helper::CopyToBuffer(buffer, position, &opInfo.PreSize);
+    m_OperationPostSizeInData = position;
+    helper::CopyToBuffer(buffer, position, &opInfo.PostSize);
+
+    const uint8_t parametersCount =
+        static_cast<uint8_t>(opInfo.Parameters.size());
+    helper::CopyToBuffer(buffer, position, &parametersCount);
+    for (const auto &parameter : opInfo.Parameters)
+    {
+        PutNameRecord(parameter.first, buffer, position);
+        PutNameRecord(parameter.second, buffer, position);
+    }
+
+    const uint16_t metadataLength =
+        static_cast<uint16_t>(position - metadataLengthPosition - 2);
+    size_t backPosition = metadataLengthPosition;
+    helper::CopyToBuffer(buffer, backPosition, &metadataLength);
+
+    ++characteristicsCounter;
+}
+
 BP3Serializer::SerialElementIndex &BP3Serializer::GetSerialElementIndex(
     const std::string &name,
     std::unordered_map<std::string, SerialElementIndex> &indices,
@@ -627,18 +772,21 @@ BP3Serializer::SerialElementIndex &BP3Serializer::GetSerialElementIndex(
 
 void BP3Serializer::SerializeDataBuffer(core::IO &io) noexcept
 {
-    auto &buffer = m_Data.m_Buffer;
     auto &position = m_Data.m_Position;
     auto &absolutePosition = m_Data.m_AbsolutePosition;
 
+    // PG header can be in a previous chunk
+    size_t varsCountPosition = m_MetadataSet.DataPGVarsCountPosition;
+    std::vector<char> &varsCountChunk = m_Data.GetChunk(varsCountPosition);
+
     // vars count and Length (only for PG)
-    helper::CopyToBuffer(buffer, m_MetadataSet.DataPGVarsCountPosition,
+    helper::CopyToBuffer(varsCountChunk, varsCountPosition,
                          &m_MetadataSet.DataPGVarsCount);
     // without record itself and vars count
     const uint64_t varsLength =
-        position - m_MetadataSet.DataPGVarsCountPosition - 8 - 4;
-    helper::CopyToBuffer(buffer, m_MetadataSet.DataPGVarsCountPosition,
-                         &varsLength);
+        m_Data.GetSize() - m_MetadataSet.DataPGVarsCountPosition - 8 - 4 +
+        m_Data.GetReferencesSize(m_MetadataSet.DataPGVarsCountPosition);
+    helper::CopyToBuffer(varsCountChunk, varsCountPosition, &varsLength);
 
     // attributes are only written once
 
@@ -660,8 +808,10 @@ void BP3Serializer::SerializeDataBuffer(core::IO &io) noexcept
 
     // Finish writing pg group length without record itself
     const uint64_t dataPGLength =
-        position - m_MetadataSet.DataPGLengthPosition - 8;
-    helper::CopyToBuffer(buffer, m_MetadataSet.DataPGLengthPosition,
+        m_Data.GetSize() - m_MetadataSet.DataPGLengthPosition - 8 +
+        m_Data.GetReferencesSize(m_MetadataSet.DataPGLengthPosition);
+    size_t pgLengthPosition = m_MetadataSet.DataPGLengthPosition;
+    helper::CopyToBuffer(m_Data.GetChunk(pgLengthPosition), pgLengthPosition,
                          &dataPGLength);
 
     m_MetadataSet.DataPGIsOpen = false;
@@ -863,81 +1013,138 @@ void BP3Serializer::AggregateMergeIndex(
     const std::unordered_map<std::string, SerialElementIndex> &indices,
     MPI_Comm comm, BufferSTL &bufferSTL)
 {
-    // first serialize index
-    std::vector<char> serializedIndices = SerializeIndices(indices, comm);
-    // gather in rank 0
-    std::vector<char> gatheredSerialIndices;
-    size_t gatheredSerialIndicesPosition = 0;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // binomial tree: rank r > 0 has parent r - lowbit(r) and children
+    // r + 2^k for 2^k < lowbit(r), subtrees hold consecutive ranks
+    const int lowBit = (rank == 0) ? size : (rank & -rank);
+    std::vector<int> children;
+    for (int distance = 1; distance < lowBit && rank + distance < size;
+         distance <<= 1)
+    {
+        children.push_back(rank + distance);
+    }
 
-    helper::GathervVectors(serializedIndices, gatheredSerialIndices,
-                           gatheredSerialIndicesPosition, comm);
+    const std::vector<char> serializedIndices = SerializeIndices(indices);
 
-    // deallocate local serialized Indices
-    std::vector<char>().swap(serializedIndices);
+    // leaves send their own indices unmerged
+    if (children.empty() && rank != 0)
+    {
+        SendSubtreeIndices(serializedIndices, serializedIndices.size(),
+                           rank - lowBit, comm);
+        return;
+    }
 
-    // deserialize in [name][rank] order
-    const std::unordered_map<std::string, std::vector<SerialElementIndex>>
-        nameRankIndices =
-            DeserializeIndicesPerRankThreads(gatheredSerialIndices, comm);
+    // [name][source], source 0 is own, source c + 1 is subtree of children[c]
+    std::unordered_map<std::string, std::vector<SerialElementIndex>>
+        nameSourceIndices;
+    const size_t sources = children.size() + 1;
+    DeserializeIndicesPerSourceThreads(serializedIndices, 0, sources,
+                                       nameSourceIndices);
+    size_t subtreeSize = serializedIndices.size();
+
+    // children subtrees are already merged in rank order, receive in order
+    for (size_t c = 0; c < children.size(); ++c)
+    {
+        size_t childSize = 0;
+        MPI_Status status;
+        helper::CheckMPIReturn(MPI_Recv(&childSize, 1, ADIOS2_MPI_SIZE_T,
+                                        children[c], 0, comm, &status),
+                               ", in call to AggregateMergeIndex receiving "
+                               "subtree metadata size\n");
+
+        if (childSize == 0)
+        {
+            continue;
+        }
 
-    // deallocate gathered serial indices (full in rank 0 only)
-    std::vector<char>().swap(gatheredSerialIndices);
+        std::vector<char> childIndices(childSize);
+        helper::CheckMPIReturn(MPI_Recv(childIndices.data(),
+                                        static_cast<int>(childSize), MPI_CHAR,
+                                        children[c], 1, comm, &status),
+                               ", in call to AggregateMergeIndex receiving "
+                               "subtree metadata\n");
 
-    int rank;
-    MPI_Comm_rank(comm, &rank);
+        DeserializeIndicesPerSourceThreads(childIndices, c + 1, sources,
+                                           nameSourceIndices);
+        subtreeSize += childSize;
+    }
 
-    if (rank == 0)
+    if (rank != 0)
     {
-        // to write count and length
-        auto &buffer = bufferSTL.m_Buffer;
-        auto &position = bufferSTL.m_Position;
-        size_t countPosition = position;
+        // merged indices can only be smaller than their sources
+        BufferSTL mergedIndices;
+        mergedIndices.Resize(subtreeSize, ", in call to AggregateMergeIndex "
+                                          "merging subtree metadata");
+        MergeSerializeIndices(nameSourceIndices, comm, mergedIndices);
+        std::unordered_map<std::string, std::vector<SerialElementIndex>>()
+            .swap(nameSourceIndices);
+
+        SendSubtreeIndices(mergedIndices.m_Buffer, mergedIndices.m_Position,
+                           rank - lowBit, comm);
+        return;
+    }
 
-        // Write count
-        position += 12;
-        bufferSTL.Resize(position + gatheredSerialIndicesPosition +
-                             m_MetadataSet.MiniFooterSize,
-                         ", in call to AggregateMergeIndex BP3 metadata");
-        const uint32_t totalCountU32 =
-            static_cast<uint32_t>(nameRankIndices.size());
-        helper::CopyToBuffer(buffer, countPosition, &totalCountU32);
+    // to write count and length
+    auto &buffer = bufferSTL.m_Buffer;
+    auto &position = bufferSTL.m_Position;
+    size_t countPosition = position;
 
-        MergeSerializeIndices(nameRankIndices, comm, bufferSTL);
+    // Write count
+    position += 12;
+    bufferSTL.Resize(position + subtreeSize + m_MetadataSet.MiniFooterSize,
+                     ", in call to AggregateMergeIndex BP3 metadata");
+    const uint32_t totalCountU32 =
+        static_cast<uint32_t>(nameSourceIndices.size());
+    helper::CopyToBuffer(buffer, countPosition, &totalCountU32);
 
-        // Write length
-        const uint64_t totalLengthU64 =
-            static_cast<uint64_t>(position - countPosition - 8);
-        helper::CopyToBuffer(buffer, countPosition, &totalLengthU64);
+    MergeSerializeIndices(nameSourceIndices, comm, bufferSTL);
+
+    // Write length
+    const uint64_t totalLengthU64 =
+        static_cast<uint64_t>(position - countPosition - 8);
+    helper::CopyToBuffer(buffer, countPosition, &totalLengthU64);
+}
+
+void BP3Serializer::SendSubtreeIndices(const std::vector<char> &serialized,
+                                       const size_t size, const int parent,
+                                       MPI_Comm comm)
+{
+    helper::CheckMPIReturn(
+        MPI_Send(&size, 1, ADIOS2_MPI_SIZE_T, parent, 0, comm),
+        ", in call to AggregateMergeIndex sending subtree metadata size\n");
+
+    if (size == 0)
+    {
+        return;
     }
+
+    helper::CheckMPIReturn(MPI_Send(serialized.data(), static_cast<int>(size),
+                                    MPI_CHAR, parent, 1, comm),
+                           ", in call to AggregateMergeIndex sending subtree "
+                           "metadata\n");
 }
 
 std::vector<char> BP3Serializer::SerializeIndices(
-    const std::unordered_map<std::string, SerialElementIndex> &indices,
-    MPI_Comm comm) const noexcept
+    const std::unordered_map<std::string, SerialElementIndex> &indices) const
+    noexcept
 {
     // pre-allocate
     size_t serializedIndicesSize = 0;
     for (const auto &indexPair : indices)
     {
         const SerialElementIndex &index = indexPair.second;
-        serializedIndicesSize += 4 + index.Buffer.size();
+        serializedIndicesSize += index.Buffer.size();
     }
 
     std::vector<char> serializedIndices;
     serializedIndices.reserve(serializedIndicesSize);
 
-    int rank;
-    MPI_Comm_rank(comm, &rank);
-
     for (const auto &indexPair : indices)
     {
         const SerialElementIndex &index = indexPair.second;
-
-        // add rank at the beginning
-        const uint32_t rankSource = static_cast<uint32_t>(rank);
-        helper::InsertToBuffer(serializedIndices, &rankSource);
-
-        // insert buffer
         helper::InsertToBuffer(serializedIndices, index.Buffer.data(),
                                index.Buffer.size());
     }
@@ -945,15 +1152,13 @@ std::vector<char> BP3Serializer::SerializeIndices(
     return serializedIndices;
 }
 
-std::unordered_map<std::string, std::vector<BP3Base::SerialElementIndex>>
-BP3Serializer::DeserializeIndicesPerRankThreads(
-    const std::vector<char> &serialized, MPI_Comm comm) const noexcept
-{
+void BP3Serializer::DeserializeIndicesPerSourceThreads(
+    const std::vector<char> &serialized, const size_t source,
+    const size_t sources,
     std::unordered_map<std::string, std::vector<SerialElementIndex>>
-        deserialized;
-
-    auto lf_Deserialize = [&](const int rankSource,
-                              const size_t serializedPosition) {
+        &nameSourceIndices) const
+{
+    auto lf_Deserialize = [&](const size_t serializedPosition) {
 
         size_t localPosition = serializedPosition;
         ElementIndexHeader header =
@@ -964,102 +1169,53 @@ BP3Serializer::DeserializeIndicesPerRankThreads(
         {
             std::lock_guard<std::mutex> lock(m_Mutex);
             deserializedIndexes =
-                &(deserialized
+                &(nameSourceIndices
                       .emplace(std::piecewise_construct,
                                std::forward_as_tuple(header.Name),
                                std::forward_as_tuple(
-                                   m_SizeMPI,
+                                   sources,
                                    SerialElementIndex(header.MemberID, 0)))
                       .first->second);
         }
 
         const size_t bufferSize = static_cast<size_t>(header.Length) + 4;
-        SerialElementIndex &index = deserializedIndexes->at(rankSource);
+        SerialElementIndex &index = deserializedIndexes->at(source);
         helper::InsertToBuffer(index.Buffer, &serialized[serializedPosition],
                                bufferSize);
     };
 
     // BODY OF FUNCTION starts here
     const size_t serializedSize = serialized.size();
-    int rank;
-    MPI_Comm_rank(comm, &rank);
-
-    if (rank != 0 || serializedSize < 8)
-    {
-        return deserialized;
-    }
-
     size_t serializedPosition = 0;
 
     if (m_Threads == 1)
     {
-        while (serializedPosition < serializedSize)
+        while (serializedPosition + 4 <= serializedSize)
         {
-            const int rankSource = static_cast<int>(
-                helper::ReadValue<uint32_t>(serialized, serializedPosition));
-
-            if (serializedPosition <= serializedSize)
-            {
-                lf_Deserialize(rankSource, serializedPosition);
-            }
+            lf_Deserialize(serializedPosition);
 
             const size_t bufferSize = static_cast<size_t>(
                 helper::ReadValue<uint32_t>(serialized, serializedPosition));
             serializedPosition += bufferSize;
         }
-
-        return deserialized;
+        return;
     }
 
-    std::vector<std::future<void>> asyncs(m_Threads);
-    std::vector<size_t> asyncPositions(m_Threads);
-    std::vector<int> asyncRankSources(m_Threads);
-
-    bool launched = false;
+    // positions are found serially, deserialized on m_Threads
+    std::vector<size_t> positions;
 
-    while (serializedPosition < serializedSize)
+    while (serializedPosition + 4 <= serializedSize)
     {
-        // extract rank and index buffer size
-        for (unsigned int t = 0; t < m_Threads; ++t)
-        {
-            if (serializedPosition >= serializedSize)
-            {
-                break;
-            }
-
-            const int rankSource = static_cast<int>(
-                helper::ReadValue<uint32_t>(serialized, serializedPosition));
-            asyncRankSources[t] = rankSource;
-            asyncPositions[t] = serializedPosition;
-
-            const size_t bufferSize = static_cast<size_t>(
-                helper::ReadValue<uint32_t>(serialized, serializedPosition));
-            serializedPosition += bufferSize;
-
-            if (launched)
-            {
-                asyncs[t].get();
-            }
-
-            if (serializedPosition <= serializedSize)
-            {
-                asyncs[t] = std::async(std::launch::async, lf_Deserialize,
-                                       asyncRankSources[t], asyncPositions[t]);
-            }
-        }
-
-        launched = true;
-    }
+        positions.push_back(serializedPosition);
 
-    for (auto &async : asyncs)
-    {
-        if (async.valid())
-        {
-            async.wait();
-        }
+        const size_t bufferSize = static_cast<size_t>(
+            helper::ReadValue<uint32_t>(serialized, serializedPosition));
+        serializedPosition += bufferSize;
     }
 
-    return deserialized;
+    helper::RunTasks(m_ThreadPool, positions.size(),
+                     [&](const size_t i) { lf_Deserialize(positions[i]); },
+                     m_Threads);
 }
 
 void BP3Serializer::MergeSerializeIndices(
@@ -1492,9 +1648,6 @@ void BP3Serializer::MergeSerializeIndices(
     const size_t stride = elements / m_Threads;        // elements per thread
     const size_t last = stride + elements % m_Threads; // remainder to last
 
-    std::vector<std::thread> threads;
-    threads.reserve(m_Threads);
-
     // copy names in order to use threads
     std::vector<std::string> names;
     names.reserve(nameRankIndices.size());
@@ -1504,25 +1657,16 @@ void BP3Serializer::MergeSerializeIndices(
         names.push_back(nameRankIndexPair.first);
     }
 
-    for (unsigned int t = 0; t < m_Threads; ++t)
-    {
-        const size_t start = stride * t;
-        size_t end = start + stride;
-
-        if (t == m_Threads - 1)
-        {
-            end = start + last;
-        }
-
-        threads.push_back(
-            std::thread(lf_MergeRankRange, std::ref(nameRankIndices),
-                        std::ref(names), start, end, std::ref(bufferSTL)));
-    }
-
-    for (auto &thread : threads)
-    {
-        thread.join();
-    }
+    helper::RunTasks(m_ThreadPool, m_Threads,
+                     [&](const size_t t) {
+                         const size_t start = stride * t;
+                         const size_t end = (t == m_Threads - 1)
+                                                ? start + last
+                                                : start + stride;
+                         lf_MergeRankRange(nameRankIndices, names, start, end,
+                                           bufferSTL);
+                     },
+                     m_Threads);
 }
 
 std::vector<char>
@@ -1566,9 +1710,9 @@ BP3Serializer::SetCollectiveProfilingJSON(const std::string &rankLog) const
 
 uint32_t BP3Serializer::GetFileIndex() const noexcept
 {
-    if (m_Aggregator.m_IsActive)
+    if (m_Aggregator->m_IsActive)
     {
-        return static_cast<uint32_t>(m_Aggregator.m_SubStreamIndex);
+        return static_cast<uint32_t>(m_Aggregator->m_SubStreamIndex);
     }
 
     return static_cast<uint32_t>(m_RankMPI);
@@ -1606,12 +1750,18 @@ size_t BP3Serializer::GetAttributesSizeInData(core::IO &io) const noexcept
 
 #define declare_template_instantiation(T)                                      \
     template void BP3Serializer::PutVariablePayload(                           \
-        const core::Variable<T> &,                                             \
-        const typename core::Variable<T>::Info &) noexcept;                    \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
+        const bool);                                                           \
+                                                                               \
+    template bool BP3Serializer::IsDeferredByReference(                        \
+        const core::Variable<T> &) const noexcept;                             \
                                                                                \
     template void BP3Serializer::PutVariableMetadata(                          \
-        const core::Variable<T> &,                                             \
-        const typename core::Variable<T>::Info &) noexcept;
+        const core::Variable<T> &, const typename core::Variable<T>::Info &);  \
+                                                                               \
+    template size_t BP3Serializer::GetPayloadSizeInData(                       \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &)   \
+        const noexcept;
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
@@ -29,6 +29,16 @@ class BP3Serializer : public BP3Base
 public:
     std::set<std::string> m_DeferredVariables;
     size_t m_DeferredVariablesDataSize = 0;
+
+    /** true: apply Variable operators (e.g. compression) to array payloads,
+     * set by engines whose readers decompress through BP3Deserializer */
+    bool m_ApplyOperators = false;
+
+    /** true: array min and max are computed while copying the payload in
+     * PutVariablePayload, set by engines that always call PutVariablePayload
+     * right after PutVariableMetadata */
+    bool m_FuseMinMax = false;
+
     /**
      * Unique constructor
      * @param mpiComm MPI communicator for BP1 Aggregator
@@ -54,18 +64,42 @@ public:
      * @param variable
      */
     template <class T>
-    void PutVariableMetadata(
-        const core::Variable<T> &variable,
-        const typename core::Variable<T>::Info &blockInfo) noexcept;
+    void PutVariableMetadata(const core::Variable<T> &variable,
+                             const typename core::Variable<T>::Info &blockInfo);
 
     /**
      * Put in buffer variable payload. Expensive part.
      * @param variable payload input from m_PutValues
+     * @param byReference true: blockInfo.Data is referenced in m_Data
+     * instead of copied, from IsDeferredByReference
+     */
+    template <class T>
+    void PutVariablePayload(const core::Variable<T> &variable,
+                            const typename core::Variable<T>::Info &blockInfo,
+                            const bool byReference = false);
+
+    /**
+     * True if deferred payloads of variable can be referenced instead of
+     * copied: DeferredByReference is On, m_ChunkedData is set, and the
+     * variable is an array without operators
+     * @param variable input
      */
     template <class T>
-    void PutVariablePayload(
+    bool IsDeferredByReference(const core::Variable<T> &variable) const
+        noexcept;
+
+    /**
+     * Returns the size in bytes to reserve in data for a block payload,
+     * includes the worst case size of an operator output and its
+     * characteristic
+     * @param variable input
+     * @param blockInfo input
+     * @return payload size in data buffer
+     */
+    template <class T>
+    size_t GetPayloadSizeInData(
         const core::Variable<T> &variable,
-        const typename core::Variable<T>::Info &blockInfo) noexcept;
+        const typename core::Variable<T>::Info &blockInfo) const noexcept;
 
     /**
      *  Serializes data buffer and close current process group
@@ -133,6 +167,18 @@ public:
     void AggregateCollectiveMetadata(MPI_Comm comm, BufferSTL &bufferSTL,
                                      const bool inMetadataBuffer);
 
+    /**
+     * IncrementalMetadata: aggregates the indices serialized since the
+     * previous record as a metadata record, with offsets from the start of
+     * the metadata file and a flagged minifooter, then resets the indices
+     * @param comm all ranks
+     * @param bufferSTL metadata buffer, m_AbsolutePosition is the record
+     * position in the metadata file, only filled on rank 0
+     * @param isFinal true: flags the last record of the file
+     */
+    void AggregateMetadataRecord(MPI_Comm comm, BufferSTL &bufferSTL,
+                                 const bool isFinal);
+
     /**
      * Updates variable and payload offsets in metadata characteristics with
      * the updated Buffer m_DataAbsolutePosition for a particular rank. This is
@@ -146,6 +192,19 @@ private:
 
     static std::mutex m_Mutex;
 
+    /** positions updated with the operator output size in
+     * PutOperationPayloadInBuffer */
+    size_t m_VarLengthPosition = 0;
+    size_t m_OperationPostSizeInData = 0;
+    size_t m_OperationPostSizeInIndex = 0;
+    SerialElementIndex *m_OperationIndex = nullptr;
+
+    /** positions of array min values backpatched in PutMinMax when min max
+     * are fused with the payload copy, max follows each min record */
+    size_t m_MinPositionInData = 0;
+    size_t m_MinPositionInIndex = 0;
+    SerialElementIndex *m_MinMaxIndex = nullptr;
+
     /**
      * Put in BP buffer all attributes defined in an IO object.
      * Called by SerializeData function
@@ -211,11 +270,13 @@ private:
     /**
      * Get variable statistics
      * @param variable
+     * @param computeMinMax false: min and max are computed later with the
+     * payload copy
      * @return stats BP3 Stats
      */
     template <class T>
-    Stats<T>
-    GetBPStats(const typename core::Variable<T>::Info &blockInfo) noexcept;
+    Stats<T> GetBPStats(const typename core::Variable<T>::Info &blockInfo,
+                        const bool computeMinMax = true);
 
     template <class T>
     void
@@ -313,6 +374,32 @@ private:
                                  const T &value, std::vector<char> &buffer,
                                  size_t &position) noexcept;
 
+    /**
+     * Returns the first operator supported in BP3 payloads (bzip2, zfp, SZ),
+     * callbacks are ignored
+     * @param variable input
+     * @return pointer to operator info, nullptr if variable is not operated
+     */
+    const core::VariableBase::OperatorInfo *
+    GetOperatorInfo(const core::VariableBase &variable) const noexcept;
+
+    /**
+     * Writes the operation characteristic (characteristic_transform_type)
+     * to metadata index, output size is updated in PutOperationPayloadInBuffer
+     * @param opInfo input
+     * @param characteristicsCounter to be updated by 1
+     * @param buffer metadata index buffer
+     */
+    void PutOperationRecord(const BPOpInfo &opInfo,
+                            uint8_t &characteristicsCounter,
+                            std::vector<char> &buffer) noexcept;
+
+    /** Overloaded version for data buffer */
+    void PutOperationRecord(const BPOpInfo &opInfo,
+                            uint8_t &characteristicsCounter,
+                            std::vector<char> &buffer,
+                            size_t &position) noexcept;
+
     /**
      * Returns corresponding serial index, if doesn't exists creates a
      * new one. Used for variables and attributes
@@ -362,7 +449,9 @@ private:
 
     /**
      * Collective operation to aggregate and merge (sort) indices (variables and
-     * attributes)
+     * attributes) over a binomial tree of comm ranks. Each rank merges its
+     * children subtrees with its own indices and sends them to its parent, so
+     * rank 0 merges only log(size) pre-merged sets
      * @param indices
      */
     void AggregateMergeIndex(
@@ -370,23 +459,40 @@ private:
         MPI_Comm comm, BufferSTL &bufferSTL);
 
     /**
-     * Returns a serialized buffer with all indices with format:
-     * Rank (4 bytes), Buffer
+     * Sends serialized (merged) indices of a subtree to parent rank: size
+     * (tag 0), then buffer (tag 1) if not empty
+     * @param serialized input indices buffers
+     * @param size bytes in serialized to be sent
+     * @param parent rank in comm
+     */
+    void SendSubtreeIndices(const std::vector<char> &serialized,
+                            const size_t size, const int parent,
+                            MPI_Comm comm);
+
+    /**
+     * Returns a serialized buffer with all indices buffers, one after the
+     * other, each starting with its length
      * @param indices input of all indices to be serialized
      * @return buffer with serialized indices
      */
     std::vector<char> SerializeIndices(
-        const std::unordered_map<std::string, SerialElementIndex> &indices,
-        MPI_Comm comm) const noexcept;
+        const std::unordered_map<std::string, SerialElementIndex> &indices)
+        const noexcept;
 
     /**
-     * In rank=0, deserialize gathered indices
-     * @param serializedIndices input gathered indices
-     * @return hash[name][rank] = bp index buffer
+     * Deserialize indices received from a subtree into
+     * nameSourceIndices[name][source], new names get sources empty indices
+     * @param serialized input indices from SerializeIndices or
+     * MergeSerializeIndices
+     * @param source position of serialized in merge order
+     * @param sources number of merge sources
+     * @param nameSourceIndices hash[name][source] = bp index buffer
      */
-    std::unordered_map<std::string, std::vector<SerialElementIndex>>
-    DeserializeIndicesPerRankThreads(const std::vector<char> &serializedIndices,
-                                     MPI_Comm comm) const noexcept;
+    void DeserializeIndicesPerSourceThreads(
+        const std::vector<char> &serialized, const size_t source,
+        const size_t sources,
+        std::unordered_map<std::string, std::vector<SerialElementIndex>>
+            &nameSourceIndices) const;
 
     /**
      * Merge indices by time step (default) and write to m_HeapBuffer.m_Metadata
@@ -405,8 +511,31 @@ private:
      * @param variable input from which Payload is taken
      */
     template <class T>
-    void PutPayloadInBuffer(const core::Variable<T> &variable,
-                            const T *data) noexcept;
+    void PutPayloadInBuffer(const core::Variable<T> &variable, const T *data);
+
+    /**
+     * Inserts a reference to data in m_Data instead of copying it, min and
+     * max are computed in a separate pass if fused
+     * @param variable input from which Payload is taken
+     */
+    template <class T>
+    void PutPayloadReference(const core::Variable<T> &variable,
+                             const T *data);
+
+    /** Backpatches fused min and max in data and metadata index */
+    template <class T>
+    void PutMinMax(const T &min, const T &max) noexcept;
+
+    /**
+     * Applies the operator directly into the data buffer and updates the
+     * variable length and the operation output size in data and index
+     * @param blockInfo payload input
+     * @param operatorInfo from GetOperatorInfo
+     */
+    template <class T>
+    void PutOperationPayloadInBuffer(
+        const typename core::Variable<T>::Info &blockInfo,
+        const core::VariableBase::OperatorInfo &operatorInfo);
 
     template <class T>
     void UpdateIndexOffsetsCharacteristics(size_t &currentPosition,
@@ -424,12 +553,18 @@ private:
 
 #define declare_template_instantiation(T)                                      \
     extern template void BP3Serializer::PutVariablePayload(                    \
-        const core::Variable<T> &,                                             \
-        const typename core::Variable<T>::Info &) noexcept;                    \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &,   \
+        const bool);                                                           \
+                                                                               \
+    extern template bool BP3Serializer::IsDeferredByReference(                 \
+        const core::Variable<T> &) const noexcept;                             \
                                                                                \
     extern template void BP3Serializer::PutVariableMetadata(                   \
-        const core::Variable<T> &,                                             \
-        const typename core::Variable<T>::Info &) noexcept;
+        const core::Variable<T> &, const typename core::Variable<T>::Info &);  \
+                                                                               \
+    extern template size_t BP3Serializer::GetPayloadSizeInData(                \
+        const core::Variable<T> &, const typename core::Variable<T>::Info &)   \
+        const noexcept;
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
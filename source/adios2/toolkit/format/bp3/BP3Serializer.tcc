@@ -23,10 +23,10 @@ namespace format
 template <class T>
 inline void BP3Serializer::PutVariableMetadata(
     const core::Variable<T> &variable,
-    const typename core::Variable<T>::Info &blockInfo) noexcept
+    const typename core::Variable<T>::Info &blockInfo)
 {
     auto lf_SetOffset = [&](uint64_t &offset) {
-        if (m_Aggregator.m_IsActive && !m_Aggregator.m_IsConsumer)
+        if (m_Aggregator->m_IsActive && !m_Aggregator->m_IsConsumer)
         {
             offset = static_cast<uint64_t>(m_Data.m_Position);
         }
@@ -38,13 +38,36 @@ inline void BP3Serializer::PutVariableMetadata(
 
     ProfilerStart("buffering");
 
-    Stats<T> stats = GetBPStats<T>(blockInfo);
+    const core::VariableBase::OperatorInfo *operatorInfo =
+        GetOperatorInfo(variable);
+
+    // min max backpatched by PutPayloadInBuffer after a single pass on data
+    const bool fuseMinMax = m_FuseMinMax && m_StatsLevel == 0 &&
+                            operatorInfo == nullptr && !variable.m_SingleValue;
+
+    Stats<T> stats = GetBPStats<T>(blockInfo, !fuseMinMax);
 
     // Get new Index or point to existing index
     bool isNew = true; // flag to check if variable is new
     SerialElementIndex &variableIndex = GetSerialElementIndex(
         variable.m_Name, m_MetadataSet.VarsIndices, isNew);
     stats.MemberID = variableIndex.MemberID;
+    m_MinMaxIndex = fuseMinMax ? &variableIndex : nullptr;
+
+    if (operatorInfo != nullptr)
+    {
+        stats.Op.IsActive = true;
+        stats.Op.Type = operatorInfo->Op.m_Type;
+        stats.Op.Parameters = operatorInfo->Parameters;
+        stats.Op.PreDataType = GetDataType<T>();
+        stats.Op.PreShape = blockInfo.Shape;
+        stats.Op.PreStart = blockInfo.Start;
+        stats.Op.PreCount = blockInfo.Count;
+        stats.Op.PreSize =
+            static_cast<uint64_t>(helper::GetTotalSize(blockInfo.Count) *
+                                  sizeof(T));
+        m_OperationIndex = &variableIndex;
+    }
 
     lf_SetOffset(stats.Offset);
     PutVariableMetadataInData(variable, blockInfo, stats);
@@ -61,13 +84,84 @@ inline void BP3Serializer::PutVariableMetadata(
 template <class T>
 inline void BP3Serializer::PutVariablePayload(
     const core::Variable<T> &variable,
-    const typename core::Variable<T>::Info &blockInfo) noexcept
+    const typename core::Variable<T>::Info &blockInfo, const bool byReference)
 {
     ProfilerStart("buffering");
-    PutPayloadInBuffer(variable, blockInfo.Data);
+    const core::VariableBase::OperatorInfo *operatorInfo =
+        GetOperatorInfo(variable);
+
+    if (operatorInfo == nullptr)
+    {
+        if (byReference)
+        {
+            PutPayloadReference(variable, blockInfo.Data);
+        }
+        else
+        {
+            PutPayloadInBuffer(variable, blockInfo.Data);
+        }
+    }
+    else
+    {
+        PutOperationPayloadInBuffer<T>(blockInfo, *operatorInfo);
+    }
     ProfilerStop("buffering");
 }
 
+template <class T>
+bool BP3Serializer::IsDeferredByReference(
+    const core::Variable<T> &variable) const noexcept
+{
+    return m_DeferredByReference && m_ChunkedData &&
+           !std::is_same<T, std::string>::value && !variable.m_SingleValue &&
+           GetOperatorInfo(variable) == nullptr;
+}
+
+template <class T>
+size_t BP3Serializer::GetPayloadSizeInData(
+    const core::Variable<T> &variable,
+    const typename core::Variable<T>::Info &blockInfo) const noexcept
+{
+    const size_t payloadSize = variable.PayloadSize();
+    const core::VariableBase::OperatorInfo *operatorInfo =
+        GetOperatorInfo(variable);
+
+    if (operatorInfo == nullptr)
+    {
+        return payloadSize;
+    }
+
+    const core::Operator &op = operatorInfo->Op;
+    // operation characteristic: id + type + dimensions + metadata
+    size_t operationSize = 1 + 2 + op.m_Type.size() + 1 + 3 +
+                           24 * blockInfo.Count.size() + 2 + 16 + 1;
+    for (const auto &parameter : operatorInfo->Parameters)
+    {
+        operationSize += 4 + parameter.first.size() + parameter.second.size();
+    }
+
+    // worst case output of incompressible data
+    size_t outputSize = payloadSize;
+    if (op.m_Type == "zfp")
+    {
+#define declare_type(Z)                                                        \
+    if (helper::GetType<T>() == helper::GetType<Z>())                          \
+    {                                                                          \
+        outputSize =                                                           \
+            op.BufferMaxSize(reinterpret_cast<const Z *>(blockInfo.Data),      \
+                             blockInfo.Count, operatorInfo->Parameters);       \
+    }
+        ADIOS2_FOREACH_ZFP_TYPE_1ARG(declare_type)
+#undef declare_type
+    }
+    else
+    {
+        outputSize = op.BufferMaxSize(payloadSize);
+    }
+
+    return std::max(payloadSize, outputSize) + 2 * operationSize;
+}
+
 // PRIVATE
 template <class T>
 size_t
@@ -329,7 +423,8 @@ void BP3Serializer::PutAttributeInIndex(const core::Attribute<T> &attribute,
 
 template <>
 inline BP3Serializer::Stats<std::string> BP3Serializer::GetBPStats(
-    const typename core::Variable<std::string>::Info & /*blockInfo*/) noexcept
+    const typename core::Variable<std::string>::Info & /*blockInfo*/,
+    const bool /*computeMinMax*/)
 {
     Stats<std::string> stats;
     stats.Step = m_MetadataSet.TimeStep;
@@ -339,16 +434,17 @@ inline BP3Serializer::Stats<std::string> BP3Serializer::GetBPStats(
 
 template <class T>
 BP3Serializer::Stats<T> BP3Serializer::GetBPStats(
-    const typename core::Variable<T>::Info &blockInfo) noexcept
+    const typename core::Variable<T>::Info &blockInfo,
+    const bool computeMinMax)
 {
     Stats<T> stats;
     const std::size_t valuesSize = helper::GetTotalSize(blockInfo.Count);
 
-    if (m_StatsLevel == 0)
+    if (m_StatsLevel == 0 && computeMinMax)
     {
         ProfilerStart("minmax");
         helper::GetMinMaxThreads(blockInfo.Data, valuesSize, stats.Min,
-                                 stats.Max, m_Threads);
+                                 stats.Max, m_Threads, m_ThreadPool);
         ProfilerStop("minmax");
     }
     stats.Step = m_MetadataSet.TimeStep;
@@ -369,6 +465,7 @@ void BP3Serializer::PutVariableMetadataInData(
     // for writing length at the end
     const size_t varLengthPosition = position;
     position += 8; // skip var length (8)
+    m_VarLengthPosition = varLengthPosition;
 
     helper::CopyToBuffer(buffer, position, &stats.MemberID);
 
@@ -507,6 +604,7 @@ void BP3Serializer::PutBoundsRecord(const bool isScalar, const Stats<T> &stats,
     {
         if (m_StatsLevel == 0) // default verbose
         {
+            m_MinPositionInIndex = buffer.size() + 1; // skip id
             PutCharacteristicRecord(characteristic_min, characteristicsCounter,
                                     stats.Min, buffer);
 
@@ -537,6 +635,7 @@ void BP3Serializer::PutBoundsRecord(const bool singleValue,
     {
         if (m_StatsLevel == 0) // default min and max only
         {
+            m_MinPositionInData = position + 1; // skip id
             PutCharacteristicRecord(characteristic_min, characteristicsCounter,
                                     stats.Min, buffer, position);
 
@@ -603,6 +702,11 @@ inline void BP3Serializer::PutVariableCharacteristics(
                         buffer);
     ++characteristicsCounter;
 
+    if (stats.Op.IsActive)
+    {
+        PutOperationRecord(stats.Op, characteristicsCounter, buffer);
+    }
+
     PutCharacteristicRecord(characteristic_offset, characteristicsCounter,
                             stats.Offset, buffer);
 
@@ -656,6 +760,11 @@ void BP3Serializer::PutVariableCharacteristics(
                         buffer);
     ++characteristicsCounter;
 
+    if (stats.Op.IsActive)
+    {
+        PutOperationRecord(stats.Op, characteristicsCounter, buffer);
+    }
+
     PutCharacteristicRecord(characteristic_offset, characteristicsCounter,
                             stats.Offset, buffer);
 
@@ -704,6 +813,11 @@ void BP3Serializer::PutVariableCharacteristics(
     // VALUE for SCALAR or STAT min, max for ARRAY
     PutBoundsRecord(variable.m_SingleValue, stats, characteristicsCounter,
                     buffer, position);
+
+    if (stats.Op.IsActive)
+    {
+        PutOperationRecord(stats.Op, characteristicsCounter, buffer, position);
+    }
     // END OF CHARACTERISTICS
 
     // Back to characteristics count and length
@@ -719,7 +833,7 @@ void BP3Serializer::PutVariableCharacteristics(
 template <>
 inline void
 BP3Serializer::PutPayloadInBuffer(const core::Variable<std::string> &variable,
-                                  const std::string *data) noexcept
+                                  const std::string *data)
 {
     PutNameRecord(*data, m_Data.m_Buffer, m_Data.m_Position);
     m_Data.m_AbsolutePosition += data->size() + 2;
@@ -727,15 +841,93 @@ BP3Serializer::PutPayloadInBuffer(const core::Variable<std::string> &variable,
 
 template <class T>
 void BP3Serializer::PutPayloadInBuffer(const core::Variable<T> &variable,
-                                       const T *data) noexcept
+                                       const T *data)
 {
     ProfilerStart("memcpy");
-    helper::CopyToBufferThreads(m_Data.m_Buffer, m_Data.m_Position, data,
-                                variable.TotalSize(), m_Threads);
+    if (m_MinMaxIndex == nullptr)
+    {
+        helper::CopyToBufferThreads(m_Data.m_Buffer, m_Data.m_Position, data,
+                                    variable.TotalSize(), m_Threads,
+                                    m_ThreadPool);
+    }
+    else
+    {
+        T min, max;
+        helper::CopyToBufferMinMaxThreads(m_Data.m_Buffer, m_Data.m_Position,
+                                          data, variable.TotalSize(), min,
+                                          max, m_Threads, m_ThreadPool);
+        PutMinMax(min, max);
+    }
     ProfilerStop("memcpy");
     m_Data.m_AbsolutePosition += variable.PayloadSize();
 }
 
+template <class T>
+void BP3Serializer::PutPayloadReference(const core::Variable<T> &variable,
+                                        const T *data)
+{
+    if (m_MinMaxIndex != nullptr)
+    {
+        ProfilerStart("minmax");
+        T min, max;
+        helper::GetMinMaxThreads(data, variable.TotalSize(), min, max,
+                                 m_Threads, m_ThreadPool);
+        PutMinMax(min, max);
+        ProfilerStop("minmax");
+    }
+
+    m_Data.AddReference(reinterpret_cast<const char *>(data),
+                        variable.PayloadSize());
+    m_Data.m_AbsolutePosition += variable.PayloadSize();
+}
+
+template <class T>
+void BP3Serializer::PutMinMax(const T &min, const T &max) noexcept
+{
+    // max record follows min record: id (1) + value
+    size_t backPosition = m_MinPositionInData;
+    helper::CopyToBuffer(m_Data.m_Buffer, backPosition, &min);
+    ++backPosition;
+    helper::CopyToBuffer(m_Data.m_Buffer, backPosition, &max);
+
+    backPosition = m_MinPositionInIndex;
+    helper::CopyToBuffer(m_MinMaxIndex->Buffer, backPosition, &min);
+    ++backPosition;
+    helper::CopyToBuffer(m_MinMaxIndex->Buffer, backPosition, &max);
+
+    m_MinMaxIndex = nullptr;
+}
+
+template <class T>
+void BP3Serializer::PutOperationPayloadInBuffer(
+    const typename core::Variable<T>::Info &blockInfo,
+    const core::VariableBase::OperatorInfo &operatorInfo)
+{
+    auto &buffer = m_Data.m_Buffer;
+    auto &position = m_Data.m_Position;
+
+    const uint64_t outputSize =
+        static_cast<uint64_t>(operatorInfo.Op.Compress(
+            blockInfo.Data, blockInfo.Count, sizeof(T), helper::GetType<T>(),
+            buffer.data() + position, operatorInfo.Parameters));
+
+    position += static_cast<size_t>(outputSize);
+    m_Data.m_AbsolutePosition += static_cast<size_t>(outputSize);
+
+    // back to var length including operated payload size
+    const uint64_t varLength =
+        static_cast<uint64_t>(position - m_VarLengthPosition);
+    size_t backPosition = m_VarLengthPosition;
+    helper::CopyToBuffer(buffer, backPosition, &varLength);
+
+    // back to operation output size in data and metadata index
+    backPosition = m_OperationPostSizeInData;
+    helper::CopyToBuffer(buffer, backPosition, &outputSize);
+
+    backPosition = m_OperationPostSizeInIndex;
+    helper::CopyToBuffer(m_OperationIndex->Buffer, backPosition, &outputSize);
+}
+
 template <class T>
 void BP3Serializer::UpdateIndexOffsetsCharacteristics(size_t &currentPosition,
                                                       const DataTypes dataType,
@@ -833,7 +1025,11 @@ void BP3Serializer::UpdateIndexOffsetsCharacteristics(size_t &currentPosition,
                 3 * sizeof(uint64_t) * dimensionsSize + 2; // 2 is for length
             break;
         }
-        // TODO: implement operators
+        case (characteristic_transform_type):
+        {
+            ReadBPOpInfo(buffer, currentPosition);
+            break;
+        }
         default:
         {
             throw std::invalid_argument(
@@ -10,19 +10,31 @@
 
 #include "DataMan.tcc"
 
-#include <cstring> //std::memcpy
+#include <algorithm> //std::max, std::min_element
+#include <cstring>   //std::memcpy
 #include <iostream>
+#include <stdexcept> //std::invalid_argument
 
 namespace adios2
 {
 namespace format
 {
 
+constexpr char DataManSerializer::m_BinaryMetadataMarker;
+constexpr size_t DataManSerializer::m_ZeroCopyMinSize;
+
+DataManSerializer::DataManSerializer(const bool binaryMetadata,
+                                     const bool zeroCopy)
+: m_BinaryMetadata(binaryMetadata), m_ZeroCopy(zeroCopy)
+{
+}
+
 void DataManSerializer::New(size_t size)
 {
     m_Buffer = std::make_shared<std::vector<char>>();
     m_Buffer->reserve(size);
     m_Position = 0;
+    m_Segments.clear();
 }
 
 const std::shared_ptr<std::vector<char>> DataManSerializer::Get()
@@ -30,16 +42,101 @@ const std::shared_ptr<std::vector<char>> DataManSerializer::Get()
     return m_Buffer;
 }
 
-void DataManDeserializer::Put(std::shared_ptr<std::vector<char>> data)
+std::vector<std::pair<const char *, size_t>>
+DataManSerializer::GetSegments() const
 {
-    int key = rand();
-    m_MutexBuffer.lock();
-    while (m_BufferMap.count(key) > 0)
+    std::vector<std::pair<const char *, size_t>> segments;
+    if (!m_ZeroCopy)
     {
-        key = rand();
+        segments.emplace_back(m_Buffer->data(), m_Position);
+        return segments;
     }
-    m_BufferMap[key] = data;
-    m_MutexBuffer.unlock();
+
+    segments.reserve(m_Segments.size());
+    for (const Segment &segment : m_Segments)
+    {
+        segments.emplace_back(segment.Data == nullptr
+                                  ? m_Buffer->data() + segment.Position
+                                  : segment.Data,
+                              segment.Size);
+    }
+    return segments;
+}
+
+void DataManSerializer::PutBlock(const char *data, const size_t size)
+{
+    const uint32_t metasize = static_cast<uint32_t>(m_Metadata.size());
+    const bool reference = m_ZeroCopy && size >= m_ZeroCopyMinSize;
+    const size_t totalsize =
+        sizeof(metasize) + metasize + (reference ? 0 : size);
+    if (m_Buffer->capacity() < m_Position + totalsize)
+    {
+        m_Buffer->reserve(
+            std::max(m_Buffer->capacity() * 2, m_Position + totalsize));
+    }
+
+    m_Buffer->resize(m_Position + totalsize);
+
+    std::memcpy(m_Buffer->data() + m_Position, &metasize, sizeof(metasize));
+    m_Position += sizeof(metasize);
+
+    std::memcpy(m_Buffer->data() + m_Position, m_Metadata.data(), metasize);
+    m_Position += metasize;
+
+    if (!reference)
+    {
+        std::memcpy(m_Buffer->data() + m_Position, data, size);
+        m_Position += size;
+    }
+
+    if (!m_ZeroCopy)
+    {
+        return;
+    }
+
+    // extend the last m_Buffer segment, or start one
+    if (!m_Segments.empty() && m_Segments.back().Data == nullptr)
+    {
+        m_Segments.back().Size += totalsize;
+    }
+    else
+    {
+        m_Segments.push_back({nullptr, m_Position - totalsize, totalsize});
+    }
+    if (reference)
+    {
+        m_Segments.push_back({data, 0, size});
+    }
+}
+
+void DataManSerializer::PutVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        m_Metadata.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    m_Metadata.push_back(static_cast<char>(value));
+}
+
+void DataManSerializer::PutString(const std::string &value)
+{
+    PutVarint(value.size());
+    m_Metadata.insert(m_Metadata.end(), value.begin(), value.end());
+}
+
+void DataManSerializer::PutDims(const Dims &dims)
+{
+    PutVarint(dims.size());
+    for (const size_t dim : dims)
+    {
+        PutVarint(dim);
+    }
+}
+
+void DataManDeserializer::Put(std::shared_ptr<std::vector<char>> data)
+{
+    std::vector<DataManVar> vars;
     size_t position = 0;
     while (position < data->capacity())
     {
@@ -53,64 +150,206 @@ void DataManDeserializer::Put(std::shared_ptr<std::vector<char>> data)
         DataManVar var;
         try
         {
-            nlohmann::json metaj =
-                nlohmann::json::parse(data->data() + position);
+            const char *metadata = data->data() + position;
             position += metasize;
-            var.name = metaj["N"].get<std::string>();
-            var.type = metaj["Y"].get<std::string>();
-            var.shape = metaj["S"].get<Dims>();
-            var.count = metaj["C"].get<Dims>();
-            var.start = metaj["O"].get<Dims>();
-            var.step = metaj["T"].get<size_t>();
-            var.size = metaj["I"].get<size_t>();
-            var.rank = metaj["R"].get<int>();
-            var.doid = metaj["D"].get<std::string>();
+            GetMetadata(metadata, metasize, var);
             var.position = position;
-            var.index = key;
-            auto it = metaj.find("Z");
-            if (it != metaj.end())
-            {
-                var.compression = it->get<std::string>();
-            }
-            it = metaj.find("ZR");
-            if (it != metaj.end())
-            {
-                var.compressionRate = it->get<float>();
-            }
             if (position + var.size > data->capacity())
             {
                 break;
             }
-            m_MutexMetaData.lock();
-            if (m_MetaDataMap[var.step] == nullptr)
-            {
-                m_MetaDataMap[var.step] =
-                    std::make_shared<std::vector<DataManVar>>();
-            }
-            m_MetaDataMap[var.step]->push_back(std::move(var));
-            m_MutexMetaData.unlock();
             position += var.size;
+            vars.push_back(std::move(var));
         }
         catch (std::exception &e)
         {
             std::cout << e.what() << std::endl;
         }
-        m_MutexMaxMin.lock();
-        if (m_MaxStep < var.step)
+    }
+
+    std::lock_guard<std::mutex> l(m_Mutex);
+    int key = rand();
+    while (m_BufferMap.count(key) > 0)
+    {
+        key = rand();
+    }
+    m_BufferMap[key] = data;
+
+    size_t maxStep = m_MaxStep.load();
+    size_t minStep = m_MinStep.load();
+    for (DataManVar &var : vars)
+    {
+        var.index = key;
+        maxStep = std::max(maxStep, var.step);
+        minStep = std::min(minStep, var.step);
+        std::shared_ptr<std::vector<DataManVar>> &stepVars =
+            m_MetaDataMap[var.step];
+        if (stepVars == nullptr)
         {
-            m_MaxStep = var.step;
+            stepVars = std::make_shared<std::vector<DataManVar>>();
         }
-        if (m_MinStep > var.step)
+        stepVars->push_back(std::move(var));
+    }
+    m_MaxStep = maxStep;
+    m_MinStep = minStep;
+}
+
+void DataManDeserializer::GetMetadata(const char *metadata,
+                                      const size_t size, DataManVar &var)
+{
+    if (size > 0 && metadata[0] == DataManSerializer::m_BinaryMetadataMarker)
+    {
+        GetBinaryMetadata(metadata, size, var);
+    }
+    else
+    {
+        GetJsonMetadata(metadata, var);
+    }
+}
+
+void DataManDeserializer::GetJsonMetadata(const char *metadata,
+                                          DataManVar &var)
+{
+    nlohmann::json metaj = nlohmann::json::parse(metadata);
+    var.name = metaj["N"].get<std::string>();
+    var.type = metaj["Y"].get<std::string>();
+    var.shape = metaj["S"].get<Dims>();
+    var.count = metaj["C"].get<Dims>();
+    var.start = metaj["O"].get<Dims>();
+    var.step = metaj["T"].get<size_t>();
+    var.size = metaj["I"].get<size_t>();
+    var.rank = metaj["R"].get<int>();
+    var.doid = metaj["D"].get<std::string>();
+    auto it = metaj.find("Z");
+    if (it != metaj.end())
+    {
+        var.compression = it->get<std::string>();
+    }
+    it = metaj.find("ZR");
+    if (it != metaj.end())
+    {
+        var.compressionRate = it->get<float>();
+    }
+}
+
+void DataManDeserializer::GetBinaryMetadata(const char *metadata,
+                                            const size_t size,
+                                            DataManVar &var)
+{
+    // skip marker
+    size_t position = 1;
+
+    auto lf_GetVarint = [&]() -> uint64_t {
+        uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            if (position >= size)
+            {
+                break;
+            }
+            const uint8_t byte = static_cast<uint8_t>(metadata[position++]);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        throw std::invalid_argument("ERROR: truncated DataMan binary "
+                                    "metadata, in call to Put\n");
+    };
+
+    auto lf_GetString = [&]() -> std::string {
+        const size_t length = static_cast<size_t>(lf_GetVarint());
+        if (length > size - position)
         {
-            m_MinStep = var.step;
+            throw std::invalid_argument("ERROR: truncated DataMan binary "
+                                        "metadata, in call to Put\n");
         }
-        m_MutexMaxMin.unlock();
+        std::string value(metadata + position, length);
+        position += length;
+        return value;
+    };
+
+    auto lf_GetDims = [&]() -> Dims {
+        // each dimension takes at least one byte
+        const size_t dimensions = static_cast<size_t>(lf_GetVarint());
+        if (dimensions > size - position)
+        {
+            throw std::invalid_argument("ERROR: truncated DataMan binary "
+                                        "metadata, in call to Put\n");
+        }
+        Dims dims(dimensions);
+        for (size_t &dim : dims)
+        {
+            dim = static_cast<size_t>(lf_GetVarint());
+        }
+        return dims;
+    };
+
+    var.step = static_cast<size_t>(lf_GetVarint());
+    var.rank = static_cast<int>(lf_GetVarint());
+    var.size = static_cast<size_t>(lf_GetVarint());
+    var.name = lf_GetString();
+    var.type = lf_GetString();
+    var.doid = lf_GetString();
+    var.compression = lf_GetString();
+    if (!var.compression.empty())
+    {
+        if (sizeof(var.compressionRate) > size - position)
+        {
+            throw std::invalid_argument("ERROR: truncated DataMan binary "
+                                        "metadata, in call to Put\n");
+        }
+        std::memcpy(&var.compressionRate, metadata + position,
+                    sizeof(var.compressionRate));
+        position += sizeof(var.compressionRate);
     }
+    var.shape = lf_GetDims();
+    var.count = lf_GetDims();
+    var.start = lf_GetDims();
 }
 
 void DataManDeserializer::Erase(size_t step)
 {
-    m_MutexMetaData.lock();
+    m_Mutex.lock();
+    EraseLocked(step);
+    m_Mutex.unlock();
+
+    m_MutexBlocksIndex.lock();
+    m_BlocksIndexMap.erase(step);
+    m_MutexBlocksIndex.unlock();
+}
+
+bool DataManDeserializer::EraseOldest()
+{
+    m_Mutex.lock();
+    // m_MinStep might be missing, erased by EndStep or not received yet
+    const auto oldest = std::min_element(
+        m_MetaDataMap.begin(), m_MetaDataMap.end(),
+        [](const std::pair<const size_t,
+                           std::shared_ptr<std::vector<DataManVar>>> &a,
+           const std::pair<const size_t,
+                           std::shared_ptr<std::vector<DataManVar>>> &b) {
+            return a.first < b.first;
+        });
+    if (oldest == m_MetaDataMap.end() ||
+        (m_IsPinned && m_PinnedStep == oldest->first))
+    {
+        m_Mutex.unlock();
+        return false;
+    }
+    const size_t step = oldest->first;
+    EraseLocked(step);
+    m_Mutex.unlock();
+
+    m_MutexBlocksIndex.lock();
+    m_BlocksIndexMap.erase(step);
+    m_MutexBlocksIndex.unlock();
+    return true;
+}
+
+void DataManDeserializer::EraseLocked(size_t step)
+{
     const auto &i = m_MetaDataMap.find(step);
     if (i != m_MetaDataMap.end())
     {
@@ -118,36 +357,32 @@ void DataManDeserializer::Erase(size_t step)
         {
             if (BufferContainsSteps(k.index, step + 1, MaxStep()) == false)
             {
-                m_MutexBuffer.lock();
                 m_BufferMap.erase(k.index);
-                m_MutexBuffer.unlock();
             }
         }
     }
     m_MetaDataMap.erase(step);
-    m_MutexMetaData.unlock();
-
-    m_MutexMaxMin.lock();
     m_MinStep = step + 1;
-    m_MutexMaxMin.unlock();
+    if (m_IsPinned && m_PinnedStep == step)
+    {
+        m_IsPinned = false;
+    }
 }
 
-size_t DataManDeserializer::MaxStep()
-{
-    std::lock_guard<std::mutex> l(m_MutexMaxMin);
-    return m_MaxStep;
-}
+size_t DataManDeserializer::MaxStep() { return m_MaxStep; }
 
-size_t DataManDeserializer::MinStep()
+size_t DataManDeserializer::MinStep() { return m_MinStep; }
+
+size_t DataManDeserializer::Steps()
 {
-    std::lock_guard<std::mutex> l(m_MutexMaxMin);
-    return m_MinStep;
+    std::lock_guard<std::mutex> l(m_Mutex);
+    return m_MetaDataMap.size();
 }
 
 const std::shared_ptr<std::vector<DataManDeserializer::DataManVar>>
 DataManDeserializer::GetMetaData(size_t step)
 {
-    std::lock_guard<std::mutex> l(m_MutexMetaData);
+    std::lock_guard<std::mutex> l(m_Mutex);
     const auto &i = m_MetaDataMap.find(step);
     if (i != m_MetaDataMap.end())
     {
@@ -159,10 +394,24 @@ DataManDeserializer::GetMetaData(size_t step)
     }
 }
 
+const std::shared_ptr<std::vector<DataManDeserializer::DataManVar>>
+DataManDeserializer::PinMetaData(size_t step)
+{
+    std::lock_guard<std::mutex> l(m_Mutex);
+    const auto &i = m_MetaDataMap.find(step);
+    if (i == m_MetaDataMap.end())
+    {
+        return nullptr;
+    }
+    m_IsPinned = true;
+    m_PinnedStep = step;
+    return i->second;
+}
+
 bool DataManDeserializer::BufferContainsSteps(int index, size_t begin,
                                               size_t end)
 {
-    // This is a private function and is always called after m_MutexMetaData is
+    // This is a private function and is always called after m_Mutex is
     // locked, so there is no need to lock again here.
     for (size_t i = begin; i <= end; ++i)
     {
@@ -341,6 +590,66 @@ bool DataManDeserializer::GetOverlap(const Box<Dims> &b1, const Box<Dims> &b2,
     return true;
 }
 
+std::vector<size_t> DataManDeserializer::GetIntersectingVars(
+    const size_t step, const std::vector<DataManVar> &vars,
+    const size_t varsSize, const std::string &name, const Dims &start,
+    const Dims &count)
+{
+    std::lock_guard<std::mutex> l(m_MutexBlocksIndex);
+    BlocksIndex &blocksIndex = m_BlocksIndexMap[step][name];
+
+    if (blocksIndex.VarsSize != varsSize)
+    {
+        blocksIndex.VarsSize = varsSize;
+        blocksIndex.Positions.clear();
+        blocksIndex.DimensionsSize = 0;
+        std::vector<Box<Dims>> boxes;
+        bool sameDimensions = true;
+        for (size_t i = 0; i < varsSize; ++i)
+        {
+            const DataManVar &var = vars[i];
+            if (var.name != name)
+            {
+                continue;
+            }
+            if (var.start.size() != var.count.size() ||
+                (!boxes.empty() &&
+                 boxes.front().first.size() != var.start.size()))
+            {
+                sameDimensions = false;
+            }
+            boxes.push_back(helper::StartEndBox(var.start, var.count));
+            blocksIndex.Positions.push_back(i);
+        }
+
+        if (sameDimensions && !boxes.empty())
+        {
+            blocksIndex.DimensionsSize = boxes.front().first.size();
+            blocksIndex.Boxes = helper::BoxIndex(std::move(boxes));
+        }
+        else
+        {
+            blocksIndex.Boxes = helper::BoxIndex();
+        }
+    }
+
+    // single values and mismatching dimensions are checked one by one
+    if (blocksIndex.DimensionsSize == 0 ||
+        blocksIndex.DimensionsSize != count.size() ||
+        start.size() != count.size())
+    {
+        return blocksIndex.Positions;
+    }
+
+    std::vector<size_t> positions;
+    for (const size_t i :
+         blocksIndex.Boxes.Intersecting(helper::StartEndBox(start, count)))
+    {
+        positions.push_back(blocksIndex.Positions[i]);
+    }
+    return positions;
+}
+
 bool DataManDeserializer::IsContinuous(const Box<Dims> &inner,
                                        const Box<Dims> &outer)
 {
@@ -361,7 +670,7 @@ bool DataManDeserializer::IsContinuous(const Box<Dims> &inner,
 bool DataManDeserializer::GetVarList(size_t step,
                                      std::vector<DataManVar> &varList)
 {
-    m_MutexMetaData.lock();
+    std::lock_guard<std::mutex> l(m_Mutex);
     auto metaDataStep = m_MetaDataMap.find(step);
     if (metaDataStep == m_MetaDataMap.end())
     {
@@ -387,7 +696,6 @@ bool DataManDeserializer::GetVarList(size_t step,
             varList.push_back(std::move(var));
         }
     }
-    m_MutexMetaData.unlock();
     return true;
 }
 
@@ -15,7 +15,9 @@
 
 #include "adios2/ADIOSTypes.h"
 #include "adios2/core/Variable.h"
+#include "adios2/helper/adiosMath.h"
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -24,12 +26,41 @@ namespace adios2
 namespace format
 {
 
+/**
+ * Each variable block is serialized as uint32 metadata size, metadata, and
+ * payload. Metadata is either a null terminated JSON object or, starting
+ * with m_BinaryMetadataMarker, a compact binary record:
+ * varint step, varint rank, varint payload size, strings name, type, doid
+ * and compression (varint length + chars), float compression rate if
+ * compression is not empty, then shape, count and start dims (varint
+ * dimensions + varint values). Varints are little endian base 128.
+ */
 class DataManSerializer
 {
 public:
+    /** first metadata byte of binary records, JSON starts with '{' */
+    static constexpr char m_BinaryMetadataMarker = 'B';
+
+    /**
+     * @param binaryMetadata true: compact binary metadata, false: JSON
+     * @param zeroCopy true: uncompressed payloads of at least
+     * m_ZeroCopyMinSize bytes are referenced, not copied, see GetSegments
+     */
+    DataManSerializer(const bool binaryMetadata = false,
+                      const bool zeroCopy = false);
+
     void New(size_t size);
     const std::shared_ptr<std::vector<char>> Get();
 
+    /**
+     * Serialized step as ordered {address, size} segments pointing to Get()
+     * contents and, in zeroCopy mode, to variables data. Their concatenation
+     * is the same stream as Get() without zeroCopy.
+     * @return segments valid until the next New, Put, or variables data
+     * release
+     */
+    std::vector<std::pair<const char *, size_t>> GetSegments() const;
+
     template <class T>
     bool Put(core::Variable<T> &variable, std::string doid, size_t step,
              int rank, const Params &params);
@@ -48,6 +79,39 @@ private:
     std::shared_ptr<std::vector<char>> m_Buffer;
     std::vector<char> m_CompressBuffer;
     size_t m_Position = 0;
+
+    bool m_BinaryMetadata = false;
+    /** current block metadata, reused across Puts */
+    std::vector<char> m_Metadata;
+
+    /** smaller payloads are cheaper to copy than to send as message parts */
+    static constexpr size_t m_ZeroCopyMinSize = 64 * 1024;
+    bool m_ZeroCopy = false;
+
+    struct Segment
+    {
+        /** referenced payload, nullptr: m_Buffer at Position */
+        const char *Data;
+        size_t Position;
+        size_t Size;
+    };
+    /** zeroCopy mode only, m_Buffer might be reallocated by Puts */
+    std::vector<Segment> m_Segments;
+
+    /** Serializes the block metadata into m_Metadata */
+    template <class T>
+    void PutMetadata(const core::Variable<T> &variable,
+                     const std::string &doid, const size_t step,
+                     const int rank, const size_t size,
+                     const std::string &compression,
+                     const float compressionRate);
+
+    /** Appends metadata size, m_Metadata and payload to m_Buffer */
+    void PutBlock(const char *data, const size_t size);
+
+    void PutVarint(uint64_t value);
+    void PutString(const std::string &value);
+    void PutDims(const Dims &dims);
 };
 
 class DataManDeserializer
@@ -55,10 +119,25 @@ class DataManDeserializer
 public:
     size_t MaxStep();
     size_t MinStep();
+    /** @return number of steps buffered and not erased yet */
+    size_t Steps();
+    /** Parses all blocks of a message, then adds them under one lock */
     void Put(std::shared_ptr<std::vector<char>> data);
+    /**
+     * Copies the selection of variable at step into variable data
+     * @return 0: success, -1: step not found, -2: no metadata, -3: block of
+     * the step erased while reading
+     */
     template <class T>
     int Get(core::Variable<T> &variable, size_t step);
+    /** Erases step, unpins it if pinned */
     void Erase(size_t step);
+    /**
+     * Erases the oldest step, in the same lock as checking it is not pinned
+     * @return false if no step is buffered, or the oldest one is pinned and
+     * kept
+     */
+    bool EraseOldest();
     struct DataManVar
     {
         Dims shape;
@@ -77,8 +156,26 @@ public:
     };
     bool GetVarList(size_t step, std::vector<DataManVar> &varList);
     const std::shared_ptr<std::vector<DataManVar>> GetMetaData(size_t step);
+    /**
+     * GetMetaData, and if the step is found pins it: EraseOldest keeps it
+     * until Erase(step)
+     */
+    const std::shared_ptr<std::vector<DataManVar>> PinMetaData(size_t step);
 
 private:
+    /**
+     * Deserializes JSON or binary block metadata
+     * @param metadata
+     * @param size metadata size in bytes
+     * @param var output, all fields but position and index
+     * @throws std::invalid_argument if metadata is truncated
+     */
+    void GetMetadata(const char *metadata, const size_t size,
+                     DataManVar &var);
+    void GetJsonMetadata(const char *metadata, DataManVar &var);
+    void GetBinaryMetadata(const char *metadata, const size_t size,
+                           DataManVar &var);
+
     bool GetOverlap(const Box<Dims> &b1, const Box<Dims> &b2, Box<Dims> &o);
     bool IsContinuous(const Box<Dims> &inner, const Box<Dims> &outer);
     Dims GetRelativePosition(const Dims &inner, const Dims &outer);
@@ -92,15 +189,57 @@ private:
 
     bool BufferContainsSteps(int index, size_t begin, size_t end);
 
+    /** Erase without locking m_Mutex */
+    void EraseLocked(size_t step);
+
+    /** spatial index of the blocks of a variable in a step */
+    struct BlocksIndex
+    {
+        /** number of step blocks when built, rebuilt if more arrive */
+        size_t VarsSize = 0;
+        /** positions in the step metadata vector */
+        std::vector<size_t> Positions;
+        helper::BoxIndex Boxes;
+        /** blocks dimensions when all blocks have the same */
+        size_t DimensionsSize = 0;
+    };
+
+    /**
+     * Positions of the blocks of a variable in the step metadata vector
+     * intersecting a selection, using a per-step index built at first call
+     * @param step
+     * @param vars step metadata
+     * @param varsSize vars.size() read under m_Mutex
+     * @param name variable name
+     * @param start selection start
+     * @param count selection count
+     * @return ascending positions in vars
+     */
+    std::vector<size_t> GetIntersectingVars(const size_t step,
+                                            const std::vector<DataManVar> &vars,
+                                            const size_t varsSize,
+                                            const std::string &name,
+                                            const Dims &start,
+                                            const Dims &count);
+
     std::unordered_map<size_t, std::shared_ptr<std::vector<DataManVar>>>
         m_MetaDataMap;
     std::unordered_map<int, std::shared_ptr<std::vector<char>>> m_BufferMap;
-    size_t m_MaxStep = std::numeric_limits<size_t>::min();
-    size_t m_MinStep = std::numeric_limits<size_t>::max();
+    std::atomic<size_t> m_MaxStep{std::numeric_limits<size_t>::min()};
+    std::atomic<size_t> m_MinStep{std::numeric_limits<size_t>::max()};
+
+    /** step -> variable name -> blocks index, erased with the step */
+    std::unordered_map<size_t, std::unordered_map<std::string, BlocksIndex>>
+        m_BlocksIndexMap;
+
+    /** step read between BeginStep and EndStep, guarded by m_Mutex */
+    bool m_IsPinned = false;
+    size_t m_PinnedStep = 0;
 
-    std::mutex m_MutexMetaData;
-    std::mutex m_MutexBuffer;
-    std::mutex m_MutexMaxMin;
+    /** guards m_MetaDataMap, m_BufferMap and the pinned step, taken once
+     * per Put or Get */
+    std::mutex m_Mutex;
+    std::mutex m_MutexBlocksIndex;
 };
 
 } // end namespace format
@@ -29,25 +29,12 @@ template <class T>
 bool DataManSerializer::PutZfp(core::Variable<T> &variable, std::string doid,
                                size_t step, int rank, const Params &params)
 {
-    nlohmann::json metaj;
-
-    metaj["N"] = variable.m_Name;
-    metaj["Y"] = variable.m_Type;
-    metaj["S"] = variable.m_Shape;
-    metaj["C"] = variable.m_Count;
-    metaj["O"] = variable.m_Start;
-    metaj["T"] = step;
-    metaj["R"] = rank;
-    metaj["D"] = doid;
-    metaj["Z"] = "zfp";
-
     float rate = 2;
     const auto it = params.find("CompressionRate");
     if (it != params.end())
     {
         rate = stof(it->second);
     }
-    metaj["ZR"] = rate;
 
     Params p = {{"Rate", std::to_string(rate)}};
     core::compress::CompressZfp zfp(p, true);
@@ -63,27 +50,9 @@ bool DataManSerializer::PutZfp(core::Variable<T> &variable, std::string doid,
         std::cout << e.what() << std::endl;
         return PutRaw(variable, doid, step, rank, params);
     }
-    metaj["I"] = datasize;
-    std::string metastr = metaj.dump() + '\0';
-
-    uint32_t metasize = metastr.size();
-    size_t totalsize = sizeof(metasize) + metasize + datasize;
-    if (m_Buffer->capacity() < m_Position + totalsize)
-    {
-        m_Buffer->reserve(m_Buffer->capacity() * 2);
-    }
 
-    m_Buffer->resize(m_Position + totalsize);
-
-    std::memcpy(m_Buffer->data() + m_Position, &metasize, sizeof(metasize));
-    m_Position += sizeof(metasize);
-
-    std::memcpy(m_Buffer->data() + m_Position, metastr.c_str(), metasize);
-    m_Position += metasize;
-
-    std::memcpy(m_Buffer->data() + m_Position, m_CompressBuffer.data(),
-                datasize);
-    m_Position += datasize;
+    PutMetadata(variable, doid, step, rank, datasize, "zfp", rate);
+    PutBlock(m_CompressBuffer.data(), datasize);
     return true;
 }
 #endif
@@ -92,6 +61,44 @@ template <class T>
 bool DataManSerializer::PutRaw(core::Variable<T> &variable, std::string doid,
                                size_t step, int rank, const Params &params)
 {
+    const size_t datasize = variable.PayloadSize();
+    PutMetadata(variable, doid, step, rank, datasize, "", 0.f);
+    PutBlock(reinterpret_cast<const char *>(variable.GetData()), datasize);
+    return true;
+}
+
+template <class T>
+void DataManSerializer::PutMetadata(const core::Variable<T> &variable,
+                                    const std::string &doid,
+                                    const size_t step, const int rank,
+                                    const size_t size,
+                                    const std::string &compression,
+                                    const float compressionRate)
+{
+    m_Metadata.clear();
+
+    if (m_BinaryMetadata)
+    {
+        m_Metadata.push_back(m_BinaryMetadataMarker);
+        PutVarint(step);
+        PutVarint(static_cast<uint64_t>(rank));
+        PutVarint(size);
+        PutString(variable.m_Name);
+        PutString(variable.m_Type);
+        PutString(doid);
+        PutString(compression);
+        if (!compression.empty())
+        {
+            const char *rate = reinterpret_cast<const char *>(&compressionRate);
+            m_Metadata.insert(m_Metadata.end(), rate,
+                              rate + sizeof(compressionRate));
+        }
+        PutDims(variable.m_Shape);
+        PutDims(variable.m_Count);
+        PutDims(variable.m_Start);
+        return;
+    }
+
     nlohmann::json metaj;
 
     metaj["N"] = variable.m_Name;
@@ -102,28 +109,16 @@ bool DataManSerializer::PutRaw(core::Variable<T> &variable, std::string doid,
     metaj["T"] = step;
     metaj["R"] = rank;
     metaj["D"] = doid;
-    metaj["I"] = variable.PayloadSize();
-    std::string metastr = metaj.dump() + '\0';
-
-    uint32_t metasize = metastr.size();
-    size_t datasize = variable.PayloadSize();
-    size_t totalsize = sizeof(metasize) + metasize + datasize;
-    if (m_Buffer->capacity() < m_Position + totalsize)
+    metaj["I"] = size;
+    if (!compression.empty())
     {
-        m_Buffer->reserve(m_Buffer->capacity() * 2);
+        metaj["Z"] = compression;
+        metaj["ZR"] = compressionRate;
     }
 
-    m_Buffer->resize(m_Position + totalsize);
-
-    std::memcpy(m_Buffer->data() + m_Position, &metasize, sizeof(metasize));
-    m_Position += sizeof(metasize);
-
-    std::memcpy(m_Buffer->data() + m_Position, metastr.c_str(), metasize);
-    m_Position += metasize;
-
-    std::memcpy(m_Buffer->data() + m_Position, variable.GetData(), datasize);
-    m_Position += datasize;
-    return true;
+    const std::string metastr = metaj.dump();
+    m_Metadata.assign(metastr.begin(), metastr.end());
+    m_Metadata.push_back('\0');
 }
 
 template <class T>
@@ -148,18 +143,24 @@ int DataManDeserializer::Get(core::Variable<T> &variable, size_t step)
 {
 
     std::shared_ptr<std::vector<DataManVar>> vec = nullptr;
+    size_t varsSize = 0;
 
-    m_MutexMetaData.lock();
+    m_Mutex.lock();
     const auto &i = m_MetaDataMap.find(step);
     if (i == m_MetaDataMap.end())
     {
+        m_Mutex.unlock();
         return -1; // step not found
     }
     else
     {
         vec = i->second;
+        if (vec != nullptr)
+        {
+            varsSize = vec->size();
+        }
     }
-    m_MutexMetaData.unlock();
+    m_Mutex.unlock();
 
     if (vec == nullptr)
     {
@@ -167,81 +168,93 @@ int DataManDeserializer::Get(core::Variable<T> &variable, size_t step)
     }
     else
     {
-        for (const auto &j : *vec)
+        const std::vector<size_t> positions =
+            GetIntersectingVars(step, *vec, varsSize, variable.m_Name,
+                                variable.m_Start, variable.m_Count);
+
+        // Get the shared pointers of all blocks under one lock and then copy
+        // memory. This is done in order to avoid expensive memory copy
+        // operations happening inside the lock. Once a shared pointer is
+        // assigned to buffers, its life cycle in m_BufferMap does not matter
+        // any more. So even if it is released somewhere else the memory is
+        // still valid until buffers dies.
+        std::vector<std::shared_ptr<std::vector<char>>> buffers;
+        buffers.reserve(positions.size());
+        m_Mutex.lock();
+        for (const size_t position : positions)
+        {
+            const auto itBuffer = m_BufferMap.find((*vec)[position].index);
+            buffers.push_back(itBuffer == m_BufferMap.end() ? nullptr
+                                                            : itBuffer->second);
+        }
+        m_Mutex.unlock();
+
+        for (size_t p = 0; p < positions.size(); ++p)
         {
-            if (j.name == variable.m_Name)
+            const DataManVar &j = (*vec)[positions[p]];
+            const std::shared_ptr<std::vector<char>> &k = buffers[p];
+            if (k == nullptr)
             {
+                return -3; // step erased while reading
+            }
+            Box<Dims> srcBox(j.start, GetAbsolutePosition(j.start, j.count));
+            Box<Dims> dstBox(
+                variable.m_Start,
+                GetAbsolutePosition(variable.m_Start, variable.m_Count));
+            Box<Dims> overlapBox;
 
-                Box<Dims> srcBox(j.start,
-                                 GetAbsolutePosition(j.start, j.count));
-                Box<Dims> dstBox(
-                    variable.m_Start,
-                    GetAbsolutePosition(variable.m_Start, variable.m_Count));
-                Box<Dims> overlapBox;
+            // unindexed blocks (e.g. single values) are checked here
+            if (GetOverlap(srcBox, dstBox, overlapBox) == false)
+            {
+                continue;
+            }
 
-                if (GetOverlap(srcBox, dstBox, overlapBox) == false)
+            if (j.compression == "zfp")
+            {
+#ifdef ADIOS2_HAVE_ZFP
+                Params p = {{"Rate", std::to_string(j.compressionRate)}};
+                core::compress::CompressZfp zfp(p, true);
+                std::vector<char> decompressBuffer;
+                decompressBuffer.reserve(variable.PayloadSize());
+                try
                 {
-                    return -3; // step and variable found but variable does not
-                               // have desired part
+                    zfp.Decompress(k->data() + j.position, j.size,
+                                   decompressBuffer.data(), j.count, j.type,
+                                   p);
                 }
-
-                // Get the shared pointer first and then copy memory. This is
-                // done in order to avoid expensive memory copy operations
-                // happening inside the lock. Once the shared pointer is
-                // assigned to k, its life cycle in m_BufferMap does not matter
-                // any more. So even if it is released somewhere else the memory
-                // is still valid until k dies.
-                m_MutexBuffer.lock();
-                std::shared_ptr<std::vector<char>> k = m_BufferMap[j.index];
-                m_MutexBuffer.unlock();
-
-                if (j.compression == "zfp")
+                catch (std::exception &e)
                 {
-#ifdef ADIOS2_HAVE_ZFP
-                    Params p = {{"Rate", std::to_string(j.compressionRate)}};
-                    core::compress::CompressZfp zfp(p, true);
-                    std::vector<char> decompressBuffer;
-                    decompressBuffer.reserve(variable.PayloadSize());
-                    try
-                    {
-                        zfp.Decompress(k->data() + j.position, j.size,
-                                       decompressBuffer.data(), j.count, j.type,
-                                       p);
-                    }
-                    catch (std::exception &e)
-                    {
-                        return -4; // decompression failed
-                    }
-                    CopyLocalToGlobal(
-                        reinterpret_cast<char *>(variable.GetData()), dstBox,
-                        decompressBuffer.data(), srcBox, sizeof(T), overlapBox);
+                    return -4; // decompression failed
+                }
+                CopyLocalToGlobal(
+                    reinterpret_cast<char *>(variable.GetData()), dstBox,
+                    decompressBuffer.data(), srcBox, sizeof(T), overlapBox);
 #else
-                    throw std::runtime_error(
-                        "Data received is compressed using ZFP. However, ZFP "
-                        "library is not found locally and as a result it "
-                        "cannot be decompressed.");
-                    return -101; // zfp library not found
+                throw std::runtime_error(
+                    "Data received is compressed using ZFP. However, ZFP "
+                    "library is not found locally and as a result it "
+                    "cannot be decompressed.");
+                return -101; // zfp library not found
 #endif
-                }
-                else if (j.compression == "sz")
-                {
+            }
+            else if (j.compression == "sz")
+            {
 #ifdef ADIOS2_HAVE_SZ
 #else
-                    throw std::runtime_error(
-                        "Data received is compressed using SZ. However, SZ "
-                        "library is not found locally and as a result it "
-                        "cannot be decompressed.");
-                    return -102; // sz library not found
+                throw std::runtime_error(
+                    "Data received is compressed using SZ. However, SZ "
+                    "library is not found locally and as a result it "
+                    "cannot be decompressed.");
+                return -102; // sz library not found
 #endif
-                }
-                else
-                {
-                    Box<Dims> srcbox(j.start, j.count);
-                    Box<Dims> dstbox(variable.m_Start, variable.m_Count);
-                    CopyLocalToGlobal(
-                        reinterpret_cast<char *>(variable.GetData()), dstBox,
-                        k->data() + j.position, srcBox, sizeof(T), overlapBox);
-                }
+            }
+            else
+            {
+                Box<Dims> srcbox(j.start, j.count);
+                Box<Dims> dstbox(variable.m_Start, variable.m_Count);
+                CopyLocalToGlobal(
+                    reinterpret_cast<char *>(variable.GetData()), dstBox,
+                    k->data() + j.position, srcBox, sizeof(T), overlapBox);
             }
         }
     }
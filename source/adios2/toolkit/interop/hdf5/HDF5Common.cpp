@@ -11,6 +11,7 @@
 #include "HDF5Common.h"
 #include "HDF5Common.tcc"
 
+#include <algorithm> // std::max, std::min
 #include <complex>
 #include <ios>
 #include <iostream>
@@ -70,7 +71,13 @@ void HDF5Common::Init(const std::string &name, MPI_Comm comm, bool toWrite)
          */
         m_FileId = H5Fcreate(name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
                              m_PropertyListId);
-        if (m_FileId >= 0)
+        if (m_FileId >= 0 && m_TimeDimension)
+        {
+            // all steps are stored in root group datasets
+            ts0 = "/";
+            m_GroupId = H5Gopen(m_FileId, ts0.c_str(), H5P_DEFAULT);
+        }
+        else if (m_FileId >= 0)
         {
             m_GroupId = H5Gcreate2(m_FileId, ts0.c_str(), H5P_DEFAULT,
                                    H5P_DEFAULT, H5P_DEFAULT);
@@ -97,6 +104,12 @@ void HDF5Common::Init(const std::string &name, MPI_Comm comm, bool toWrite)
                 m_GroupId = H5Gopen(m_FileId, ts0.c_str(), H5P_DEFAULT);
                 m_IsGeneratedByAdios = true;
             }
+            else if (H5Aexists(m_FileId, ATTRNAME_NUM_STEPS.c_str()) > 0)
+            {
+                // written with TimeDimension, steps are the first dimension
+                m_TimeDimension = true;
+                m_IsGeneratedByAdios = true;
+            }
         }
     }
 
@@ -125,7 +138,11 @@ void HDF5Common::WriteAdiosSteps()
                   /*"NumSteps",*/ H5T_NATIVE_UINT, s, H5P_DEFAULT, H5P_DEFAULT);
     uint totalAdiosSteps = m_CurrentAdiosStep + 1;
 
-    if (m_GroupId < 0)
+    if (m_TimeDimension)
+    {
+        totalAdiosSteps = std::max(m_CurrentAdiosStep, m_TimeExtent);
+    }
+    else if (m_GroupId < 0)
     {
         totalAdiosSteps = m_CurrentAdiosStep;
     }
@@ -177,6 +194,13 @@ void HDF5Common::ReadAllVariables(core::IO &io)
         return;
     }
 
+    if (m_TimeDimension)
+    {
+        // all steps are in the datasets at root
+        ReadVariables(0, io);
+        return;
+    }
+
     GetNumAdiosSteps();
     int i = 0;
 
@@ -284,7 +308,14 @@ void HDF5Common::ReadVariables(unsigned int ts, core::IO &io)
     std::string stepStr;
     hsize_t numObj;
 
-    StaticGetAdiosStepString(stepStr, ts);
+    if (m_TimeDimension)
+    {
+        stepStr = "/";
+    }
+    else
+    {
+        StaticGetAdiosStepString(stepStr, ts);
+    }
     hid_t gid = H5Gopen2(m_FileId, stepStr.c_str(), H5P_DEFAULT);
     HDF5TypeGuard g(gid, E_H5_GROUP);
     ///    if (gid > 0) {
@@ -329,16 +360,19 @@ void HDF5Common::AddVar(core::IO &io, std::string const &name, hid_t datasetId)
         H5Sget_simple_extent_dims(dspace, dims, NULL);
         H5Sclose(dspace);
 
+        // steps are not part of the shape of time dimension datasets
+        const int timeDims = (m_TimeDimension && ndims > 0) ? 1 : 0;
+
         Dims shape;
-        shape.resize(ndims);
-        if (ndims > 0)
+        shape.resize(ndims - timeDims);
+        if (ndims > timeDims)
         {
             bool isOrderC = helper::IsRowMajor(io.m_HostLanguage);
-            for (int i = 0; i < ndims; i++)
+            for (int i = 0; i < ndims - timeDims; i++)
             {
                 if (isOrderC)
                 {
-                    shape[i] = dims[i];
+                    shape[i] = dims[timeDims + i];
                 }
                 else
                 {
@@ -353,9 +387,13 @@ void HDF5Common::AddVar(core::IO &io, std::string const &name, hid_t datasetId)
         {
             auto &foo = io.DefineVariable<T>(name, shape, zeros, shape);
 
+            if (timeDims > 0)
+            {
+                foo.m_AvailableStepsCount = dims[0];
+            }
             // default was set to 0 while m_AvailabelStepsStart is 1.
             // correcting
-            if (0 == foo.m_AvailableStepsCount)
+            else if (0 == foo.m_AvailableStepsCount)
             {
                 foo.m_AvailableStepsCount++;
             }
@@ -492,8 +530,16 @@ void HDF5Common::Close()
         return;
     }
 
+    PerformWrites();
     WriteAdiosSteps();
 
+    for (auto &timeDataset : m_TimeDatasets)
+    {
+        HDF5DatasetGuard g(timeDataset.second);
+    }
+    m_TimeDatasets.clear();
+    CloseDatasetHandles();
+
     if (m_GroupId >= 0)
     {
         H5Gclose(m_GroupId);
@@ -539,6 +585,23 @@ void HDF5Common::SetAdiosStep(int step)
 
 void HDF5Common::Advance()
 {
+    if (m_WriteMode && m_TimeDimension)
+    {
+        // root group and datasets stay open, next step extends them
+        ++m_CurrentAdiosStep;
+        return;
+    }
+
+    if (m_TimeDimension)
+    {
+        // no step groups, datasets are cached by GetDataset
+        if (m_CurrentAdiosStep + 1 < GetNumAdiosSteps())
+        {
+            ++m_CurrentAdiosStep;
+        }
+        return;
+    }
+
     if (m_GroupId >= 0)
     {
         H5Gclose(m_GroupId);
@@ -634,24 +697,9 @@ hid_t HDF5Common::GetTypeStringScalar(const std::string &input)
 
 void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type,
                                hid_t filespaceID,
-                               std::vector<hid_t> &datasetChain)
+                               std::vector<hid_t> &datasetChain, hid_t dcplID)
 {
-    std::vector<std::string> list;
-    char delimiter = '/';
-    int delimiterLength = 1;
-    std::string s = std::string(varName);
-    size_t pos = 0;
-    std::string token;
-    while ((pos = s.find(delimiter)) != std::string::npos)
-    {
-        if (pos > 1)
-        { // "///a/b/c" == "a/b/c"
-            token = s.substr(0, pos);
-            list.push_back(token);
-        }
-        s.erase(0, pos + delimiterLength);
-    }
-    list.push_back(s);
+    const std::vector<std::string> list = SplitDatasetPath(varName);
 
     hid_t topId = m_GroupId;
     if (list.size() > 1)
@@ -672,7 +720,13 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type,
     }
 
     hid_t dsetID = H5Dcreate(topId, list.back().c_str(), h5Type, filespaceID,
-                             H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+                             H5P_DEFAULT, dcplID, H5P_DEFAULT);
+
+    if (m_DebugMode && dsetID < 0)
+    {
+        throw std::ios_base::failure("ERROR: unable to create HDF5 dataset " +
+                                     varName + ", in call to Put\n");
+    }
 
     StoreADIOSName(varName, dsetID);
 
@@ -680,6 +734,138 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type,
     // return dsetID;
 }
 
+hid_t HDF5Common::CreateDatasetProperties(
+    const std::vector<hsize_t> &dims) const
+{
+    const bool useChunkDims =
+        !dims.empty() && m_ChunkDims.size() == dims.size();
+
+    if (!useChunkDims && !m_TimeDimension && m_DeflateLevel == 0 &&
+        !m_Shuffle)
+    {
+        return H5P_DEFAULT;
+    }
+
+    // filters and extendible dimensions require a chunked layout, a chunk
+    // defaults to the whole step of a dataset
+    std::vector<hsize_t> chunk;
+    chunk.reserve(dims.size() + 1);
+    if (m_TimeDimension)
+    {
+        // scalars are grouped in chunks of steps
+        chunk.push_back(dims.empty() ? 1024 : 1);
+    }
+
+    for (size_t i = 0; i < dims.size(); ++i)
+    {
+        hsize_t chunkDim = dims[i];
+        if (useChunkDims && m_ChunkDims[i] > 0)
+        {
+            chunkDim = std::min(static_cast<hsize_t>(m_ChunkDims[i]), dims[i]);
+        }
+        chunk.push_back(std::max(chunkDim, static_cast<hsize_t>(1)));
+    }
+
+    if (chunk.empty())
+    {
+        // filters on scalars
+        return H5P_DEFAULT;
+    }
+
+    hid_t dcplID = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcplID, static_cast<int>(chunk.size()), chunk.data());
+    if (m_Shuffle)
+    {
+        H5Pset_shuffle(dcplID);
+    }
+    if (m_DeflateLevel > 0)
+    {
+        H5Pset_deflate(dcplID, m_DeflateLevel);
+    }
+    return dcplID;
+}
+
+void HDF5Common::PerformWrites()
+{
+    if (m_WriteRequests.empty())
+    {
+        return;
+    }
+
+    //  Create property list for collective dataset write.
+    hid_t plistID = H5Pcreate(H5P_DATASET_XFER);
+#ifdef ADIOS2_HAVE_MPI
+    H5Pset_dxpl_mpio(plistID, H5FD_MPIO_COLLECTIVE);
+#endif
+
+    herr_t status = 0;
+
+#if H5_VERSION_GE(1, 14, 0)
+    const size_t count = m_WriteRequests.size();
+    std::vector<hid_t> datasets, memTypes, memSpaces, fileSpaces;
+    std::vector<const void *> buffers;
+    datasets.reserve(count);
+    memTypes.reserve(count);
+    memSpaces.reserve(count);
+    fileSpaces.reserve(count);
+    buffers.reserve(count);
+
+    for (const WriteRequest &request : m_WriteRequests)
+    {
+        datasets.push_back(request.DatasetId);
+        memTypes.push_back(request.MemType);
+        memSpaces.push_back(request.MemSpace);
+        fileSpaces.push_back(request.FileSpace);
+        buffers.push_back(request.Data);
+    }
+
+    status = H5Dwrite_multi(count, datasets.data(), memTypes.data(),
+                            memSpaces.data(), fileSpaces.data(), plistID,
+                            buffers.data());
+#else
+    for (const WriteRequest &request : m_WriteRequests)
+    {
+        if (H5Dwrite(request.DatasetId, request.MemType, request.MemSpace,
+                     request.FileSpace, plistID, request.Data) < 0)
+        {
+            status = -1;
+        }
+    }
+#endif
+
+    H5Pclose(plistID);
+
+    for (WriteRequest &request : m_WriteRequests)
+    {
+        if (request.MemSpace != H5S_ALL)
+        {
+            H5Sclose(request.MemSpace);
+        }
+        if (request.FileSpace != H5S_ALL)
+        {
+            H5Sclose(request.FileSpace);
+        }
+        if (request.CloseMemType)
+        {
+            H5Tclose(request.MemType);
+        }
+        if (!request.Chain.empty())
+        {
+            HDF5DatasetGuard g(request.Chain);
+        }
+    }
+    m_WriteRequests.clear();
+
+    if (status < 0)
+    {
+        if (m_DebugMode)
+        {
+            throw std::ios_base::failure(
+                "ERROR: HDF5 file Write failed, in call to Write\n");
+        }
+    }
+}
+
 void HDF5Common::StoreADIOSName(const std::string adiosName, hid_t dsetID)
 {
     hid_t attrSpace = H5Screate(H5S_SCALAR);
@@ -723,8 +909,8 @@ void HDF5Common::ReadADIOSName(hid_t dsetID, std::string &adiosName)
     free(val);
 }
 
-bool HDF5Common::OpenDataset(const std::string &varName,
-                             std::vector<hid_t> &datasetChain)
+std::vector<std::string>
+HDF5Common::SplitDatasetPath(const std::string &varName) const
 {
     std::vector<std::string> list;
     char delimiter = '/';
@@ -742,6 +928,13 @@ bool HDF5Common::OpenDataset(const std::string &varName,
         s.erase(0, pos + delimiterLength);
     }
     list.push_back(s);
+    return list;
+}
+
+bool HDF5Common::OpenDataset(const std::string &varName,
+                             std::vector<hid_t> &datasetChain)
+{
+    const std::vector<std::string> list = SplitDatasetPath(varName);
 
     if (list.size() == 1)
     {
@@ -775,6 +968,76 @@ bool HDF5Common::OpenDataset(const std::string &varName,
     return true;
 }
 
+hid_t HDF5Common::GetDataset(const unsigned int step,
+                             const std::string &varName)
+{
+    const unsigned int stepKey =
+        (m_IsGeneratedByAdios && !m_TimeDimension) ? step : 0;
+    const std::pair<unsigned int, std::string> key(stepKey, varName);
+
+    auto itDataset = m_DatasetHandles.find(key);
+    if (itDataset != m_DatasetHandles.end())
+    {
+        return itDataset->second;
+    }
+
+    if (m_DatasetHandles.size() >= MaxOpenDatasets)
+    {
+        CloseDatasetHandles();
+    }
+
+    hid_t parentId = m_FileId;
+    std::string path(varName);
+
+    if (m_IsGeneratedByAdios && !m_TimeDimension)
+    {
+        auto itGroup = m_StepGroups.find(step);
+        if (itGroup == m_StepGroups.end())
+        {
+            std::string stepName;
+            StaticGetAdiosStepString(stepName, step);
+            const hid_t groupId =
+                H5Gopen(m_FileId, stepName.c_str(), H5P_DEFAULT);
+            if (groupId < 0)
+            {
+                return -1;
+            }
+            itGroup = m_StepGroups.emplace(step, groupId).first;
+        }
+        parentId = itGroup->second;
+
+        // same layout as CreateDataset, relative to the step group
+        const std::vector<std::string> list = SplitDatasetPath(varName);
+        path = list.front();
+        for (size_t i = 1; i < list.size(); ++i)
+        {
+            path += "/" + list[i];
+        }
+    }
+
+    const hid_t dsetID = H5Dopen(parentId, path.c_str(), H5P_DEFAULT);
+    if (dsetID >= 0)
+    {
+        m_DatasetHandles.emplace(key, dsetID);
+    }
+    return dsetID;
+}
+
+void HDF5Common::CloseDatasetHandles()
+{
+    for (const auto &datasetPair : m_DatasetHandles)
+    {
+        H5Dclose(datasetPair.second);
+    }
+    m_DatasetHandles.clear();
+
+    for (const auto &groupPair : m_StepGroups)
+    {
+        H5Gclose(groupPair.second);
+    }
+    m_StepGroups.clear();
+}
+
 // trim from right
 inline std::string &rtrim(std::string &s, const char *t = " \t\n\r\f\v")
 {
@@ -1146,7 +1409,8 @@ void HDF5Common::StaticGetAdiosStepString(std::string &stepName, int ts)
 }
 
 #define declare_template_instantiation(T)                                      \
-    template void HDF5Common::Write(core::Variable<T> &, const T *);
+    template void HDF5Common::Write(core::Variable<T> &, const T *);           \
+    template void HDF5Common::DefineWrite(core::Variable<T> &, const T *);
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
@@ -13,7 +13,10 @@
 
 #include <hdf5.h>
 
+#include <map>
 #include <string>
+#include <utility> // std::pair
+#include <vector>
 
 #include "adios2/ADIOSMPICommOnly.h"
 #include "adios2/ADIOSMacros.h"
@@ -113,10 +116,37 @@ public:
     template <class T>
     void Write(core::Variable<T> &variable, const T *values);
 
+    /**
+     * Creates or extends the dataset of a block and queues its values for
+     * PerformWrites, no raw data is written
+     * @param variable block dimensions
+     * @param values must stay valid until PerformWrites
+     */
+    template <class T>
+    void DefineWrite(core::Variable<T> &variable, const T *values);
+
+    /**
+     * Writes all blocks queued by DefineWrite in a single collective
+     * multi-dataset H5Dwrite_multi (HDF5 >= 1.14), or one H5Dwrite each
+     */
+    void PerformWrites();
+
     void CreateDataset(const std::string &varName, hid_t h5Type,
-                       hid_t filespaceID, std::vector<hid_t> &chain);
+                       hid_t filespaceID, std::vector<hid_t> &chain,
+                       hid_t dcplID = H5P_DEFAULT);
     bool OpenDataset(const std::string &varName, std::vector<hid_t> &chain);
 
+    /**
+     * Returns the dataset of a variable at a step, opened once and cached
+     * until Close (or until MaxOpenDatasets are cached), step groups stay
+     * open as well
+     * @param step adios step, ignored for single step or time dimension
+     * files
+     * @param varName variable name
+     * @return dataset id, owned by the cache, negative if not found
+     */
+    hid_t GetDataset(const unsigned int step, const std::string &varName);
+
     void StoreADIOSName(const std::string adiosName, hid_t dsetID);
     void ReadADIOSName(hid_t dsetID, std::string &adiosName);
 
@@ -169,7 +199,70 @@ public:
 
     bool m_IsGeneratedByAdios = false;
 
+    /** dataset chunk dimensions, used for datasets of the same rank */
+    Dims m_ChunkDims;
+
+    /** gzip filter level 1 to 9, 0: off */
+    unsigned int m_DeflateLevel = 0;
+
+    /** true: shuffle filter before compression */
+    bool m_Shuffle = false;
+
+    /** true: steps are appended along an extendible first dimension of
+     * datasets in the root group instead of /Step# groups, set before Init
+     * at write, found by Init at read */
+    bool m_TimeDimension = false;
+
 private:
+    /** block queued by DefineWrite */
+    struct WriteRequest
+    {
+        hid_t DatasetId = -1;
+        hid_t MemType = -1;
+        hid_t MemSpace = H5S_ALL;
+        hid_t FileSpace = H5S_ALL;
+        const void *Data = nullptr;
+        /** true: MemType was created for this block (strings) */
+        bool CloseMemType = false;
+        /** groups and dataset closed after writing, empty if cached */
+        std::vector<hid_t> Chain;
+    };
+
+    std::vector<WriteRequest> m_WriteRequests;
+
+    /** open datasets with a time dimension (groups and dataset), reused
+     * across steps and closed at Close */
+    std::map<std::string, std::vector<hid_t>> m_TimeDatasets;
+
+    /** steps stored along the time dimension */
+    unsigned int m_TimeExtent = 0;
+
+    /** bounds m_DatasetHandles, all are closed when reached */
+    static const size_t MaxOpenDatasets = 1024;
+
+    /** datasets opened at read by GetDataset, key: step and name */
+    std::map<std::pair<unsigned int, std::string>, hid_t> m_DatasetHandles;
+
+    /** /Step# groups opened at read by GetDataset */
+    std::map<unsigned int, hid_t> m_StepGroups;
+
+    /** closes m_DatasetHandles and m_StepGroups */
+    void CloseDatasetHandles();
+
+    /**
+     * Splits a variable name in the groups and dataset names used to store
+     * it in a step group, "///a/b/c" == "a/b/c"
+     */
+    std::vector<std::string> SplitDatasetPath(const std::string &varName) const;
+
+    /**
+     * Dataset creation properties from m_ChunkDims, filters and time
+     * dimension
+     * @param dims dataset dimensions, without time dimension
+     * @return H5P_DEFAULT if contiguous, or a list closed by the caller
+     */
+    hid_t CreateDatasetProperties(const std::vector<hsize_t> &dims) const;
+
     void ReadInStringAttr(core::IO &io, const std::string &attrName,
                           hid_t attrId, hid_t h5Type, hid_t sid);
     void ReadInNonStringAttr(core::IO &io, const std::string &attrName,
@@ -187,7 +280,10 @@ private:
 // Explicit declaration of the public template methods
 #define declare_template_instantiation(T)                                      \
     extern template void HDF5Common::Write(core::Variable<T> &variable,        \
-                                           const T *value);
+                                           const T *value);                    \
+                                                                               \
+    extern template void HDF5Common::DefineWrite(core::Variable<T> &variable,  \
+                                                 const T *value);
 
 ADIOS2_FOREACH_TYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
@@ -12,7 +12,11 @@
 #define ADIOS2_TOOLKIT_INTEROP_HDF5_HDF5COMMON_TCC_
 
 #include "HDF5Common.h"
+#include <algorithm>   // std::max
 #include <iostream>
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::is_same
+#include <utility>     // std::move
 #include <vector>
 
 namespace adios2
@@ -22,53 +26,36 @@ namespace interop
 
 template <class T>
 void HDF5Common::Write(core::Variable<T> &variable, const T *values)
+{
+    DefineWrite(variable, values);
+    PerformWrites();
+}
+
+template <class T>
+void HDF5Common::DefineWrite(core::Variable<T> &variable, const T *values)
 {
     CheckWriteGroup();
     int dimSize = std::max(variable.m_Shape.size(), variable.m_Count.size());
     hid_t h5Type = GetHDF5Type<T>();
 
-    if (std::is_same<T, std::string>::value)
-    {
-        h5Type = GetTypeStringScalar(*(std::string *)values);
-    }
+    WriteRequest request;
+    request.Data = values;
 
-    if (dimSize == 0)
+    if (std::is_same<T, std::string>::value)
     {
-        // write scalar
-        hid_t filespaceID = H5Screate(H5S_SCALAR);
-        // hid_t dsetID = CreateDataset(variable.m_Name, h5Type, filespaceID);
-        std::vector<hid_t> chain;
-        CreateDataset(variable.m_Name, h5Type, filespaceID, chain);
-        HDF5DatasetGuard g(chain);
-        hid_t dsetID = chain.back();
-        /*
-        hid_t dsetID =
-            H5Dcreate(m_GroupId, variable.m_Name.c_str(), h5Type, filespaceID,
-                      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-                      */
-
-        hid_t plistID = H5Pcreate(H5P_DATASET_XFER);
-#ifdef ADIOS2_HAVE_MPI
-        H5Pset_dxpl_mpio(plistID, H5FD_MPIO_COLLECTIVE);
-#endif
-
-        herr_t status;
-        if (std::is_same<T, std::string>::value)
+        if (m_TimeDimension)
         {
-            status = H5Dwrite(dsetID, h5Type, H5S_ALL, H5S_ALL, plistID,
-                              ((std::string *)values)->data());
-            H5Tclose(h5Type);
+            throw std::invalid_argument(
+                "ERROR: string variable " + variable.m_Name +
+                " can't be stored along TimeDimension, in call to Put\n");
         }
-        else
-        {
-            status =
-                H5Dwrite(dsetID, h5Type, H5S_ALL, H5S_ALL, plistID, values);
-        }
-        H5Sclose(filespaceID);
-        //	CloseDataset(dsetID);
-
-        return;
+        const std::string *value =
+            reinterpret_cast<const std::string *>(values);
+        h5Type = GetTypeStringScalar(*value);
+        request.Data = value->data();
+        request.CloseMemType = true;
     }
+    request.MemType = h5Type;
 
     std::vector<hsize_t> dimsf, count, offset;
 
@@ -102,48 +89,79 @@ void HDF5Common::Write(core::Variable<T> &variable, const T *values)
         }
     }
 
-    hid_t fileSpace = H5Screate_simple(dimSize, dimsf.data(), NULL);
+    if (m_TimeDimension)
+    {
+        // step is the first, extendible, dimension
+        const hsize_t step = m_CurrentAdiosStep;
+        std::vector<hsize_t> timeDims(1, step + 1);
+        timeDims.insert(timeDims.end(), dimsf.begin(), dimsf.end());
 
-    std::vector<hid_t> chain;
-    /*hid_t dsetID =*/CreateDataset(variable.m_Name, h5Type, fileSpace, chain);
-    hid_t dsetID = chain.back();
-    HDF5DatasetGuard g(chain);
-    /*
-    hid_t dsetID = H5Dcreate(m_GroupId, variable.m_Name.c_str(), h5Type,
-                             fileSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-                             */
-    // H5Sclose(fileSpace);
+        auto itDataset = m_TimeDatasets.find(variable.m_Name);
+        if (itDataset == m_TimeDatasets.end())
+        {
+            std::vector<hsize_t> maxDims(timeDims);
+            maxDims.front() = H5S_UNLIMITED;
+            hid_t fileSpace = H5Screate_simple(
+                static_cast<int>(timeDims.size()), timeDims.data(),
+                maxDims.data());
+            hid_t dcplID = CreateDatasetProperties(dimsf);
 
-    hid_t memSpace = H5Screate_simple(dimSize, count.data(), NULL);
+            std::vector<hid_t> chain;
+            CreateDataset(variable.m_Name, h5Type, fileSpace, chain, dcplID);
+            H5Sclose(fileSpace);
+            H5Pclose(dcplID);
+            itDataset = m_TimeDatasets.emplace(variable.m_Name, chain).first;
+        }
+        else
+        {
+            H5Dset_extent(itDataset->second.back(), timeDims.data());
+        }
+        m_TimeExtent =
+            std::max(m_TimeExtent, static_cast<unsigned int>(step + 1));
 
-    // Select hyperslab
-    fileSpace = H5Dget_space(dsetID);
-    H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), NULL,
-                        count.data(), NULL);
+        request.DatasetId = itDataset->second.back();
 
-    //  Create property list for collective dataset write.
+        count.insert(count.begin(), 1);
+        offset.insert(offset.begin(), step);
+        request.MemSpace = H5Screate_simple(static_cast<int>(count.size()),
+                                            count.data(), NULL);
+        request.FileSpace = H5Dget_space(request.DatasetId);
+        H5Sselect_hyperslab(request.FileSpace, H5S_SELECT_SET, offset.data(),
+                            NULL, count.data(), NULL);
+        m_WriteRequests.push_back(std::move(request));
+        return;
+    }
 
-    hid_t plistID = H5Pcreate(H5P_DATASET_XFER);
-#ifdef ADIOS2_HAVE_MPI
-    H5Pset_dxpl_mpio(plistID, H5FD_MPIO_COLLECTIVE);
-#endif
-    herr_t status;
+    if (dimSize == 0)
+    {
+        // write scalar
+        hid_t filespaceID = H5Screate(H5S_SCALAR);
+        CreateDataset(variable.m_Name, h5Type, filespaceID, request.Chain);
+        H5Sclose(filespaceID);
 
-    status = H5Dwrite(dsetID, h5Type, memSpace, fileSpace, plistID, values);
+        request.DatasetId = request.Chain.back();
+        m_WriteRequests.push_back(std::move(request));
+        return;
+    }
 
-    if (status < 0)
+    hid_t fileSpace = H5Screate_simple(dimSize, dimsf.data(), NULL);
+    hid_t dcplID = CreateDatasetProperties(dimsf);
+    CreateDataset(variable.m_Name, h5Type, fileSpace, request.Chain, dcplID);
+    H5Sclose(fileSpace);
+    if (dcplID != H5P_DEFAULT)
     {
-        if (m_DebugMode)
-        {
-            throw std::ios_base::failure(
-                "ERROR: HDF5 file Write failed, in call to Write\n");
-        }
+        H5Pclose(dcplID);
     }
 
-    //    CloseDataset(dsetID);
-    H5Sclose(fileSpace);
-    H5Sclose(memSpace);
-    H5Pclose(plistID);
+    request.DatasetId = request.Chain.back();
+    request.MemSpace = H5Screate_simple(dimSize, count.data(), NULL);
+
+    // Select hyperslab
+    request.FileSpace = H5Dget_space(request.DatasetId);
+    H5Sselect_hyperslab(request.FileSpace, H5S_SELECT_SET, offset.data(),
+                        NULL, count.data(), NULL);
+
+    m_WriteRequests.push_back(std::move(request));
 }
 
 template <>
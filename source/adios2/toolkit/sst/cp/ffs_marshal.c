@@ -21,10 +21,25 @@ typedef struct _FFSWriterRec
     int SingleValue;
 } * FFSWriterRec;
 
+/*
+ * Open addressing hash table of indices into a record list, so that
+ * lookups stay valid when the list is reallocated.  Slots hold index + 1,
+ * 0 is empty.  Size is a power of 2 kept at least twice the entry count.
+ */
+typedef struct _FFSIndexTable
+{
+    int Size;
+    int Count;
+    size_t *Hashes;
+    int *Slots;
+} FFSIndexTable;
+
 struct FFSWriterMarshalBase
 {
     int RecCount;
+    int RecSize;
     FFSWriterRec RecList;
+    FFSIndexTable RecByKey;
     FMContext LocalFMContext;
     int MetaFieldCount;
     FMFieldList MetaFields;
@@ -34,6 +49,13 @@ struct FFSWriterMarshalBase
     FMFormat DataFormat;
 };
 
+/* Writer block start along the first dimension, to sort writers by */
+typedef struct _FFSWriterSpan
+{
+    size_t Start;
+    int Writer;
+} FFSWriterSpan;
+
 typedef struct FFSVarRec
 {
     void *Variable;
@@ -45,6 +67,13 @@ typedef struct FFSVarRec
     size_t **PerWriterStart;
     size_t **PerWriterCounts;
     void **PerWriterIncomingData;
+    size_t ElemSize;
+    size_t *PerWriterDataOffset;
+    /* Writers that wrote this step, sorted by first dimension start, built
+     * at the first request so that requests don't test every writer */
+    int WriterSpanCount;
+    FFSWriterSpan *WriterSpans;
+    size_t MaxWriterCount0;
 } * FFSVarRec;
 
 typedef struct FFSArrayRequest
@@ -53,6 +82,9 @@ typedef struct FFSArrayRequest
     size_t *Start;
     size_t *Count;
     void *Data;
+    /* writers whose blocks intersect the selection, ascending */
+    int WriterCount;
+    int *Writers;
     struct FFSArrayRequest *Next;
 } * FFSArrayRequest;
 
@@ -61,7 +93,8 @@ enum WriterDataStatusEnum
     Empty = 0,
     Needed = 1,
     Requested = 2,
-    Full = 3
+    Full = 3,
+    Partial = 4
 };
 
 typedef struct FFSReaderPerWriterRec
@@ -69,12 +102,19 @@ typedef struct FFSReaderPerWriterRec
     enum WriterDataStatusEnum Status;
     char *RawBuffer;
     DP_CompletionHandle ReadHandle;
+    /* Partial status, one handle per coalesced range of selected data */
+    int PartialReadCount;
+    int PartialReadSize;
+    DP_CompletionHandle *PartialReadHandles;
 } FFSReaderPerWriterRec;
 
 struct FFSReaderMarshalBase
 {
     int VarCount;
+    int VarSize;
     FFSVarRec VarList;
+    FFSIndexTable VarByKey;
+    FFSIndexTable VarByName;
     FMContext LocalFMContext;
     FFSArrayRequest PendingVarRequests;
 
@@ -87,6 +127,103 @@ struct FFSReaderMarshalBase
     FFSReaderPerWriterRec *WriterInfo;
 };
 
+static size_t HashPointer(const void *Key)
+{
+    size_t Hash = (size_t)Key;
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    return Hash;
+}
+
+static size_t HashName(const char *Name)
+{
+    /* FNV-1a */
+    size_t Hash = 14695981039346656037ULL;
+    while (*Name)
+    {
+        Hash ^= (unsigned char)*Name++;
+        Hash *= 1099511628211ULL;
+    }
+    return Hash;
+}
+
+static void IndexTableInsert(FFSIndexTable *Table, size_t Hash, int Index);
+
+static void IndexTableGrow(FFSIndexTable *Table)
+{
+    FFSIndexTable Old = *Table;
+    Table->Size = Old.Size ? 2 * Old.Size : 64;
+    Table->Count = 0;
+    Table->Hashes = calloc(Table->Size, sizeof(Table->Hashes[0]));
+    Table->Slots = calloc(Table->Size, sizeof(Table->Slots[0]));
+    for (int i = 0; i < Old.Size; i++)
+    {
+        if (Old.Slots[i])
+        {
+            IndexTableInsert(Table, Old.Hashes[i], Old.Slots[i] - 1);
+        }
+    }
+    free(Old.Hashes);
+    free(Old.Slots);
+}
+
+static void IndexTableInsert(FFSIndexTable *Table, size_t Hash, int Index)
+{
+    if (2 * (Table->Count + 1) > Table->Size)
+    {
+        IndexTableGrow(Table);
+    }
+    int Slot = Hash & (Table->Size - 1);
+    while (Table->Slots[Slot])
+    {
+        Slot = (Slot + 1) & (Table->Size - 1);
+    }
+    Table->Hashes[Slot] = Hash;
+    Table->Slots[Slot] = Index + 1;
+    Table->Count++;
+}
+
+/* returns the first slot after Slot holding Hash, -1 if none */
+static int IndexTableNext(const FFSIndexTable *Table, size_t Hash, int Slot)
+{
+    if (!Table->Size)
+    {
+        return -1;
+    }
+    while (Table->Slots[Slot])
+    {
+        if (Table->Hashes[Slot] == Hash)
+        {
+            return Slot;
+        }
+        Slot = (Slot + 1) & (Table->Size - 1);
+    }
+    return -1;
+}
+
+static int IndexTableFirst(const FFSIndexTable *Table, size_t Hash)
+{
+    return Table->Size ? IndexTableNext(Table, Hash, Hash & (Table->Size - 1))
+                       : -1;
+}
+
+static void IndexTableClear(FFSIndexTable *Table)
+{
+    if (Table->Size)
+    {
+        memset(Table->Slots, 0, Table->Size * sizeof(Table->Slots[0]));
+    }
+    Table->Count = 0;
+}
+
+static void IndexTableFree(FFSIndexTable *Table)
+{
+    free(Table->Hashes);
+    free(Table->Slots);
+    memset(Table, 0, sizeof(*Table));
+}
+
 static char *ConcatName(const char *base_name, const char *postfix)
 {
     char *Ret =
@@ -345,8 +482,16 @@ struct FFSMetadataInfoStruct
     size_t BitFieldCount;
     size_t *BitField;
     size_t DataBlockSize;
+    /* 1 if little endian, raw array data is only usable by matching readers */
+    char DataByteOrder;
 };
 
+static char LocalByteOrder()
+{
+    const int One = 1;
+    return *(const char *)&One;
+}
+
 static void InitMarshalData(SstStream Stream)
 {
     struct FFSWriterMarshalBase *Info =
@@ -355,7 +500,9 @@ static void InitMarshalData(SstStream Stream)
 
     Stream->MarshalData = Info;
     Info->RecCount = 0;
-    Info->RecList = malloc(sizeof(Info->RecList[0]));
+    Info->RecSize = 16;
+    Info->RecList = malloc(Info->RecSize * sizeof(Info->RecList[0]));
+    memset(&Info->RecByKey, 0, sizeof(Info->RecByKey));
     Info->MetaFieldCount = 0;
     Info->MetaFields = malloc(sizeof(Info->MetaFields[0]));
     Info->DataFieldCount = 0;
@@ -367,11 +514,14 @@ static void InitMarshalData(SstStream Stream)
                    "integer[BitFieldCount]", sizeof(size_t));
     AddSimpleField(&Info->MetaFields, &Info->MetaFieldCount, "DataBlockSize",
                    "integer", sizeof(size_t));
+    AddSimpleField(&Info->MetaFields, &Info->MetaFieldCount, "DataByteOrder",
+                   "char", 1);
     RecalcMarshalStorageSize(Stream);
     MBase = Stream->M;
     MBase->BitFieldCount = 0;
     MBase->BitField = malloc(sizeof(size_t));
     MBase->DataBlockSize = 0;
+    MBase->DataByteOrder = LocalByteOrder();
 }
 
 extern void FFSFreeMarshalData(SstStream Stream)
@@ -386,6 +536,7 @@ extern void FFSFreeMarshalData(SstStream Stream)
 
         if (Info->RecList)
             free(Info->RecList);
+        IndexTableFree(&Info->RecByKey);
         if (Info->MetaFields)
             free_FMfield_list(Info->MetaFields);
         if (Info->DataFields)
@@ -428,9 +579,13 @@ extern void FFSFreeMarshalData(SstStream Stream)
             free(Info->VarList[i].PerWriterStart);
             free(Info->VarList[i].PerWriterCounts);
             free(Info->VarList[i].PerWriterIncomingData);
+            free(Info->VarList[i].PerWriterDataOffset);
+            free(Info->VarList[i].WriterSpans);
         }
         if (Info->VarList)
             free(Info->VarList);
+        IndexTableFree(&Info->VarByKey);
+        IndexTableFree(&Info->VarByName);
 
         free(Info);
         Stream->ReaderMarshalData = NULL;
@@ -447,8 +602,13 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
     }
     struct FFSWriterMarshalBase *Info =
         (struct FFSWriterMarshalBase *)Stream->MarshalData;
-    Info->RecList =
-        realloc(Info->RecList, (Info->RecCount + 1) * sizeof(Info->RecList[0]));
+    if (Info->RecCount == Info->RecSize)
+    {
+        Info->RecSize = 2 * Info->RecSize;
+        Info->RecList =
+            realloc(Info->RecList, Info->RecSize * sizeof(Info->RecList[0]));
+    }
+    IndexTableInsert(&Info->RecByKey, HashPointer(Variable), Info->RecCount);
     FFSWriterRec Rec = &Info->RecList[Info->RecCount];
     Rec->Key = Variable;
     Rec->FieldID = Info->RecCount;
@@ -469,8 +629,8 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
     }
     else
     {
-        // Array field.  To Metadata, add FMFields for DimCount, Shape, Count
-        // and Offsets matching _MetaArrayRec
+        // Array field.  To Metadata, add FMFields for DimCount, Shape, Count,
+        // Offsets, ElemSize and DataOffset matching _MetaArrayRec
         char *ArrayName = BuildArrayName(Name, Type);
         AddField(&Info->MetaFields, &Info->MetaFieldCount, ArrayName, "integer",
                  sizeof(size_t));
@@ -487,9 +647,17 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
                            "integer", sizeof(size_t), DimCount);
         AddFixedArrayField(&Info->MetaFields, &Info->MetaFieldCount,
                            OffsetsName, "integer", sizeof(size_t), DimCount);
+        char *ElemSizeName = ConcatName(Name, "ElemSize");
+        char *DataOffsetName = ConcatName(Name, "DataOffset");
+        AddField(&Info->MetaFields, &Info->MetaFieldCount, ElemSizeName,
+                 "integer", sizeof(size_t));
+        AddField(&Info->MetaFields, &Info->MetaFieldCount, DataOffsetName,
+                 "integer", sizeof(size_t));
         free(ShapeName);
         free(CountName);
         free(OffsetsName);
+        free(ElemSizeName);
+        free(DataOffsetName);
         RecalcMarshalStorageSize(Stream);
 
         // To Data, add FMFields for ElemCount and Array matching _ArrayRec
@@ -524,6 +692,9 @@ typedef struct _MetaArrayRec
     size_t *Shape;
     size_t *Count;
     size_t *Offsets;
+    size_t ElemSize;
+    /* byte offset of Array in the encoded data block, set at EndStep */
+    size_t DataOffset;
 } MetaArrayRec;
 
 typedef struct _FFSTimestepInfo
@@ -565,11 +736,15 @@ static FFSWriterRec LookupWriterRec(SstStream Stream, void *Key)
     if (!Stream->MarshalData)
         return NULL;
 
-    for (int i = 0; i < Info->RecCount; i++)
+    const size_t Hash = HashPointer(Key);
+    for (int Slot = IndexTableFirst(&Info->RecByKey, Hash); Slot != -1;
+         Slot = IndexTableNext(&Info->RecByKey, Hash,
+                               (Slot + 1) & (Info->RecByKey.Size - 1)))
     {
-        if (Info->RecList[i].Key == Key)
+        FFSWriterRec Rec = &Info->RecList[Info->RecByKey.Slots[Slot] - 1];
+        if (Rec->Key == Key)
         {
-            return &Info->RecList[i];
+            return Rec;
         }
     }
 
@@ -580,11 +755,15 @@ static FFSVarRec LookupVarByKey(SstStream Stream, void *Key)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
 
-    for (int i = 0; i < Info->VarCount; i++)
+    const size_t Hash = HashPointer(Key);
+    for (int Slot = IndexTableFirst(&Info->VarByKey, Hash); Slot != -1;
+         Slot = IndexTableNext(&Info->VarByKey, Hash,
+                               (Slot + 1) & (Info->VarByKey.Size - 1)))
     {
-        if (Info->VarList[i].Variable == Key)
+        FFSVarRec VarRec = &Info->VarList[Info->VarByKey.Slots[Slot] - 1];
+        if (VarRec->Variable == Key)
         {
-            return &Info->VarList[i];
+            return VarRec;
         }
     }
 
@@ -595,22 +774,39 @@ static FFSVarRec LookupVarByName(SstStream Stream, const char *Name)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
 
-    for (int i = 0; i < Info->VarCount; i++)
+    const size_t Hash = HashName(Name);
+    for (int Slot = IndexTableFirst(&Info->VarByName, Hash); Slot != -1;
+         Slot = IndexTableNext(&Info->VarByName, Hash,
+                               (Slot + 1) & (Info->VarByName.Size - 1)))
     {
-        if (strcmp(Info->VarList[i].VarName, Name) == 0)
+        FFSVarRec VarRec = &Info->VarList[Info->VarByName.Slots[Slot] - 1];
+        if (strcmp(VarRec->VarName, Name) == 0)
         {
-            return &Info->VarList[i];
+            return VarRec;
         }
     }
 
     return NULL;
 }
 
+/* Variable is known only after the setup upcall, index it then */
+static void IndexVarRecByKey(SstStream Stream, FFSVarRec VarRec)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    IndexTableInsert(&Info->VarByKey, HashPointer(VarRec->Variable),
+                     (int)(VarRec - Info->VarList));
+}
+
 static FFSVarRec CreateVarRec(SstStream Stream, const char *ArrayName)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
-    Info->VarList =
-        realloc(Info->VarList, sizeof(Info->VarList[0]) * (Info->VarCount + 1));
+    if (Info->VarCount == Info->VarSize)
+    {
+        Info->VarSize = Info->VarSize ? 2 * Info->VarSize : 16;
+        Info->VarList =
+            realloc(Info->VarList, sizeof(Info->VarList[0]) * Info->VarSize);
+    }
+    IndexTableInsert(&Info->VarByName, HashName(ArrayName), Info->VarCount);
     Info->VarList[Info->VarCount].VarName = strdup(ArrayName);
     Info->VarList[Info->VarCount].PerWriterMetaFieldDesc =
         calloc(sizeof(FMFieldList), Stream->WriterCohortSize);
@@ -622,6 +818,11 @@ static FFSVarRec CreateVarRec(SstStream Stream, const char *ArrayName)
         calloc(sizeof(size_t *), Stream->WriterCohortSize);
     Info->VarList[Info->VarCount].PerWriterIncomingData =
         calloc(sizeof(void *), Stream->WriterCohortSize);
+    Info->VarList[Info->VarCount].PerWriterDataOffset =
+        calloc(sizeof(size_t), Stream->WriterCohortSize);
+    Info->VarList[Info->VarCount].WriterSpanCount = 0;
+    Info->VarList[Info->VarCount].WriterSpans = NULL;
+    Info->VarList[Info->VarCount].MaxWriterCount0 = 0;
     return &Info->VarList[Info->VarCount++];
 }
 
@@ -642,6 +843,119 @@ void SstReaderInitFFSCallback(SstStream Stream, void *Reader,
     Stream->SetupUpcallReader = Reader;
 }
 
+static int NeedWriter(FFSArrayRequest Req, int i)
+{
+    for (int j = 0; j < Req->VarRec->DimCount; j++)
+    {
+        size_t SelOffset = Req->Start[j];
+        size_t SelSize = Req->Count[j];
+        size_t RankOffset;
+        size_t RankSize;
+        if (Req->VarRec->PerWriterStart[i] == NULL)
+        /* this writer didn't write */
+        {
+            return 0;
+        }
+        RankOffset = Req->VarRec->PerWriterStart[i][j];
+        RankSize = Req->VarRec->PerWriterCounts[i][j];
+        if ((SelSize == 0) || (RankSize == 0))
+        {
+            return 0;
+        }
+        if ((RankOffset < SelOffset && (RankOffset + RankSize) <= SelOffset) ||
+            (RankOffset >= SelOffset + SelSize))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int CompareWriterSpans(const void *A, const void *B)
+{
+    const FFSWriterSpan *SpanA = A;
+    const FFSWriterSpan *SpanB = B;
+    if (SpanA->Start != SpanB->Start)
+    {
+        return (SpanA->Start < SpanB->Start) ? -1 : 1;
+    }
+    return SpanA->Writer - SpanB->Writer;
+}
+
+static void BuildWriterSpans(SstStream Stream, FFSVarRec VarRec)
+{
+    VarRec->WriterSpans =
+        malloc(Stream->WriterCohortSize * sizeof(VarRec->WriterSpans[0]));
+    VarRec->WriterSpanCount = 0;
+    VarRec->MaxWriterCount0 = 0;
+    for (int i = 0; i < Stream->WriterCohortSize; i++)
+    {
+        if (VarRec->PerWriterStart[i] == NULL)
+        {
+            continue;
+        }
+        FFSWriterSpan *Span = &VarRec->WriterSpans[VarRec->WriterSpanCount++];
+        Span->Start = VarRec->PerWriterStart[i][0];
+        Span->Writer = i;
+        if (VarRec->PerWriterCounts[i][0] > VarRec->MaxWriterCount0)
+        {
+            VarRec->MaxWriterCount0 = VarRec->PerWriterCounts[i][0];
+        }
+    }
+    qsort(VarRec->WriterSpans, VarRec->WriterSpanCount,
+          sizeof(VarRec->WriterSpans[0]), CompareWriterSpans);
+}
+
+/*
+ * Only writers starting less than the largest block count before the
+ * selection along the first dimension can intersect it, the others are
+ * skipped with a binary search over the sorted writer spans.
+ */
+static void FindNeededWriters(SstStream Stream, FFSArrayRequest Req)
+{
+    FFSVarRec VarRec = Req->VarRec;
+    if (!VarRec->WriterSpans)
+    {
+        BuildWriterSpans(Stream, VarRec);
+    }
+
+    Req->WriterCount = 0;
+    Req->Writers = malloc(VarRec->WriterSpanCount * sizeof(Req->Writers[0]));
+    if (Req->Count[0] == 0)
+    {
+        return;
+    }
+
+    const size_t SelEnd0 = Req->Start[0] + Req->Count[0];
+    const size_t First0 = (Req->Start[0] >= VarRec->MaxWriterCount0)
+                              ? Req->Start[0] - VarRec->MaxWriterCount0 + 1
+                              : 0;
+    int Low = 0;
+    int High = VarRec->WriterSpanCount;
+    while (Low < High)
+    {
+        const int Mid = Low + (High - Low) / 2;
+        if (VarRec->WriterSpans[Mid].Start < First0)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    for (int j = Low;
+         j < VarRec->WriterSpanCount && VarRec->WriterSpans[j].Start < SelEnd0;
+         j++)
+    {
+        if (NeedWriter(Req, VarRec->WriterSpans[j].Writer))
+        {
+            Req->Writers[Req->WriterCount++] = VarRec->WriterSpans[j].Writer;
+        }
+    }
+}
+
 extern void SstFFSGetDeferred(SstStream Stream, void *Variable,
                               const char *Name, size_t DimCount,
                               const size_t *Start, const size_t *Count,
@@ -672,53 +986,180 @@ extern void SstFFSGetDeferred(SstStream Stream, void *Variable,
         Req->Count = malloc(sizeof(Count[0]) * Var->DimCount);
         memcpy(Req->Count, Count, sizeof(Count[0]) * Var->DimCount);
         Req->Data = Data;
+        FindNeededWriters(Stream, Req);
         Req->Next = Info->PendingVarRequests;
         Info->PendingVarRequests = Req;
     }
 }
 
-static int NeedWriter(FFSArrayRequest Req, int i)
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/*
+ * Raw array data can be read in pieces only if the writer has the same
+ * byte order and, checked per request, located it in its data block
+ */
+static int PartialReadPossible(SstStream Stream, int Writer)
 {
-    for (int j = 0; j < Req->VarRec->DimCount; j++)
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    return ((struct FFSMetadataInfoStruct *)Info->MetadataBaseAddrs[Writer])
+               ->DataByteOrder == LocalByteOrder();
+}
+
+static void IssuePartialRead(SstStream Stream, int Writer, size_t DataOffset,
+                             char *Buffer, size_t Offset, size_t Length)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    FFSReaderPerWriterRec *WriterInfo = &Info->WriterInfo[Writer];
+
+    if (WriterInfo->PartialReadCount == WriterInfo->PartialReadSize)
     {
-        size_t SelOffset = Req->Start[j];
-        size_t SelSize = Req->Count[j];
-        size_t RankOffset;
-        size_t RankSize;
-        if (Req->VarRec->PerWriterStart[i] == NULL)
-        /* this writer didn't write */
+        WriterInfo->PartialReadSize = 2 * WriterInfo->PartialReadSize + 4;
+        WriterInfo->PartialReadHandles = realloc(
+            WriterInfo->PartialReadHandles,
+            WriterInfo->PartialReadSize * sizeof(DP_CompletionHandle));
+    }
+    WriterInfo->PartialReadHandles[WriterInfo->PartialReadCount++] =
+        SstReadRemoteMemory(Stream, Writer, Stream->ReaderTimestep,
+                            DataOffset + Offset, Length, Buffer + Offset,
+                            NULL);
+}
+
+/*
+ * Reads from Writer only the rows of its block that intersect the
+ * selection of Req, into a local buffer with the block geometry so that
+ * FillReadRequests extracts from it as from a full block.  Rows adjacent in
+ * the writer block are coalesced into a single remote read.
+ */
+static void IssuePartialReadRequests(SstStream Stream, FFSArrayRequest Req,
+                                     int Writer)
+{
+    FFSVarRec VarRec = Req->VarRec;
+    const size_t Dims = VarRec->DimCount;
+    const size_t ElemSize = VarRec->ElemSize;
+    const size_t *RankOffset = VarRec->PerWriterStart[Writer];
+    const size_t *RankSize = VarRec->PerWriterCounts[Writer];
+
+    if (!VarRec->PerWriterIncomingData[Writer])
+    {
+        VarRec->PerWriterIncomingData[Writer] =
+            malloc(CalcSize(Dims, RankSize) * ElemSize);
+    }
+    char *Buffer = VarRec->PerWriterIncomingData[Writer];
+
+    /* block local intersection, fastest varying dimension last */
+    size_t *Counts = malloc(Dims * sizeof(Counts[0]));
+    size_t *Left = malloc(Dims * sizeof(Left[0]));
+    size_t *Right = malloc(Dims * sizeof(Right[0]));
+    size_t *Index = malloc(Dims * sizeof(Index[0]));
+    for (size_t Dim = 0; Dim < Dims; Dim++)
+    {
+        const size_t Src =
+            Stream->ConfigParams->IsRowMajor ? Dim : Dims - 1 - Dim;
+        Counts[Dim] = RankSize[Src];
+        Left[Dim] = MAX(RankOffset[Src], Req->Start[Src]) - RankOffset[Src];
+        Right[Dim] = MIN(RankOffset[Src] + RankSize[Src],
+                         Req->Start[Src] + Req->Count[Src]) -
+                     RankOffset[Src];
+        Index[Dim] = Left[Dim];
+    }
+
+    const size_t RowLength = (Right[Dims - 1] - Left[Dims - 1]) * ElemSize;
+    size_t ReadOffset = 0;
+    size_t ReadLength = 0;
+
+    while (1)
+    {
+        size_t RowOffset = 0;
+        for (size_t Dim = 0; Dim < Dims; Dim++)
         {
-            return 0;
+            RowOffset = Index[Dim] + Counts[Dim] * RowOffset;
         }
-        RankOffset = Req->VarRec->PerWriterStart[i][j];
-        RankSize = Req->VarRec->PerWriterCounts[i][j];
-        if ((SelSize == 0) || (RankSize == 0))
+        RowOffset *= ElemSize;
+
+        if (ReadLength && (ReadOffset + ReadLength == RowOffset))
         {
-            return 0;
+            ReadLength += RowLength;
         }
-        if ((RankOffset < SelOffset && (RankOffset + RankSize) <= SelOffset) ||
-            (RankOffset >= SelOffset + SelSize))
+        else
         {
-            return 0;
+            if (ReadLength)
+            {
+                IssuePartialRead(Stream, Writer,
+                                 VarRec->PerWriterDataOffset[Writer], Buffer,
+                                 ReadOffset, ReadLength);
+            }
+            ReadOffset = RowOffset;
+            ReadLength = RowLength;
+        }
+
+        /* next row, odometer over all but the fastest dimension */
+        int Dim = (int)Dims - 2;
+        while (Dim >= 0)
+        {
+            if (++Index[Dim] < Right[Dim])
+            {
+                break;
+            }
+            Index[Dim] = Left[Dim];
+            Dim--;
+        }
+        if (Dim < 0)
+        {
+            break;
         }
     }
-    return 1;
+    IssuePartialRead(Stream, Writer, VarRec->PerWriterDataOffset[Writer],
+                     Buffer, ReadOffset, ReadLength);
+
+    free(Counts);
+    free(Left);
+    free(Right);
+    free(Index);
 }
 
 static void IssueReadRequests(SstStream Stream, FFSArrayRequest Reqs)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    FFSArrayRequest Req = Reqs;
 
-    while (Reqs)
+    for (Req = Reqs; Req; Req = Req->Next)
     {
-        for (int i = 0; i < Stream->WriterCohortSize; i++)
+        for (int j = 0; j < Req->WriterCount; j++)
+        {
+            const int i = Req->Writers[j];
+            if (Info->WriterInfo[i].Status == Empty)
+            {
+                Info->WriterInfo[i].Status =
+                    PartialReadPossible(Stream, i) ? Partial : Needed;
+            }
+        }
+    }
+
+    /* a single unlocated array makes the whole block needed */
+    for (Req = Reqs; Req; Req = Req->Next)
+    {
+        for (int j = 0; j < Req->WriterCount; j++)
         {
-            if (NeedWriter(Reqs, i))
+            const int i = Req->Writers[j];
+            if ((Info->WriterInfo[i].Status == Partial) &&
+                (Req->VarRec->PerWriterDataOffset[i] == (size_t)-1))
             {
                 Info->WriterInfo[i].Status = Needed;
             }
         }
-        Reqs = Reqs->Next;
+    }
+
+    for (Req = Reqs; Req; Req = Req->Next)
+    {
+        for (int j = 0; j < Req->WriterCount; j++)
+        {
+            const int i = Req->Writers[j];
+            if (Info->WriterInfo[i].Status == Partial)
+            {
+                IssuePartialReadRequests(Stream, Req, i);
+            }
+        }
     }
 
     for (int i = 0; i < Stream->WriterCohortSize; i++)
@@ -747,10 +1188,35 @@ static void ClearReadRequests(SstStream Stream)
     while (Req)
     {
         FFSArrayRequest PrevReq = Req;
+        /* partially read blocks only serve the requests they were read for */
+        for (int j = 0; j < Req->WriterCount; j++)
+        {
+            const int i = Req->Writers[j];
+            if (Info->WriterInfo[i].Status == Partial)
+            {
+                free(Req->VarRec->PerWriterIncomingData[i]);
+                Req->VarRec->PerWriterIncomingData[i] = NULL;
+            }
+        }
         Req = Req->Next;
+        free(PrevReq->Start);
+        free(PrevReq->Count);
+        free(PrevReq->Writers);
         free(PrevReq);
     }
     Info->PendingVarRequests = NULL;
+
+    for (int i = 0; i < Stream->WriterCohortSize; i++)
+    {
+        if (Info->WriterInfo[i].Status == Partial)
+        {
+            free(Info->WriterInfo[i].PartialReadHandles);
+            Info->WriterInfo[i].PartialReadHandles = NULL;
+            Info->WriterInfo[i].PartialReadCount = 0;
+            Info->WriterInfo[i].PartialReadSize = 0;
+            Info->WriterInfo[i].Status = Empty;
+        }
+    }
 }
 
 static void DecodeAndPrepareData(SstStream Stream, int Writer)
@@ -833,6 +1299,14 @@ static void WaitForReadRequests(SstStream Stream)
                 /* handle errors here */
             }
         }
+        else if (Info->WriterInfo[i].Status == Partial)
+        {
+            for (int j = 0; j < Info->WriterInfo[i].PartialReadCount; j++)
+            {
+                SstWaitForCompletion(Stream,
+                                     Info->WriterInfo[i].PartialReadHandles[j]);
+            }
+        }
     }
 }
 
@@ -876,9 +1350,6 @@ static int FindOffsetCM(size_t Dims, const size_t *Size, const size_t *Index)
     return Offset;
 }
 
-#define MAX(x, y) (((x) > (y)) ? (x) : (y))
-#define MIN(x, y) (((x) < (y)) ? (x) : (y))
-
 /*
  *  - ElementSize is the byte size of the array elements
  *  - Dims is the number of dimensions in the variable
@@ -1084,33 +1555,33 @@ static void FillReadRequests(SstStream Stream, FFSArrayRequest Reqs)
 {
     while (Reqs)
     {
-        for (int i = 0; i < Stream->WriterCohortSize; i++)
+        for (int j = 0; j < Reqs->WriterCount; j++)
         {
-            if (NeedWriter(Reqs, i))
+            const int i = Reqs->Writers[j];
+            /* this writer fills destination with acquired data */
+            int ElementSize =
+                Reqs->VarRec->PerWriterDataFieldDesc[i]
+                    ? Reqs->VarRec->PerWriterDataFieldDesc[i]->field_size
+                    : Reqs->VarRec->ElemSize;
+            int DimCount = Reqs->VarRec->DimCount;
+            size_t *GlobalDimensions = Reqs->VarRec->GlobalDims;
+            size_t *RankOffset = Reqs->VarRec->PerWriterStart[i];
+            size_t *RankSize = Reqs->VarRec->PerWriterCounts[i];
+            size_t *SelOffset = Reqs->Start;
+            size_t *SelSize = Reqs->Count;
+            void *IncomingData = Reqs->VarRec->PerWriterIncomingData[i];
+
+            if (Stream->ConfigParams->IsRowMajor)
             {
-                /* if needed this writer fill destination with acquired data */
-                int ElementSize =
-                    Reqs->VarRec->PerWriterDataFieldDesc[i]->field_size;
-                int DimCount = Reqs->VarRec->DimCount;
-                size_t *GlobalDimensions = Reqs->VarRec->GlobalDims;
-                size_t *RankOffset = Reqs->VarRec->PerWriterStart[i];
-                size_t *RankSize = Reqs->VarRec->PerWriterCounts[i];
-                size_t *SelOffset = Reqs->Start;
-                size_t *SelSize = Reqs->Count;
-                void *IncomingData = Reqs->VarRec->PerWriterIncomingData[i];
-
-                if (Stream->ConfigParams->IsRowMajor)
-                {
-                    ExtractSelectionFromPartialRM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData, Reqs->Data);
-                }
-                else
-                {
-                    ExtractSelectionFromPartialCM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData, Reqs->Data);
-                }
+                ExtractSelectionFromPartialRM(
+                    ElementSize, DimCount, GlobalDimensions, RankOffset,
+                    RankSize, SelOffset, SelSize, IncomingData, Reqs->Data);
+            }
+            else
+            {
+                ExtractSelectionFromPartialCM(
+                    ElementSize, DimCount, GlobalDimensions, RankOffset,
+                    RankSize, SelOffset, SelSize, IncomingData, Reqs->Data);
             }
         }
         Reqs = Reqs->Next;
@@ -1130,6 +1601,64 @@ extern void SstFFSPerformGets(SstStream Stream)
     ClearReadRequests(Stream);
 }
 
+/*
+ * FFS encodes pointers as offsets from the end of the encoded header
+ * (format ID plus record length, padded to 8 bytes), and copies arrays
+ * verbatim.  Record where each array landed so that readers with the same
+ * byte order can fetch just the ranges they select.
+ *
+ * This relies on the FFSencode layout, which FFS does not export: a header
+ * of (IDLength + sizeof(int) + 7) & ~7 bytes followed by the record, whose
+ * pointers hold offsets from the end of the header.  Each located array is
+ * checked against its source so that a layout change in FFS is reported
+ * and falls back to whole block reads instead of returning wrong data.
+ */
+static void SetArrayDataOffsets(SstStream Stream, const char *Block,
+                                size_t BlockSize)
+{
+    struct FFSWriterMarshalBase *Info = Stream->MarshalData;
+    int IDLength;
+    get_server_ID_FMformat(Info->DataFormat, &IDLength);
+    const size_t HeaderSize = (IDLength + sizeof(int) + 7) & ~7;
+
+    for (int i = 0; i < Info->RecCount; i++)
+    {
+        FFSWriterRec Rec = &Info->RecList[i];
+        if (Rec->SingleValue)
+        {
+            continue;
+        }
+        MetaArrayRec *MetaBase = Stream->M + Rec->MetaOffset;
+        ArrayRec *DataBase = Stream->D + Rec->DataOffset;
+        size_t EncodedOffset;
+        memcpy(&EncodedOffset,
+               Block + HeaderSize + Rec->DataOffset + sizeof(size_t),
+               sizeof(EncodedOffset));
+        MetaBase->DataOffset = HeaderSize + EncodedOffset;
+        const size_t DataSize = DataBase->ElemCount * MetaBase->ElemSize;
+        if (DataSize == 0)
+        {
+            continue;
+        }
+        if ((MetaBase->DataOffset + DataSize > BlockSize) ||
+            (memcmp(Block + MetaBase->DataOffset, DataBase->Array,
+                    MetaBase->ElemSize) != 0) ||
+            (memcmp(Block + MetaBase->DataOffset + DataSize -
+                        MetaBase->ElemSize,
+                    (const char *)DataBase->Array + DataSize -
+                        MetaBase->ElemSize,
+                    MetaBase->ElemSize) != 0))
+        {
+            /* not where we expect it, readers fetch the whole block */
+            CP_error(Stream, "Array data of field %d not found at its "
+                             "expected offset in the FFS encoded data "
+                             "block, partial reads are disabled for it\n",
+                     i);
+            MetaBase->DataOffset = (size_t)-1;
+        }
+    }
+}
+
 extern void SstFFSWriterEndStep(SstStream Stream, size_t Timestep)
 {
     struct FFSWriterMarshalBase *Info =
@@ -1188,6 +1717,7 @@ extern void SstFFSWriterEndStep(SstStream Stream, size_t Timestep)
         FFSencode(DataEncodeBuffer, Info->DataFormat, Stream->D, &DataSize);
     DataRec.DataSize = DataSize;
     TSInfo->DataEncodeBuffer = DataEncodeBuffer;
+    SetArrayDataOffsets(Stream, DataRec.block, DataSize);
 
     MBase = Stream->M;
     MBase->DataBlockSize = DataSize;
@@ -1269,8 +1799,12 @@ extern void FFSClearTimestepData(SstStream Stream)
         free(Info->VarList[i].PerWriterStart);
         free(Info->VarList[i].PerWriterCounts);
         free(Info->VarList[i].PerWriterIncomingData);
+        free(Info->VarList[i].PerWriterDataOffset);
+        free(Info->VarList[i].WriterSpans);
     }
     Info->VarCount = 0;
+    IndexTableClear(&Info->VarByKey);
+    IndexTableClear(&Info->VarByName);
 }
 
 static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
@@ -1356,6 +1890,8 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
         FieldList++;
     while (strncmp(FieldList->field_name, "DataBlockSize", 8) == 0)
         FieldList++;
+    while (strcmp(FieldList->field_name, "DataByteOrder") == 0)
+        FieldList++;
     int i = 0;
 
     while (FieldList[i].field_name)
@@ -1389,6 +1925,7 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
                 VarRec->Variable = Stream->ArraySetupUpcall(
                     Stream->SetupUpcallReader, ArrayName, Type, meta_base->Dims,
                     meta_base->Shape, meta_base->Count, meta_base->Offsets);
+                IndexVarRecByKey(Stream, VarRec);
             }
             if (WriterRank == 0)
             {
@@ -1398,7 +1935,12 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
             VarRec->PerWriterCounts[WriterRank] = meta_base->Count;
             VarRec->PerWriterMetaFieldDesc[WriterRank] = &FieldList[i];
             VarRec->PerWriterDataFieldDesc[WriterRank] = NULL;
-            i += 4;
+            if (meta_base->Offsets)
+            {
+                VarRec->ElemSize = meta_base->ElemSize;
+                VarRec->PerWriterDataOffset[WriterRank] = meta_base->DataOffset;
+            }
+            i += 6;
         }
         else
         {
@@ -1417,6 +1959,7 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
                 VarRec->DimCount = 0;
                 VarRec->Variable = Stream->VarSetupUpcall(
                     Stream->SetupUpcallReader, FieldName, Type, field_data);
+                IndexVarRecByKey(Stream, VarRec);
             }
             VarRec->PerWriterMetaFieldDesc[WriterRank] = &FieldList[i];
             VarRec->PerWriterDataFieldDesc[WriterRank] = NULL;
@@ -1450,11 +1993,11 @@ static void FFSBitfieldSet(struct FFSMetadataInfoStruct *MBase, int Bit)
     {
         MBase->BitField =
             realloc(MBase->BitField, sizeof(size_t) * (Element + 1));
-        memset(MBase->BitField + MBase->BitFieldCount * sizeof(size_t), 0,
+        memset(MBase->BitField + MBase->BitFieldCount, 0,
                (Element - MBase->BitFieldCount + 1) * sizeof(size_t));
         MBase->BitFieldCount = Element + 1;
     }
-    MBase->BitField[Element] |= (1 << ElementBit);
+    MBase->BitField[Element] |= ((size_t)1 << ElementBit);
 }
 
 extern void SstFFSMarshal(SstStream Stream, void *Variable, const char *Name,
@@ -1493,5 +2036,6 @@ extern void SstFFSMarshal(SstStream Stream, void *Variable, const char *Name,
         MetaBase->Shape = CopyDims(DimCount, Shape);
         MetaBase->Count = CopyDims(DimCount, Count);
         MetaBase->Offsets = CopyDims(DimCount, Offsets);
+        MetaBase->ElemSize = ElemSize;
     }
 }
@@ -30,11 +30,29 @@ void Transport::IWrite(const char *buffer, size_t size, Status &status,
     throw std::invalid_argument("ERROR: this class doesn't implement IWrite\n");
 }
 
+void Transport::WriteV(const std::vector<Segment> &segments, size_t start)
+{
+    for (const Segment &segment : segments)
+    {
+        Write(segment.first, segment.second, start);
+        if (start != MaxSizeT)
+        {
+            start += segment.second;
+        }
+    }
+}
+
 void Transport::IRead(char *buffer, size_t size, Status &status, size_t start)
 {
     throw std::invalid_argument("ERROR: this class doesn't implement IRead\n");
 }
 
+const char *Transport::GetMappedData(const size_t /*start*/,
+                                     const size_t /*size*/)
+{
+    return nullptr;
+}
+
 void Transport::InitProfiler(const Mode openMode, const TimeUnit timeUnit)
 {
     m_Profiler.IsActive = true;
@@ -13,6 +13,7 @@
 
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <string>
+#include <utility> //std::pair
 #include <vector>
 /// \endcond
 
@@ -46,6 +47,9 @@ public:
         // TODO add more thing...time?
     };
 
+    /** gather write segment: {address, size in bytes} */
+    using Segment = std::pair<const char *, size_t>;
+
     /**
      * Base constructor that all derived classes pass
      * @param type from derived class
@@ -87,6 +91,16 @@ public:
     virtual void IWrite(const char *buffer, size_t size, Status &status,
                         size_t start = MaxSizeT);
 
+    /**
+     * Gathers segments, in order, into a single write without staging them
+     * in a contiguous buffer. Message based transports send them as one
+     * message. Default calls Write for each segment.
+     * @param segments must remain valid until WriteV returns
+     * @param start as in Write, position of the first segment
+     */
+    virtual void WriteV(const std::vector<Segment> &segments,
+                        size_t start = MaxSizeT);
+
     /**
      * Reads from transport "size" bytes from a certain position. Note that size
      * and position and non-const due to the nature of underlying transport
@@ -102,6 +116,16 @@ public:
     virtual void IRead(char *buffer, size_t size, Status &status,
                        size_t start = MaxSizeT);
 
+    /**
+     * Zero-copy access for transports holding their contents in memory
+     * (e.g. memory-mapped files)
+     * @param start starting position
+     * @param size number of bytes to be accessed
+     * @return pointer to contents at start, nullptr (default) if transport
+     * doesn't support direct access
+     */
+    virtual const char *GetMappedData(const size_t start, const size_t size);
+
     /**
      * Returns the size of current data in transport
      * @return size as size_t
@@ -0,0 +1,222 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMmap.cpp read-only file transport using POSIX memory mapping
+ *
+ *  Created on: Oct 18, 2026
+ */
+#include "FileMmap.h"
+
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <cstring> //std::memcpy
+#include <ios>     //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileMmap::FileMmap(MPI_Comm mpiComm, const bool debugMode)
+: Transport("File", "mmap", mpiComm, debugMode)
+{
+}
+
+FileMmap::~FileMmap()
+{
+    if (m_IsOpen)
+    {
+        if (m_Data != nullptr)
+        {
+            munmap(m_Data, m_Size);
+        }
+        for (const auto &mapping : m_RetiredMappings)
+        {
+            munmap(mapping.first, mapping.second);
+        }
+        close(m_FileDescriptor);
+    }
+}
+
+void FileMmap::Open(const std::string &name, const Mode openMode)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+
+    if (m_OpenMode != Mode::Read)
+    {
+        throw std::invalid_argument(
+            "ERROR: file " + m_Name +
+            " can only be opened in Mode::Read with the mmap library, in "
+            "call to Open\n");
+    }
+
+    ProfilerStart("open");
+    m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+
+    if (m_FileDescriptor == -1)
+    {
+        ProfilerStop("open");
+        throw std::ios_base::failure(
+            "ERROR: couldn't open file " + m_Name +
+            ", check permissions or path existence, in call to mmap Open\n");
+    }
+
+    m_Data = nullptr;
+    m_Size = 0;
+    try
+    {
+        Remap("in call to mmap Open");
+    }
+    catch (...)
+    {
+        ProfilerStop("open");
+        close(m_FileDescriptor);
+        throw;
+    }
+    ProfilerStop("open");
+
+    m_Position = 0;
+    m_IsOpen = true;
+}
+
+void FileMmap::Write(const char * /*buffer*/, size_t /*size*/,
+                     size_t /*start*/)
+{
+    throw std::invalid_argument("ERROR: file " + m_Name +
+                                " is read-only with the mmap library, in "
+                                "call to Write\n");
+}
+
+void FileMmap::Read(char *buffer, size_t size, size_t start)
+{
+    if (start == MaxSizeT)
+    {
+        start = m_Position;
+    }
+
+    CheckRange(start, size, "in call to mmap Read");
+
+    ProfilerStart("read");
+    if (size > 0)
+    {
+        std::memcpy(buffer, m_Data + start, size);
+    }
+    ProfilerStop("read");
+
+    m_Position = start + size;
+}
+
+const char *FileMmap::GetMappedData(const size_t start, const size_t size)
+{
+    CheckRange(start, size, "in call to mmap GetMappedData");
+    return m_Data + start;
+}
+
+size_t FileMmap::GetSize()
+{
+    // a file being written grows, e.g. with IncrementalMetadata
+    Remap("in call to mmap GetSize");
+    return m_Size;
+}
+
+void FileMmap::Flush() {}
+
+void FileMmap::Close()
+{
+    ProfilerStart("close");
+    int status = 0;
+    if (m_Data != nullptr)
+    {
+        status = munmap(m_Data, m_Size);
+        m_Data = nullptr;
+    }
+    for (const auto &mapping : m_RetiredMappings)
+    {
+        if (munmap(mapping.first, mapping.second) == -1)
+        {
+            status = -1;
+        }
+    }
+    m_RetiredMappings.clear();
+
+    if (close(m_FileDescriptor) == -1)
+    {
+        status = -1;
+    }
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to mmap Close\n");
+    }
+
+    m_Size = 0;
+    m_IsOpen = false;
+}
+
+void FileMmap::Remap(const std::string hint)
+{
+    struct stat fileStat;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + ", " + hint + "\n");
+    }
+    const size_t size = static_cast<size_t>(fileStat.st_size);
+
+    // mmap of zero length is invalid, shrinking files are not supported
+    if (size <= m_Size)
+    {
+        return;
+    }
+
+    void *data =
+        mmap(nullptr, size, PROT_READ, MAP_PRIVATE, m_FileDescriptor, 0);
+    if (data == MAP_FAILED)
+    {
+        throw std::ios_base::failure("ERROR: couldn't map file " + m_Name +
+                                     ", " + hint + "\n");
+    }
+    // BP reads are mostly forward seeks through blocks: read ahead of
+    // them instead of prefetching the whole file
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    if (m_Data != nullptr)
+    {
+        m_RetiredMappings.emplace_back(m_Data, m_Size);
+    }
+    m_Data = static_cast<char *>(data);
+    m_Size = size;
+}
+
+void FileMmap::CheckRange(const size_t start, const size_t size,
+                          const std::string hint)
+{
+    if (start > m_Size || size > m_Size - start)
+    {
+        // data appended after the file was mapped
+        Remap(hint);
+    }
+
+    if (start > m_Size || size > m_Size - start)
+    {
+        throw std::ios_base::failure(
+            "ERROR: range [" + std::to_string(start) + ", " +
+            std::to_string(start + size) + ") is out of bounds in file " +
+            m_Name + " of size " + std::to_string(m_Size) + ", " + hint +
+            "\n");
+    }
+}
+
+} // end namespace transport
+} // end namespace adios2
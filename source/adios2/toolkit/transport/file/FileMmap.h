@@ -0,0 +1,95 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMmap.h read-only file transport using POSIX memory mapping
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+
+#include <utility> //std::pair
+#include <vector>
+
+#include "adios2/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace transport
+{
+
+/** Read-only file transport mapping the whole file with POSIX mmap */
+class FileMmap : public Transport
+{
+
+public:
+    FileMmap(MPI_Comm mpiComm, const bool debugMode);
+
+    ~FileMmap();
+
+    /** only Mode::Read is supported */
+    void Open(const std::string &name, const Mode openMode) final;
+
+    /** Not supported, throws an exception */
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /** Copies from the mapping, start = MaxSizeT reads from current position */
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    /**
+     * Pointer into the mapping, valid until Close even if the file grows
+     * and is mapped again
+     */
+    const char *GetMappedData(const size_t start, const size_t size) final;
+
+    /** Current file size, maps the file again if it grew */
+    size_t GetSize() final;
+
+    /** Does nothing, file is read-only */
+    void Flush() final;
+
+    void Close() final;
+
+private:
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+
+    /** start of the read-only mapping, nullptr for empty files */
+    char *m_Data = nullptr;
+
+    /** mapped file size */
+    size_t m_Size = 0;
+
+    /**
+     * {start, size} of mappings replaced by Remap, kept until Close as
+     * GetMappedData pointers into them might still be in use
+     */
+    std::vector<std::pair<char *, size_t>> m_RetiredMappings;
+
+    /** current position for reads without start */
+    size_t m_Position = 0;
+
+    /**
+     * Maps the file again if it grew since it was last mapped
+     * @param hint exception message
+     */
+    void Remap(const std::string hint);
+
+    /**
+     * Checks if [start, start + size) is inside the mapping, maps the file
+     * again first if it is not
+     * @param start input
+     * @param size input
+     * @param hint exception message
+     */
+    void CheckRange(const size_t start, const size_t size,
+                    const std::string hint);
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_ */
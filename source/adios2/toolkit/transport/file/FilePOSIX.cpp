@@ -10,13 +10,17 @@
 #include "FilePOSIX.h"
 
 #include <fcntl.h>     // open
+#include <limits.h>    // IOV_MAX
 #include <stddef.h>    // write output
 #include <sys/stat.h>  // open, fstat
 #include <sys/types.h> // open
+#include <sys/uio.h>   // writev
 #include <unistd.h>    // write, close
 
 /// \cond EXCLUDE_FROM_DOXYGEN
-#include <ios> //std::ios_base::failure
+#include <algorithm> //std::min
+#include <cerrno>    //errno, EINTR
+#include <ios>       //std::ios_base::failure
 /// \endcond
 
 namespace adios2
@@ -133,6 +137,73 @@ void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
     }
 }
 
+void FilePOSIX::WriteV(const std::vector<Segment> &segments, size_t start)
+{
+    std::vector<iovec> iovecs;
+    iovecs.reserve(segments.size());
+    for (const Segment &segment : segments)
+    {
+        if (segment.second > 0)
+        {
+            iovec iov;
+            iov.iov_base = const_cast<char *>(segment.first);
+            iov.iov_len = segment.second;
+            iovecs.push_back(iov);
+        }
+    }
+
+    if (start != MaxSizeT)
+    {
+        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
+
+        if (static_cast<size_t>(newPosition) != start)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't move to start position " +
+                std::to_string(start) + " in file " + m_Name +
+                ", in call to POSIX lseek\n");
+        }
+    }
+
+    size_t first = 0;
+    while (first < iovecs.size())
+    {
+        const int count = static_cast<int>(std::min(
+            iovecs.size() - first, static_cast<size_t>(IOV_MAX)));
+
+        ProfilerStart("write");
+        const auto writtenSize =
+            writev(m_FileDescriptor, &iovecs[first], count);
+        ProfilerStop("write");
+
+        if (writtenSize == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (writtenSize <= 0)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't write to file " + m_Name +
+                ", in call to FileDescriptor WriteV\n");
+        }
+
+        // skip written segments, partial writes continue inside a segment
+        size_t remainder = static_cast<size_t>(writtenSize);
+        while (first < iovecs.size() && remainder >= iovecs[first].iov_len)
+        {
+            remainder -= iovecs[first].iov_len;
+            ++first;
+        }
+        if (remainder > 0)
+        {
+            iovecs[first].iov_base =
+                static_cast<char *>(iovecs[first].iov_base) + remainder;
+            iovecs[first].iov_len -= remainder;
+        }
+    }
+}
+
 void FilePOSIX::Read(char *buffer, size_t size, size_t start)
 {
     auto lf_Read = [&](char *buffer, size_t size) {
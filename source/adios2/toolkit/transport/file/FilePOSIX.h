@@ -32,6 +32,10 @@ public:
 
     void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
 
+    /** Gathers segments with writev, up to IOV_MAX segments per call */
+    void WriteV(const std::vector<Segment> &segments,
+                size_t start = MaxSizeT) final;
+
     void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
 
     size_t GetSize() final;
@@ -10,7 +10,10 @@
 
 #include "WANZmq.h"
 
+#include <algorithm>          //std::min
+#include <condition_variable> //std::condition_variable
 #include <iostream>
+#include <mutex>
 #include <zmq.h>
 
 namespace adios2
@@ -187,12 +190,101 @@ void WANZmq::IWrite(const char *buffer, size_t size, Status &status,
     }
 }
 
+void WANZmq::WriteV(const std::vector<Segment> &segments, size_t start)
+{
+    if (m_WorkflowMode != "subscribe")
+    {
+        // only publish is implemented, as in IWrite
+        return;
+    }
+
+    // zero sized parts are sent by zmq without a release callback
+    std::vector<Segment> parts;
+    for (const Segment &segment : segments)
+    {
+        if (segment.second > 0)
+        {
+            parts.push_back(segment);
+        }
+    }
+    if (parts.empty())
+    {
+        return;
+    }
+
+    struct Release
+    {
+        std::mutex Mutex;
+        std::condition_variable Done;
+        size_t Pending;
+    };
+    Release release;
+    release.Pending = parts.size();
+
+    // called from a zmq I/O thread once a part is sent or dropped
+    auto lf_Release = [](void * /*data*/, void *hint) {
+        Release *release = reinterpret_cast<Release *>(hint);
+        std::lock_guard<std::mutex> lock(release->Mutex);
+        if (--release->Pending == 0)
+        {
+            release->Done.notify_one();
+        }
+    };
+
+    ProfilerStart("write");
+    bool sent = true;
+    for (size_t i = 0; i < parts.size(); ++i)
+    {
+        zmq_msg_t message;
+        zmq_msg_init_data(&message, const_cast<char *>(parts[i].first),
+                          parts[i].second, lf_Release, &release);
+        const int flags = (i + 1 < parts.size()) ? ZMQ_SNDMORE : 0;
+        if (!sent || zmq_msg_send(&message, m_Socket, flags) < 0)
+        {
+            // closing an unsent message releases it
+            zmq_msg_close(&message);
+            sent = false;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(release.Mutex);
+        release.Done.wait(lock, [&release] { return release.Pending == 0; });
+    }
+    ProfilerStop("write");
+
+    if (!sent)
+    {
+        throw std::ios_base::failure("ERROR: couldn't send multipart message " +
+                                     m_Name + ", in call to WANZmq::WriteV\n");
+    }
+}
+
 void WANZmq::IRead(char *buffer, size_t size, Status &status, size_t start)
 {
     if (m_WorkflowMode == "subscribe")
     {
         ProfilerStart("read");
         int bytes = zmq_recv(m_Socket, buffer, size, ZMQ_DONTWAIT);
+        // remaining parts of a multipart message are already available
+        size_t received = (bytes > 0) ? static_cast<size_t>(bytes) : 0;
+        int more = 0;
+        size_t moreSize = sizeof(more);
+        while (bytes >= 0 &&
+               zmq_getsockopt(m_Socket, ZMQ_RCVMORE, &more, &moreSize) == 0 &&
+               more)
+        {
+            const size_t offset = std::min(received, size);
+            bytes = zmq_recv(m_Socket, buffer + offset, size - offset, 0);
+            if (bytes > 0)
+            {
+                received += static_cast<size_t>(bytes);
+            }
+        }
+        if (received > 0)
+        {
+            bytes = static_cast<int>(std::min(received, size));
+        }
         ProfilerStop("read");
         if (bytes > 0)
         {
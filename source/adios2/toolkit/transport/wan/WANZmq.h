@@ -44,8 +44,16 @@ public:
     void IWrite(const char *buffer, size_t size, Status &status,
                 size_t start = MaxSizeT) final;
 
+    /**
+     * Sends segments as parts of one multipart message, zmq references the
+     * segments until it is done sending them, so this waits for their release
+     */
+    void WriteV(const std::vector<Segment> &segments,
+                size_t start = MaxSizeT) final;
+
     void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
 
+    /** Receives a message, parts of multipart messages are concatenated */
     void IRead(char *buffer, size_t size, Status &status,
                size_t start = MaxSizeT) final;
 
@@ -18,6 +18,7 @@
 
 /// transports
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileMmap.h"
 #include "adios2/toolkit/transport/file/FilePOSIX.h"
 #endif
 
@@ -157,6 +158,29 @@ void TransportMan::WriteFiles(const char *buffer, const size_t size,
     }
 }
 
+void TransportMan::WriteFiles(const std::vector<Transport::Segment> &segments,
+                              const int transportIndex)
+{
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                transport->WriteV(segments);
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to WriteFiles with index " +
+                                   std::to_string(transportIndex));
+        itTransport->second->WriteV(segments);
+    }
+}
+
 size_t TransportMan::GetFileSize(const size_t transportIndex) const
 {
     auto itTransport = m_Transports.find(transportIndex);
@@ -174,6 +198,15 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     itTransport->second->Read(buffer, size, start);
 }
 
+const char *TransportMan::GetMappedFile(const size_t size, const size_t start,
+                                        const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to GetMappedFile with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->GetMappedData(start, size);
+}
+
 void TransportMan::FlushFiles(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -260,6 +293,11 @@ TransportMan::OpenFileTransport(const std::string &fileName,
             transport =
                 std::make_shared<transport::FilePOSIX>(m_MPIComm, m_DebugMode);
         }
+        else if (library == "mmap")
+        {
+            transport =
+                std::make_shared<transport::FileMmap>(m_MPIComm, m_DebugMode);
+        }
 #endif
         else
         {
@@ -267,7 +305,7 @@ TransportMan::OpenFileTransport(const std::string &fileName,
             {
                 throw std::invalid_argument(
                     "ERROR: invalid IO AddTransport library " + library +
-                    ", only POSIX, stdio, fstream are supported\n");
+                    ", only POSIX, mmap, stdio, fstream are supported\n");
             }
         }
     };
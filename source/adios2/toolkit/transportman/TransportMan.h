@@ -108,6 +108,15 @@ public:
     void WriteFiles(const char *buffer, const size_t size,
                     const int transportIndex = -1);
 
+    /**
+     * Write segments, in order, to file transports without a contiguous
+     * copy (e.g. data buffer chunks)
+     * @param segments
+     * @param transportIndex
+     */
+    void WriteFiles(const std::vector<Transport::Segment> &segments,
+                    const int transportIndex = -1);
+
     size_t GetFileSize(const size_t transportIndex = 0) const;
 
     /**
@@ -120,6 +129,17 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Zero-copy access to a single file contents, if supported by its
+     * transport (e.g. mmap library)
+     * @param size
+     * @param start
+     * @param transportIndex
+     * @return pointer to file contents at start, nullptr if not supported
+     */
+    const char *GetMappedFile(const size_t size, const size_t start = 0,
+                              const size_t transportIndex = 0);
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
@@ -8,8 +8,13 @@
  *      Author: Jason Wang wangr1@ornl.gov
  */
 
-#include <fstream>  //TODO go away
-#include <iostream> //TODO go away
+#include <algorithm> //std::min
+#include <cstring>   //std::memcpy
+#include <exception> //std::current_exception
+#include <fstream>   //TODO go away
+#include <iostream>  //TODO go away
+#include <memory>    //std::unique_ptr
+#include <stdexcept> //std::runtime_error
 
 #include "DataMan.h"
 
@@ -37,9 +42,13 @@ DataMan::~DataMan()
         m_Reading = false;
         readThread.join();
     }
-    for (auto &writeThread : m_WriteThreads)
     {
+        std::lock_guard<std::mutex> l(m_WriteMutex);
         m_Writing = false;
+    }
+    m_WriteCondition.notify_all();
+    for (auto &writeThread : m_WriteThreads)
+    {
         writeThread.join();
     }
 }
@@ -52,16 +61,15 @@ void DataMan::OpenWANTransports(const std::vector<std::string> &streamNames,
                                 const bool profile)
 {
     m_TransportsParameters = paramsVector;
-    m_TransportChannels = streamNames.size();
 
     if (streamNames.size() == 0)
     {
         throw("No streams to open from DataMan::OpenWANTransports");
     }
 
-    m_BufferQueue.resize(m_TransportChannels);
-
-    for (size_t i = 0; i < m_TransportChannels; ++i)
+    std::vector<std::vector<std::shared_ptr<Transport>>> transports(
+        streamNames.size());
+    for (size_t i = 0; i < streamNames.size(); ++i)
     {
 
         // Get parameters
@@ -78,6 +86,19 @@ void DataMan::OpenWANTransports(const std::vector<std::string> &streamNames,
         std::string workflowMode;
         GetStringParameter(paramsVector[i], "WorkflowMode", workflowMode);
 
+        size_t stripes = 1;
+        std::string stripesValue;
+        if (GetStringParameter(paramsVector[i], "Stripes", stripesValue))
+        {
+            stripes = static_cast<size_t>(std::stoul(stripesValue));
+            if (stripes == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: Stripes must be at least 1 for wan transport " +
+                    std::to_string(i) + ", in call to Open\n");
+            }
+        }
+
         // Calculate port number
         int mpiRank, mpiSize;
         MPI_Comm_rank(m_MPIComm, &mpiRank);
@@ -86,34 +107,24 @@ void DataMan::OpenWANTransports(const std::vector<std::string> &streamNames,
         {
             port = std::to_string(stoi(port) + i * mpiSize);
         }
-        port = std::to_string(stoi(port) + mpiRank);
 
         // Create transports
-        std::shared_ptr<Transport> wanTransport;
-
         if (library == "zmq" || library == "ZMQ")
         {
 #ifdef ADIOS2_HAVE_ZEROMQ
-
-            wanTransport = std::make_shared<transport::WANZmq>(
-                ip, port, m_MPIComm, workflowMode, m_DebugMode);
-            wanTransport->Open(streamNames[i], mode);
-            m_Transports.emplace(i, wanTransport);
-
-            if (mode == Mode::Read)
+            // stripe s of a rank listens on port + rank * stripes + s, both
+            // sides agree on Stripes but not necessarily on their MPI sizes
+            for (size_t s = 0; s < stripes; ++s)
             {
-                m_Reading = true;
-                m_ReadThreads.emplace_back(
-                    std::thread(&DataMan::ReadThread, this, wanTransport));
+                const std::string stripePort =
+                    std::to_string(stoi(port) + mpiRank * stripes + s);
+
+                std::shared_ptr<Transport> wanTransport =
+                    std::make_shared<transport::WANZmq>(
+                        ip, stripePort, m_MPIComm, workflowMode, m_DebugMode);
+                wanTransport->Open(streamNames[i], mode);
+                transports[i].push_back(wanTransport);
             }
-
-            else if (mode == Mode::Write)
-            {
-                m_Writing = true;
-                m_WriteThreads.emplace_back(
-                    std::thread(&DataMan::WriteThread, this, wanTransport, i));
-            }
-
 #else
             throw std::invalid_argument(
                 "ERROR: this version of ADIOS2 didn't compile with "
@@ -131,11 +142,67 @@ void DataMan::OpenWANTransports(const std::vector<std::string> &streamNames,
             }
         }
     }
+
+    OpenTransports(transports, mode);
+}
+
+void DataMan::OpenTransports(
+    const std::vector<std::vector<std::shared_ptr<Transport>>> &transports,
+    const Mode mode)
+{
+    m_TransportChannels = transports.size();
+
+    m_BufferQueue.clear();
+    for (size_t i = 0; i < m_TransportChannels; ++i)
+    {
+        m_BufferQueue.emplace_back(new BufferQueue(m_ReceiveQueueSize));
+    }
+    m_Stripes.assign(m_TransportChannels, 1);
+    m_WriteQueues.resize(m_TransportChannels);
+    m_Messages.assign(m_TransportChannels, 0);
+    m_StripeAssemblies.resize(m_TransportChannels);
+
+    for (size_t i = 0; i < m_TransportChannels; ++i)
+    {
+        if (transports[i].empty())
+        {
+            continue;
+        }
+        m_Stripes[i] = transports[i].size();
+        m_WriteQueues[i].resize(m_Stripes[i]);
+        m_Transports.emplace(i, transports[i].front());
+
+        for (size_t s = 0; s < m_Stripes[i]; ++s)
+        {
+            if (mode == Mode::Read)
+            {
+                m_Reading = true;
+                m_ReadThreads.emplace_back(std::thread(
+                    &DataMan::ReadThread, this, transports[i][s], i));
+            }
+
+            else if (mode == Mode::Write)
+            {
+                m_Writing = true;
+                m_WriteThreads.emplace_back(std::thread(
+                    &DataMan::WriteThread, this, transports[i][s], i, s));
+            }
+        }
+    }
 }
 
 void DataMan::WriteWAN(std::shared_ptr<std::vector<char>> buffer, size_t id)
 {
-    PushBufferQueue(buffer, id);
+    PushWriteQueues({{buffer->data(), buffer->size()}}, buffer, nullptr, id);
+}
+
+std::future<void>
+DataMan::WriteWAN(const std::vector<Transport::Segment> &segments, size_t id)
+{
+    auto completion = std::make_shared<WriteCompletion>();
+    std::future<void> released = completion->Released.get_future();
+    PushWriteQueues(segments, nullptr, completion, id);
+    return released;
 }
 
 void DataMan::WriteWAN(const std::vector<char> &buffer, size_t transportId)
@@ -156,51 +223,269 @@ std::shared_ptr<std::vector<char>> DataMan::ReadWAN(size_t id)
 
 void DataMan::PushBufferQueue(std::shared_ptr<std::vector<char>> v, size_t id)
 {
-    std::lock_guard<std::mutex> l(m_Mutex);
-    m_BufferQueue[id].push(v);
+    // a full queue stops receiving, the transport applies its own policy
+    while (!m_BufferQueue[id]->TryPush(v))
+    {
+        if (!m_Reading)
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
 }
 
 std::shared_ptr<std::vector<char>> DataMan::PopBufferQueue(size_t id)
 {
-    std::lock_guard<std::mutex> l(m_Mutex);
-    if (m_BufferQueue[id].size() > 0)
+    std::shared_ptr<std::vector<char>> vec;
+    if (id < m_BufferQueue.size())
+    {
+        m_BufferQueue[id]->TryPop(vec);
+    }
+    return vec;
+}
+
+void DataMan::PushWriteQueues(const std::vector<Transport::Segment> &segments,
+                              std::shared_ptr<std::vector<char>> buffer,
+                              std::shared_ptr<WriteCompletion> completion,
+                              const size_t channel)
+{
+    const size_t stripes = m_Stripes[channel];
+    if (completion != nullptr)
+    {
+        completion->Pending = stripes;
+    }
+
+    if (stripes == 1)
+    {
+        WriteRequest request;
+        request.Segments = segments;
+        request.Buffer = buffer;
+        request.Completion = completion;
+
+        {
+            std::lock_guard<std::mutex> l(m_WriteMutex);
+            m_WriteQueues[channel][0].push(std::move(request));
+        }
+        m_WriteCondition.notify_all();
+        return;
+    }
+
+    size_t size = 0;
+    for (const Transport::Segment &segment : segments)
+    {
+        size += segment.second;
+    }
+
+    StripeHeader header;
+    header.Message = m_Messages[channel]++;
+    header.Size = size;
+
+    // stripe s gets bytes [s * size / stripes, (s + 1) * size / stripes)
+    std::vector<WriteRequest> requests(stripes);
+    size_t segmentIndex = 0;
+    size_t segmentOffset = 0;
+    for (size_t s = 0; s < stripes; ++s)
+    {
+        const size_t begin = s * size / stripes;
+        const size_t end = (s + 1) * size / stripes;
+
+        header.Offset = begin;
+        WriteRequest &request = requests[s];
+        request.Header.resize(sizeof(header));
+        std::memcpy(request.Header.data(), &header, sizeof(header));
+        request.Buffer = buffer;
+        request.Completion = completion;
+
+        size_t remaining = end - begin;
+        while (remaining > 0)
+        {
+            const Transport::Segment &segment = segments[segmentIndex];
+            const size_t length =
+                std::min(remaining, segment.second - segmentOffset);
+            request.Segments.emplace_back(segment.first + segmentOffset,
+                                          length);
+            remaining -= length;
+            segmentOffset += length;
+            if (segmentOffset == segment.second)
+            {
+                ++segmentIndex;
+                segmentOffset = 0;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> l(m_WriteMutex);
+        for (size_t s = 0; s < stripes; ++s)
+        {
+            m_WriteQueues[channel][s].push(std::move(requests[s]));
+        }
+    }
+    m_WriteCondition.notify_all();
+}
+
+bool DataMan::PopWriteQueue(const size_t channel, const size_t stripe,
+                            WriteRequest &request)
+{
+    std::unique_lock<std::mutex> l(m_WriteMutex);
+    std::queue<WriteRequest> &queue = m_WriteQueues[channel][stripe];
+    m_WriteCondition.wait(l, [&] { return !m_Writing || !queue.empty(); });
+    if (queue.empty())
+    {
+        return false;
+    }
+    request = std::move(queue.front());
+    queue.pop();
+    return true;
+}
+
+void DataMan::CompleteWrite(WriteCompletion &completion,
+                            std::exception_ptr exception)
+{
+    std::lock_guard<std::mutex> l(completion.Mutex);
+    if (exception != nullptr && completion.Exception == nullptr)
+    {
+        completion.Exception = exception;
+    }
+    if (--completion.Pending > 0)
+    {
+        return;
+    }
+    if (completion.Exception != nullptr)
+    {
+        completion.Released.set_exception(completion.Exception);
+    }
+    else
     {
-        std::shared_ptr<std::vector<char>> vec = m_BufferQueue[id].front();
-        m_BufferQueue[id].pop();
-        return vec;
+        completion.Released.set_value();
     }
-    return nullptr;
 }
 
-void DataMan::WriteThread(std::shared_ptr<Transport> transport, size_t id)
+void DataMan::WriteThread(std::shared_ptr<Transport> transport,
+                          size_t channel, size_t stripe)
 {
     while (m_Writing)
     {
-        Transport::Status status;
-        std::shared_ptr<std::vector<char>> buffer = PopBufferQueue(id);
-        if (buffer != nullptr)
+        WriteRequest request;
+        if (!PopWriteQueue(channel, stripe, request))
         {
-            if (buffer->size() > 0)
+            continue;
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            if (request.Completion == nullptr && request.Header.empty())
+            {
+                // owned contiguous buffer, zmq copies it
+                Transport::Status status;
+                const Transport::Segment &segment = request.Segments.front();
+                if (segment.second > 0)
+                {
+                    transport->IWrite(segment.first, segment.second, status);
+                }
+            }
+            else
             {
-                transport->IWrite(buffer->data(), buffer->size(), status);
+                std::vector<Transport::Segment> segments;
+                segments.reserve(request.Segments.size() + 1);
+                if (!request.Header.empty())
+                {
+                    segments.emplace_back(request.Header.data(),
+                                          request.Header.size());
+                }
+                segments.insert(segments.end(), request.Segments.begin(),
+                                request.Segments.end());
+                transport->WriteV(segments);
             }
         }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        if (request.Completion != nullptr)
+        {
+            CompleteWrite(*request.Completion, exception);
+        }
+    }
+
+    // writers waiting on queued segments must not block forever
+    WriteRequest request;
+    while (PopWriteQueue(channel, stripe, request))
+    {
+        if (request.Completion != nullptr)
+        {
+            CompleteWrite(*request.Completion,
+                          std::make_exception_ptr(std::runtime_error(
+                              "ERROR: transport closed before sending "
+                              "segments, in call to DataMan WriteWAN\n")));
+        }
     }
 }
 
-void DataMan::ReadThread(std::shared_ptr<Transport> transport)
+void DataMan::PushStripe(const char *data, const size_t size,
+                         const size_t channel)
 {
-    std::vector<char> buffer(m_MaxReceiveBuffer);
+    StripeHeader header;
+    if (size < sizeof(header))
+    {
+        return;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    data += sizeof(header);
+    const size_t length = size - sizeof(header);
+    if (header.Size == 0 || header.Offset + length > header.Size)
+    {
+        return;
+    }
+
+    // also makes the stripe threads of a channel a single queue producer
+    std::lock_guard<std::mutex> l(m_StripeMutex);
+    std::map<uint64_t, StripeAssembly> &assemblies =
+        m_StripeAssemblies[channel];
+
+    StripeAssembly &assembly = assemblies[header.Message];
+    if (assembly.Buffer == nullptr)
+    {
+        assembly.Buffer = std::make_shared<std::vector<char>>(header.Size);
+    }
+    std::memcpy(assembly.Buffer->data() + header.Offset, data, length);
+    ++assembly.Parts;
+
+    if (assembly.Parts < m_Stripes[channel])
+    {
+        return;
+    }
+    std::shared_ptr<std::vector<char>> buffer = assembly.Buffer;
+
+    // stripes are ordered, older incomplete messages lost a part
+    assemblies.erase(assemblies.begin(),
+                     assemblies.upper_bound(header.Message));
+
+    PushBufferQueue(buffer, channel);
+}
+
+void DataMan::ReadThread(std::shared_ptr<Transport> transport,
+                         size_t channel)
+{
+    // uninitialized, pages are only touched by received messages
+    std::unique_ptr<char[]> buffer(new char[m_MaxReceiveBuffer]);
     while (m_Reading)
     {
         Transport::Status status;
-        transport->IRead(buffer.data(), m_MaxReceiveBuffer, status);
+        transport->IRead(buffer.get(), m_MaxReceiveBuffer, status);
         if (status.Bytes > 0)
         {
+            if (m_Stripes[channel] > 1)
+            {
+                PushStripe(buffer.get(), status.Bytes, channel);
+                continue;
+            }
             std::shared_ptr<std::vector<char>> bufferQ =
                 std::make_shared<std::vector<char>>(status.Bytes);
-            std::memcpy(bufferQ->data(), buffer.data(), status.Bytes);
-            PushBufferQueue(bufferQ, 0);
+            std::memcpy(bufferQ->data(), buffer.get(), status.Bytes);
+            PushBufferQueue(bufferQ, channel);
         }
     }
 }
@@ -11,6 +11,10 @@
 #ifndef ADIOS2_TOOLKIT_TRANSPORTMAN_DATAMAN_DATAMAN_H_
 #define ADIOS2_TOOLKIT_TRANSPORTMAN_DATAMAN_DATAMAN_H_
 
+#include <condition_variable>
+#include <exception> //std::exception_ptr
+#include <future>
+#include <map>
 #include <queue>
 #include <thread>
 
@@ -18,6 +22,7 @@
 #include "adios2/core/Operator.h"
 #include "adios2/toolkit/format/bp3/BP3.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
+#include "adios2/toolkit/transportman/dataman/SPSCQueue.h"
 
 namespace adios2
 {
@@ -37,10 +42,38 @@ public:
                            const std::vector<Params> &parametersVector,
                            const bool profile);
 
+    /**
+     * Opens channels on already open transports, OpenWANTransports creates
+     * them from parameters
+     * @param transports [channel][stripe], a channel with more than one
+     * transport is striped
+     * @param openMode Mode::Write starts a writer thread per transport,
+     * Mode::Read a reader thread per transport
+     */
+    void OpenTransports(
+        const std::vector<std::vector<std::shared_ptr<Transport>>> &transports,
+        const Mode openMode);
+
     void WriteWAN(const std::vector<char> &buffer, size_t transportId);
     void WriteWAN(std::shared_ptr<std::vector<char>> buffer,
                   size_t transportId);
 
+    /**
+     * Queues segments to be sent as a single message without copying them
+     * into a contiguous buffer, striped channels send a part per stripe
+     * @param segments must remain valid until the returned future is ready
+     * @param transportId
+     * @return ready once the transport released all segments
+     */
+    std::future<void> WriteWAN(const std::vector<Transport::Segment> &segments,
+                               size_t transportId);
+
+    /**
+     * Pops a received message of a channel, called by a single consumer
+     * thread
+     * @param id channel
+     * @return nullptr if no message is queued
+     */
     std::shared_ptr<std::vector<char>> ReadWAN(size_t id);
 
     void SetMaxReceiveBuffer(size_t size);
@@ -49,22 +82,95 @@ private:
     bool m_Blocking = true;
     std::function<void(std::vector<char>)> m_Callback;
 
-    // Objects for buffer queue
-    std::vector<std::queue<std::shared_ptr<std::vector<char>>>> m_BufferQueue;
+    // Objects for received buffer queue, one producer per channel: its read
+    // thread, or its stripe threads under m_StripeMutex
+    using BufferQueue = SPSCQueue<std::shared_ptr<std::vector<char>>>;
+    std::vector<std::unique_ptr<BufferQueue>> m_BufferQueue;
+    /** received messages buffered per channel before read threads block */
+    size_t m_ReceiveQueueSize = 256;
     void PushBufferQueue(std::shared_ptr<std::vector<char>> v, size_t id);
     std::shared_ptr<std::vector<char>> PopBufferQueue(size_t id);
-    std::mutex m_Mutex;
+
+    /** shared by the requests of a message, released when all are sent */
+    struct WriteCompletion
+    {
+        std::mutex Mutex;
+        size_t Pending = 0;
+        std::exception_ptr Exception;
+        std::promise<void> Released;
+    };
+
+    /** message, or part of a striped message, for one socket */
+    struct WriteRequest
+    {
+        /** StripeHeader, empty if channel is not striped */
+        std::vector<char> Header;
+        std::vector<Transport::Segment> Segments;
+        /** owner of Segments memory, nullptr if owned by the caller */
+        std::shared_ptr<std::vector<char>> Buffer;
+        std::shared_ptr<WriteCompletion> Completion;
+    };
+
+    /** prefix of each part of a striped message */
+    struct StripeHeader
+    {
+        uint64_t Message;
+        uint64_t Size;
+        uint64_t Offset;
+    };
+
+    /** received parts of a striped message */
+    struct StripeAssembly
+    {
+        std::shared_ptr<std::vector<char>> Buffer;
+        /** parts, not bytes: parts of messages smaller than the stripes
+         * are empty */
+        size_t Parts = 0;
+    };
+
+    /** Stripes transport parameter per channel, 1 is not striped */
+    std::vector<size_t> m_Stripes;
+    /** [channel][stripe] writer queues, one thread each */
+    std::vector<std::vector<std::queue<WriteRequest>>> m_WriteQueues;
+    std::mutex m_WriteMutex;
+    /** notified when a request is queued or writing stops */
+    std::condition_variable m_WriteCondition;
+    /** next striped message id per channel */
+    std::vector<uint64_t> m_Messages;
+
+    /** [channel] message id -> parts received so far */
+    std::vector<std::map<uint64_t, StripeAssembly>> m_StripeAssemblies;
+    std::mutex m_StripeMutex;
+
+    /**
+     * Queues message segments to the channel sockets, split in equal byte
+     * ranges across stripes
+     */
+    void PushWriteQueues(const std::vector<Transport::Segment> &segments,
+                         std::shared_ptr<std::vector<char>> buffer,
+                         std::shared_ptr<WriteCompletion> completion,
+                         const size_t channel);
+    /** Waits for a request while writing, returns false if none */
+    bool PopWriteQueue(const size_t channel, const size_t stripe,
+                       WriteRequest &request);
+    void CompleteWrite(WriteCompletion &completion,
+                       std::exception_ptr exception);
+
+    /** Adds a received part, queues its message buffer once complete */
+    void PushStripe(const char *data, const size_t size,
+                    const size_t channel);
 
     // Functions for parsing parameters
     bool GetBoolParameter(const Params &params, std::string key);
     bool GetStringParameter(const Params &params, std::string key,
                             std::string &value);
 
-    void ReadThread(std::shared_ptr<Transport> transport);
+    void ReadThread(std::shared_ptr<Transport> transport, size_t channel);
     std::vector<std::thread> m_ReadThreads;
     bool m_Reading = false;
 
-    void WriteThread(std::shared_ptr<Transport> transport, size_t id);
+    void WriteThread(std::shared_ptr<Transport> transport, size_t channel,
+                     size_t stripe);
     std::vector<std::thread> m_WriteThreads;
     bool m_Writing = false;
 
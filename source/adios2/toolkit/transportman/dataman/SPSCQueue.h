@@ -0,0 +1,104 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * SPSCQueue.h : bounded lock-free ring queue with one producer thread and
+ * one consumer thread
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORTMAN_DATAMAN_SPSCQUEUE_H_
+#define ADIOS2_TOOLKIT_TRANSPORTMAN_DATAMAN_SPSCQUEUE_H_
+
+#include <atomic>
+#include <cstddef> //std::size_t
+#include <utility> //std::move
+#include <vector>
+
+namespace adios2
+{
+namespace transportman
+{
+
+/**
+ * Only the producer writes m_Tail and only the consumer writes m_Head, each
+ * publishes its slot with release and reads the other index with acquire.
+ * Indices grow without wrapping the slot count, one slot is never wasted.
+ */
+template <class T>
+class SPSCQueue
+{
+
+public:
+    /** @param capacity rounded up to a power of 2 */
+    explicit SPSCQueue(const size_t capacity = 256)
+    {
+        size_t slots = 1;
+        while (slots < capacity)
+        {
+            slots <<= 1;
+        }
+        m_Slots.resize(slots);
+        m_Mask = slots - 1;
+    }
+
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    /** producer only, @return false if full, value is left untouched */
+    bool TryPush(T &value)
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) > m_Mask)
+        {
+            return false;
+        }
+        m_Slots[tail & m_Mask] = std::move(value);
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** consumer only, @return false if empty */
+    bool TryPop(T &value)
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_Tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = std::move(m_Slots[head & m_Mask]);
+        m_Slots[head & m_Mask] = T();
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** approximate unless called from the producer or consumer */
+    size_t Size() const noexcept
+    {
+        return m_Tail.load(std::memory_order_acquire) -
+               m_Head.load(std::memory_order_acquire);
+    }
+
+    size_t Capacity() const noexcept { return m_Mask + 1; }
+
+private:
+    std::vector<T> m_Slots;
+    size_t m_Mask = 0;
+
+    /** padded, not alignas: operator new before C++17 ignores over-alignment.
+     * Members 64 bytes apart never share a cache line, so each index is not
+     * invalidated by writes to the other one, or read with m_Slots. */
+    static constexpr size_t m_CacheLineSize = 64;
+
+    char m_HeadPadding[m_CacheLineSize];
+    std::atomic<size_t> m_Head{0};
+    char m_TailPadding[m_CacheLineSize - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> m_Tail{0};
+    char m_EndPadding[m_CacheLineSize - sizeof(std::atomic<size_t>)];
+};
+
+} // end namespace transportman
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORTMAN_DATAMAN_SPSCQUEUE_H_ */
@@ -122,6 +122,43 @@ if(inR32[0] != data.R32[0]):
 if(inR64[0] != data.R64[0]):
     raise ValueError('gvarR64 read failed')
 
+# Read into preallocated arrays
+outI32 = np.zeros(count, dtype=np.int32)
+fr.read_into("varI32", outI32, start, count)
+if not (outI32 == data.I32).all():
+    raise ValueError('I32 read_into failed')
+
+outgI64 = np.zeros(1, dtype=np.int64)
+fr.read_into("gvarI64", outgI64)
+if(outgI64[0] != data.I64[0]):
+    raise ValueError('gvarI64 read_into failed')
+
+rejected = False
+try:
+    fr.read_into("varI32", np.zeros(count, dtype=np.float64), start, count)
+except ValueError:
+    rejected = True
+if not rejected:
+    raise ValueError('read_into accepted a numpy array of a different type')
+
+# Deferred reads executed at once
+outU16 = np.zeros(count, dtype=np.uint16)
+outR32 = np.zeros(count, dtype=np.float32)
+outR64 = np.zeros(count, dtype=np.float64)
+fr.read_deferred("varU16", outU16, start, count)
+fr.read_deferred("varR32", outR32, start, count)
+fr.read_deferred("varR64", outR64, start, count)
+fr.perform_gets()
+
+if not (outU16 == data.U16).all():
+    raise ValueError('U16 read_deferred failed')
+
+if not (outR32 == data.R32).all():
+    raise ValueError('R32 read_deferred failed')
+
+if not (outR64 == data.R64).all():
+    raise ValueError('R64 read_deferred failed')
+
 i = 0
 
 while(not fr.eof()):
@@ -195,3 +232,43 @@ while(not fr.eof()):
         raise ValueError('R64 array read failed')
 
 fr.close()
+
+# Reads overlapping pending deferred reads, data differs in each step
+fw = adios2.open("types_deferred_np.bp", "w", comm)
+for i in range(0, 3):
+    fw.write("varR64", data.R64 + i, shape, start, count, True)
+fw.close()
+
+fr = adios2.open("types_deferred_np.bp", "r", comm)
+
+i = 0
+while(not fr.eof()):
+    # a read of the same variable performs the pending deferred read first
+    deferredR64 = np.zeros(count, dtype=np.float64)
+    fr.read_deferred("varR64", deferredR64, start, count)
+    firstR64 = np.zeros(1, dtype=np.float64)
+    fr.read_into("varR64", firstR64, start, [1])
+
+    # advancing the step performs the pending deferred read at this step
+    stepR64 = np.zeros(count, dtype=np.float64)
+    fr.read_deferred("varR64", stepR64, start, count)
+    lastR64 = fr.read("varR64", [start[0] + nx - 1], [1], True)
+
+    if not (deferredR64 == data.R64 + i).all():
+        raise ValueError('R64 read_deferred before read_into failed')
+
+    if(firstR64[0] != data.R64[0] + i):
+        raise ValueError('R64 read_into after read_deferred failed')
+
+    if not (stepR64 == data.R64 + i).all():
+        raise ValueError('R64 read_deferred before end of step failed')
+
+    if(lastR64[0] != data.R64[nx - 1] + i):
+        raise ValueError('R64 read at end of step failed')
+
+    i = i + 1
+
+fr.close()
+
+if(i != 3):
+    raise ValueError('R64 deferred reads steps failed')
@@ -920,6 +920,104 @@ TEST_F(BPWriteAggregateReadTest, ADIOS2BPWriteAggregateSubStreamsException)
     io.SetParameter("Substreams", std::to_string(mpiSize + 1));
     EXPECT_NO_THROW(io.Open(fname, adios2::Mode::Write));
 }
+//******************************************************************************
+// 1D test data with each AggregationType, varying sizes per rank
+//******************************************************************************
+
+TEST_F(BPWriteAggregateReadTest, ADIOS2BPWriteAggregationTypesRead1D)
+{
+    int mpiRank = 0, mpiSize = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+
+    // rank r writes Nx + r elements, so node offsets differ per rank
+    const size_t Nx = 10;
+    const size_t NSteps = 3;
+    auto lf_Start = [&](const int rank) -> size_t {
+        return static_cast<size_t>(rank) * Nx +
+               static_cast<size_t>(rank * (rank - 1) / 2);
+    };
+    const size_t globalNx = lf_Start(mpiSize);
+    const size_t localNx = Nx + static_cast<size_t>(mpiRank);
+
+    std::vector<int> subStreamsCases{1};
+    if (mpiSize / 2 > 1)
+    {
+        subStreamsCases.push_back(mpiSize / 2);
+    }
+
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+
+    for (const std::string aggregationType :
+         {"MPIChain", "MPIShmChain", "MPITree", "MPIGatherv"})
+    {
+        for (const int subStreams : subStreamsCases)
+        {
+            const std::string fname("ADIOS2BPWriteAggregationTypesRead1D_" +
+                                    aggregationType + "_" +
+                                    std::to_string(subStreams) + ".bp");
+            {
+                adios2::IO io = adios.DeclareIO("WriteIO" + fname);
+                io.SetParameters({{"Substreams", std::to_string(subStreams)},
+                                  {"AggregationType", aggregationType}});
+
+                auto var_r64 = io.DefineVariable<double>(
+                    "r64", {globalNx}, {lf_Start(mpiRank)}, {localNx});
+
+                adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+                std::vector<double> R64(localNx);
+                for (size_t step = 0; step < NSteps; ++step)
+                {
+                    for (size_t i = 0; i < localNx; ++i)
+                    {
+                        R64[i] = static_cast<double>(step * globalNx +
+                                                     lf_Start(mpiRank) + i);
+                    }
+                    bpWriter.BeginStep();
+                    bpWriter.Put(var_r64, R64.data());
+                    bpWriter.EndStep();
+                }
+                bpWriter.Close();
+            }
+
+            {
+                adios2::IO io = adios.DeclareIO("ReadIO" + fname);
+                adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+                auto var_r64 = io.InquireVariable<double>("r64");
+                EXPECT_TRUE(var_r64);
+                ASSERT_EQ(var_r64.Steps(), NSteps);
+                ASSERT_EQ(var_r64.Shape()[0], globalNx);
+
+                std::vector<double> R64(globalNx);
+                for (size_t t = 0; t < NSteps; ++t)
+                {
+                    var_r64.SetStepSelection({t, 1});
+                    bpReader.Get(var_r64, R64.data(), adios2::Mode::Sync);
+
+                    for (size_t i = 0; i < globalNx; ++i)
+                    {
+                        EXPECT_EQ(R64[i], static_cast<double>(t * globalNx + i))
+                            << "t=" << t << " i=" << i << " rank=" << mpiRank
+                            << " " << aggregationType
+                            << " substreams=" << subStreams;
+                    }
+                }
+                bpReader.Close();
+            }
+        }
+    }
+}
+
+TEST_F(BPWriteAggregateReadTest, ADIOS2BPWriteAggregationTypeException)
+{
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+    adios2::IO io = adios.DeclareIO("TestIO");
+    io.SetParameter("AggregationType", "MPIUnknown");
+    EXPECT_THROW(io.Open("dummy.bp", adios2::Mode::Write),
+                 std::invalid_argument);
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
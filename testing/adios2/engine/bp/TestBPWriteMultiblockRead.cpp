@@ -2,18 +2,89 @@
  * Distributed under the OSI-approved Apache License, Version 2.0.  See
  * accompanying file Copyright.txt for details.
  */
+#include <algorithm> //std::fill
 #include <cstdint>
 #include <cstring>
 
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility> //std::pair
+#include <vector>
 
 #include <adios2.h>
 
+#include "adios2/core/ADIOS.h"
+#include "adios2/core/Engine.h"
+#include "adios2/core/IO.h"
+#include "adios2/core/Variable.h"
+#include "adios2/helper/adiosSystem.h"
+
 #include <gtest/gtest.h>
 
 #include "../SmallTestData.h"
 
+namespace
+{
+
+/** element (row, col) of the 2D variables of the subfiles test at step */
+template <class T>
+T SubFilesValue(const size_t step, const size_t row, const size_t col);
+
+template <>
+int32_t SubFilesValue(const size_t step, const size_t row, const size_t col)
+{
+    return static_cast<int32_t>(step * 100000 + row * 100 + col);
+}
+
+template <>
+int8_t SubFilesValue(const size_t step, const size_t row, const size_t col)
+{
+    return static_cast<int8_t>((step * 7 + row * 3 + col) % 127);
+}
+
+template <>
+double SubFilesValue(const size_t step, const size_t row, const size_t col)
+{
+    return static_cast<double>(step) + 0.5 * row + 0.001 * col;
+}
+
+/** rows [row0, row0 + rows) of a row-major variable with cols columns */
+template <class T>
+std::vector<T> SubFilesRows(const size_t step, const size_t row0,
+                            const size_t rows, const size_t cols)
+{
+    std::vector<T> data(rows * cols);
+    for (size_t r = 0; r < rows; ++r)
+    {
+        for (size_t c = 0; c < cols; ++c)
+        {
+            data[r * cols + c] = SubFilesValue<T>(step, row0 + r, c);
+        }
+    }
+    return data;
+}
+
+/** checks rows x [col0, col0 + cols) read at step */
+template <class T>
+void ExpectSubFilesSelection(const std::vector<T> &data, const size_t step,
+                             const size_t rows, const size_t col0,
+                             const size_t cols, const std::string &name)
+{
+    ASSERT_EQ(data.size(), rows * cols);
+    for (size_t r = 0; r < rows; ++r)
+    {
+        for (size_t c = 0; c < cols; ++c)
+        {
+            ASSERT_EQ(data[r * cols + c], SubFilesValue<T>(step, r, col0 + c))
+                << name << " step=" << step << " row=" << r
+                << " col=" << col0 + c;
+        }
+    }
+}
+
+} // end anonymous namespace
+
 class BPWriteMultiblockReadTest : public ::testing::Test
 {
 public:
@@ -990,6 +1061,264 @@ TEST_F(BPWriteMultiblockReadTest, ADIOS2BPWriteMultiblockRead2D4x2)
     }
 }
 
+//******************************************************************************
+// many blocks in several subfiles, read with threads and coalesced reads
+//******************************************************************************
+
+TEST_F(BPWriteMultiblockReadTest, ADIOS2BPWriteMultiblockReadSubFilesThreads)
+{
+    const std::string fname("ADIOS2BPWriteMultiblockReadSubFilesThreads.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    // blocks per rank and step, each a band of rows of B, A and C written in
+    // turn. Reading A and C skips B, a gap below the 4096 bytes merged by the
+    // reader, reading A or B alone skips C, a gap above it. A whole B block
+    // is read in place and must not start an extent merging the A after it.
+    const size_t NBlocks = 8;
+    const size_t NSteps = 3;
+    const size_t Rows = 4;
+    const size_t ColsA = 16;  // int32, 256 bytes per block
+    const size_t ColsB = 250; // int8, 1000 bytes per block
+    const size_t ColsC = 256; // double, 8192 bytes per block
+    const size_t totalRows = mpiSize * NBlocks * Rows;
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        // one subfile per rank
+        io.SetParameter("Substreams", std::to_string(mpiSize));
+
+        auto var_A = io.DefineVariable<int32_t>("A", {totalRows, ColsA});
+        auto var_B = io.DefineVariable<int8_t>("B", {totalRows, ColsB});
+        auto var_C = io.DefineVariable<double>("C", {totalRows, ColsC});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t b = 0; b < NBlocks; ++b)
+            {
+                const size_t row0 = (mpiRank * NBlocks + b) * Rows;
+
+                const std::vector<int8_t> B =
+                    SubFilesRows<int8_t>(step, row0, Rows, ColsB);
+                var_B.SetSelection({{row0, 0}, {Rows, ColsB}});
+                bpWriter.Put(var_B, B.data(), adios2::Mode::Sync);
+
+                const std::vector<int32_t> A =
+                    SubFilesRows<int32_t>(step, row0, Rows, ColsA);
+                var_A.SetSelection({{row0, 0}, {Rows, ColsA}});
+                bpWriter.Put(var_A, A.data(), adios2::Mode::Sync);
+
+                const std::vector<double> C =
+                    SubFilesRows<double>(step, row0, Rows, ColsC);
+                var_C.SetSelection({{row0, 0}, {Rows, ColsC}});
+                bpWriter.Put(var_C, C.data(), adios2::Mode::Sync);
+            }
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetParameter("Threads", "4");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_A = io.InquireVariable<int32_t>("A");
+        auto var_B = io.InquireVariable<int8_t>("B");
+        auto var_C = io.InquireVariable<double>("C");
+        ASSERT_TRUE(var_A);
+        ASSERT_TRUE(var_B);
+        ASSERT_TRUE(var_C);
+        ASSERT_EQ(var_A.Steps(), NSteps);
+
+        // all rows of every rank, inner columns only so blocks are read in
+        // extents and not in place
+        var_A.SetSelection({{0, 1}, {totalRows, ColsA - 2}});
+        var_C.SetSelection({{0, 1}, {totalRows, ColsC - 2}});
+
+        std::vector<int32_t> A(totalRows * (ColsA - 2));
+        std::vector<int8_t> B;
+        std::vector<double> C(totalRows * (ColsC - 2));
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            var_A.SetStepSelection({step, 1});
+            var_B.SetStepSelection({step, 1});
+            var_C.SetStepSelection({step, 1});
+
+            // gaps above the merge threshold
+            std::fill(A.begin(), A.end(), 0);
+            bpReader.Get(var_A, A.data());
+            bpReader.PerformGets();
+            ExpectSubFilesSelection(A, step, totalRows, 1, ColsA - 2, "A");
+
+            B.assign(totalRows * (ColsB - 2), 0);
+            var_B.SetSelection({{0, 1}, {totalRows, ColsB - 2}});
+            bpReader.Get(var_B, B.data());
+            bpReader.PerformGets();
+            ExpectSubFilesSelection(B, step, totalRows, 1, ColsB - 2, "B");
+
+            // gaps below the merge threshold, skipped B data is read and
+            // dropped
+            std::fill(A.begin(), A.end(), 0);
+            std::fill(C.begin(), C.end(), 0.);
+            bpReader.Get(var_A, A.data());
+            bpReader.Get(var_C, C.data());
+            bpReader.PerformGets();
+            ExpectSubFilesSelection(A, step, totalRows, 1, ColsA - 2, "A");
+            ExpectSubFilesSelection(C, step, totalRows, 1, ColsC - 2, "C");
+
+            // whole B blocks are read in place, between merged extents
+            std::fill(A.begin(), A.end(), 0);
+            std::fill(C.begin(), C.end(), 0.);
+            B.assign(totalRows * ColsB, 0);
+            var_B.SetSelection({{0, 0}, {totalRows, ColsB}});
+            bpReader.Get(var_A, A.data());
+            bpReader.Get(var_B, B.data());
+            bpReader.Get(var_C, C.data());
+            bpReader.PerformGets();
+            ExpectSubFilesSelection(A, step, totalRows, 1, ColsA - 2, "A");
+            ExpectSubFilesSelection(B, step, totalRows, 0, ColsB, "B");
+            ExpectSubFilesSelection(C, step, totalRows, 1, ColsC - 2, "C");
+        }
+
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// 2D partial selections of row bands in both orders, read in place when the
+// intersection with a block is contiguous
+//******************************************************************************
+
+/** host languages of writer and reader */
+class BPReadInPlaceTest
+: public ::testing::TestWithParam<std::pair<std::string, std::string>>
+{
+};
+
+TEST_P(BPReadInPlaceTest, ADIOS2BPReadPartialSelections2D)
+{
+    const std::string writeLanguage = GetParam().first;
+    const std::string readLanguage = GetParam().second;
+    const std::string fname("BPReadInPlace2D_" + writeLanguage + "_" +
+                            readLanguage + ".bp");
+
+    int mpiRank = 0, mpiSize = 1;
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    MPI_Comm mpiComm = MPI_COMM_WORLD;
+#else
+    MPI_Comm mpiComm = MPI_COMM_SELF;
+#endif
+
+    // bands of Rows slow indices by Cols fast indices, NBlocks per rank
+    const size_t NBlocks = 2;
+    const size_t Rows = 5;
+    const size_t Cols = 8;
+    const size_t totalRows = mpiSize * NBlocks * Rows;
+
+    // fast dimension last in row-major, first in column-major
+    auto lf_Dims = [](const bool isRowMajor, const size_t row,
+                      const size_t col) {
+        return isRowMajor ? adios2::Dims{row, col} : adios2::Dims{col, row};
+    };
+
+    // same memory layout in both orders
+    auto lf_Rows = [](const size_t row0, const size_t rows, const size_t col0,
+                      const size_t cols) {
+        std::vector<int32_t> data(rows * cols);
+        for (size_t r = 0; r < rows; ++r)
+        {
+            for (size_t c = 0; c < cols; ++c)
+            {
+                data[r * cols + c] =
+                    static_cast<int32_t>((row0 + r) * 100 + col0 + c);
+            }
+        }
+        return data;
+    };
+
+    {
+        adios2::core::ADIOS adios(mpiComm, true, writeLanguage);
+        adios2::core::IO &io = adios.DeclareIO("WriteIO");
+        const bool isRowMajor = adios2::helper::IsRowMajor(writeLanguage);
+
+        adios2::core::Variable<int32_t> &var = io.DefineVariable<int32_t>(
+            "i32", lf_Dims(isRowMajor, totalRows, Cols));
+
+        adios2::core::Engine &bpWriter = io.Open(fname, adios2::Mode::Write);
+        bpWriter.BeginStep();
+        for (size_t b = 0; b < NBlocks; ++b)
+        {
+            const size_t row0 = (mpiRank * NBlocks + b) * Rows;
+            const std::vector<int32_t> data = lf_Rows(row0, Rows, 0, Cols);
+            var.SetSelection({lf_Dims(isRowMajor, row0, 0),
+                              lf_Dims(isRowMajor, Rows, Cols)});
+            bpWriter.Put(var, data.data(), adios2::Mode::Sync);
+        }
+        bpWriter.EndStep();
+        bpWriter.Close();
+    }
+
+    {
+        adios2::core::ADIOS adios(mpiComm, true, readLanguage);
+        adios2::core::IO &io = adios.DeclareIO("ReadIO");
+        const bool isRowMajor = adios2::helper::IsRowMajor(readLanguage);
+
+        adios2::core::Engine &bpReader = io.Open(fname, adios2::Mode::Read);
+
+        adios2::core::Variable<int32_t> *var =
+            io.InquireVariable<int32_t>("i32");
+        ASSERT_NE(var, nullptr);
+        ASSERT_EQ(var->m_Shape, lf_Dims(isRowMajor, totalRows, Cols));
+
+        auto lf_Read = [&](const size_t row0, const size_t rows,
+                           const size_t col0, const size_t cols,
+                           const std::string &selection) {
+            std::vector<int32_t> data(rows * cols, -1);
+            var->SetSelection({lf_Dims(isRowMajor, row0, col0),
+                               lf_Dims(isRowMajor, rows, cols)});
+            bpReader.Get(*var, data.data(), adios2::Mode::Sync);
+            EXPECT_EQ(data, lf_Rows(row0, rows, col0, cols))
+                << selection << " rank=" << mpiRank;
+        };
+
+        // whole rows cutting the first and last blocks, contiguous
+        lf_Read(Rows / 2, totalRows - Rows, 0, Cols, "rows");
+        // part of a single row, contiguous
+        lf_Read(Rows + 1, 1, 2, Cols - 4, "part of a row");
+        // inner columns, strided in every block
+        lf_Read(Rows / 2, totalRows - Rows, 1, Cols - 2, "inner columns");
+        // a single column
+        lf_Read(0, totalRows, 3, 1, "column");
+
+        bpReader.Close();
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    HostLanguages, BPReadInPlaceTest,
+    ::testing::Values(std::make_pair("C++", "C++"),
+                      std::make_pair("Fortran", "Fortran"),
+                      std::make_pair("C++", "Fortran"),
+                      std::make_pair("Fortran", "C++")));
+
 //******************************************************************************
 // main
 //******************************************************************************
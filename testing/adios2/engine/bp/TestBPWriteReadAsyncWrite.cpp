@@ -0,0 +1,338 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <sstream>
+#include <string>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadAsyncWrite : public ::testing::Test
+{
+public:
+    BPWriteReadAsyncWrite() = default;
+};
+
+//******************************************************************************
+// 1D test data flushed at every step in the background
+//******************************************************************************
+
+TEST_F(BPWriteReadAsyncWrite, ADIOS2BPWriteRead1D)
+{
+    const std::string fname("BPWriteReadAsyncWrite1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 1000;
+    // Number of steps
+    const size_t NSteps = 10;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetParameters({{"AsyncWrite", "On"}, {"Profile", "On"}});
+
+        const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+        const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+        const adios2::Dims count{Nx};
+
+        auto var_i64 = io.DefineVariable<int64_t>("i64", shape, start, count,
+                                                  adios2::ConstantDims);
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            // data must survive only until EndStep, it is copied to buffer
+            const std::vector<int64_t> I64 = lf_GenerateData(step, mpiRank);
+            bpWriter.BeginStep();
+            bpWriter.Put(var_i64, I64.data());
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_i64 = io.InquireVariable<int64_t>("i64");
+        EXPECT_TRUE(var_i64);
+        ASSERT_EQ(var_i64.Steps(), NSteps);
+        ASSERT_EQ(var_i64.Shape()[0], mpiSize * Nx);
+
+        var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        std::vector<int64_t> I64(Nx);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            var_i64.SetStepSelection({t, 1});
+            bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+            const std::vector<int64_t> expectedI64 = lf_GenerateData(t, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// several steps per background flush, metadata file read before Close
+//******************************************************************************
+
+TEST_F(BPWriteReadAsyncWrite, ADIOS2BPWriteRead1DFlushSteps)
+{
+    const std::string fname("BPWriteReadAsyncWrite1DFlushSteps.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 1000;
+    // Number of steps
+    const size_t NSteps = 10;
+    // Steps per flush
+    const size_t FlushSteps = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+
+    // every step in the metadata file must be readable
+    auto lf_CheckFile = [&](const std::string &ioName, const size_t minSteps,
+                            const size_t maxSteps) {
+        adios2::IO io = adios.DeclareIO(ioName);
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_i64 = io.InquireVariable<int64_t>("i64");
+        ASSERT_TRUE(var_i64);
+        const size_t steps = var_i64.Steps();
+        EXPECT_GE(steps, minSteps);
+        EXPECT_LE(steps, maxSteps);
+
+        var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        std::vector<int64_t> I64(Nx);
+
+        for (size_t t = 0; t < steps; ++t)
+        {
+            var_i64.SetStepSelection({t, 1});
+            bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+            const std::vector<int64_t> expectedI64 =
+                lf_GenerateData(t, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << ioName << " t=" << t << " i=" << i
+                   << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+            }
+        }
+        bpReader.Close();
+    };
+
+    adios2::IO io = adios.DeclareIO("WriteIO");
+    io.SetParameters({{"AsyncWrite", "On"},
+                      {"FlushStepsCount", std::to_string(FlushSteps)}});
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+
+    auto var_i64 = io.DefineVariable<int64_t>("i64", shape, start, count,
+                                              adios2::ConstantDims);
+
+    adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        const std::vector<int64_t> I64 = lf_GenerateData(step, mpiRank);
+        bpWriter.BeginStep();
+        bpWriter.Put(var_i64, I64.data());
+        bpWriter.EndStep();
+
+        // after the third flush the metadata file might lag a flush, but
+        // never indexes data still being written
+        if (step == 3 * FlushSteps - 1)
+        {
+            lf_CheckFile("ReadOpenIO", FlushSteps, step + 1);
+        }
+    }
+
+    bpWriter.Close();
+
+    lf_CheckFile("ReadIO", NSteps, NSteps);
+}
+
+//******************************************************************************
+// metadata records appended by background flushes, followed by a reader
+//******************************************************************************
+
+TEST_F(BPWriteReadAsyncWrite, ADIOS2BPReadWhileWritingIncremental1D)
+{
+    const std::string fname("BPWriteReadAsyncWriteIncremental1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 1000;
+    // Number of steps
+    const size_t NSteps = 10;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+
+    adios2::IO writeIO = adios.DeclareIO("WriteIO");
+    writeIO.SetParameters({{"AsyncWrite", "On"},
+                           {"IncrementalMetadata", "On"},
+                           {"FlushStepsCount", "2"}});
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+
+    auto var_i64W = writeIO.DefineVariable<int64_t>("i64", shape, start, count,
+                                                    adios2::ConstantDims);
+
+    adios2::Engine bpWriter = writeIO.Open(fname, adios2::Mode::Write);
+
+    adios2::IO readIO = adios.DeclareIO("ReadIO");
+    adios2::Engine bpReader = readIO.Open(fname, adios2::Mode::Read);
+
+    std::vector<int64_t> I64(Nx);
+    size_t readSteps = 0;
+
+    // reads the steps available so far, whose data must be in the file
+    auto lf_ReadAvailable = [&](const float timeoutSeconds) {
+        while (bpReader.BeginStep(adios2::StepMode::NextAvailable,
+                                  timeoutSeconds) == adios2::StepStatus::OK)
+        {
+            EXPECT_EQ(bpReader.CurrentStep(), readSteps);
+
+            auto var_i64 = readIO.InquireVariable<int64_t>("i64");
+            EXPECT_TRUE(var_i64);
+            var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+            bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+            bpReader.EndStep();
+
+            const std::vector<int64_t> expectedI64 =
+                lf_GenerateData(readSteps, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << readSteps << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+            }
+            ++readSteps;
+        }
+    };
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        const std::vector<int64_t> I64W = lf_GenerateData(step, mpiRank);
+        bpWriter.BeginStep();
+        bpWriter.Put(var_i64W, I64W.data());
+        bpWriter.EndStep();
+
+        lf_ReadAvailable(0.f);
+        EXPECT_LE(readSteps, step + 1);
+    }
+
+    bpWriter.Close();
+
+    lf_ReadAvailable(5.f);
+    EXPECT_EQ(readSteps, NSteps);
+    EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 0.f),
+              adios2::StepStatus::EndOfStream);
+    bpReader.Close();
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,277 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadBZip2 : public ::testing::Test
+{
+public:
+    BPWriteReadBZip2() = default;
+};
+
+namespace
+{
+
+template <class T>
+std::vector<T> GenerateStepData(const size_t size, const size_t step,
+                                const int rank)
+{
+    std::vector<T> data(size);
+    std::iota(data.begin(), data.end(),
+              static_cast<T>(step * 1000 + rank * size));
+    return data;
+}
+
+} // end empty namespace
+
+//******************************************************************************
+// 1D 1xNx test data
+//******************************************************************************
+
+TEST_F(BPWriteReadBZip2, ADIOS2BPWriteRead1D)
+{
+    const std::string fname("BPWriteReadBZip2_1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 100;
+    // Number of steps
+    const size_t NSteps = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+
+        const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+        const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+        const adios2::Dims count{Nx};
+
+        auto var_i32 = io.DefineVariable<int32_t>("i32", shape, start, count,
+                                                  adios2::ConstantDims);
+        auto var_r64 = io.DefineVariable<double>("r64", shape, start, count,
+                                                 adios2::ConstantDims);
+
+        adios2::Operator bzip2Op =
+            adios.DefineOperator("BZip2Compressor", "BZip2");
+
+        var_i32.AddOperator(bzip2Op, {{"BlockSize100K", "2"}});
+        var_r64.AddOperator(bzip2Op, {{"BlockSize100K", "9"}});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<int32_t> I32 =
+                GenerateStepData<int32_t>(Nx, step, mpiRank);
+            const std::vector<double> R64 =
+                GenerateStepData<double>(Nx, step, mpiRank);
+
+            bpWriter.BeginStep();
+            bpWriter.Put(var_i32, I32.data());
+            bpWriter.Put(var_r64, R64.data());
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_i32 = io.InquireVariable<int32_t>("i32");
+        EXPECT_TRUE(var_i32);
+        ASSERT_EQ(var_i32.ShapeID(), adios2::ShapeID::GlobalArray);
+        ASSERT_EQ(var_i32.Steps(), NSteps);
+        ASSERT_EQ(var_i32.Shape()[0], mpiSize * Nx);
+
+        auto var_r64 = io.InquireVariable<double>("r64");
+        EXPECT_TRUE(var_r64);
+        ASSERT_EQ(var_r64.ShapeID(), adios2::ShapeID::GlobalArray);
+        ASSERT_EQ(var_r64.Steps(), NSteps);
+        ASSERT_EQ(var_r64.Shape()[0], mpiSize * Nx);
+
+        // partial selection inside this rank's block
+        const size_t offset = 10;
+        const size_t length = Nx / 2;
+        const adios2::Box<adios2::Dims> sel({mpiRank * Nx + offset}, {length});
+        var_i32.SetSelection(sel);
+        var_r64.SetSelection(sel);
+
+        std::vector<int32_t> I32(length);
+        std::vector<double> R64(length);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            var_i32.SetStepSelection({t, 1});
+            var_r64.SetStepSelection({t, 1});
+
+            bpReader.Get(var_i32, I32.data());
+            bpReader.Get(var_r64, R64.data());
+            bpReader.PerformGets();
+
+            const std::vector<int32_t> expectedI32 =
+                GenerateStepData<int32_t>(Nx, t, mpiRank);
+            const std::vector<double> expectedR64 =
+                GenerateStepData<double>(Nx, t, mpiRank);
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(I32[i], expectedI32[i + offset]) << msg;
+                EXPECT_EQ(R64[i], expectedR64[i + offset]) << msg;
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// 2D NyxNx test data
+//******************************************************************************
+
+TEST_F(BPWriteReadBZip2, ADIOS2BPWriteRead2D)
+{
+    const std::string fname("BPWriteReadBZip2_2D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of rows
+    const size_t Ny = 10;
+    // Number of columns per rank
+    const size_t Nx = 20;
+    // Number of steps
+    const size_t NSteps = 2;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+
+        const adios2::Dims shape{Ny, static_cast<size_t>(Nx * mpiSize)};
+        const adios2::Dims start{0, static_cast<size_t>(Nx * mpiRank)};
+        const adios2::Dims count{Ny, Nx};
+
+        auto var_r32 = io.DefineVariable<float>("r32", shape, start, count,
+                                                adios2::ConstantDims);
+
+        adios2::Operator bzip2Op =
+            adios.DefineOperator("BZip2Compressor", "BZip2");
+        var_r32.AddOperator(bzip2Op);
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<float> R32 =
+                GenerateStepData<float>(Ny * Nx, step, mpiRank);
+
+            bpWriter.BeginStep();
+            bpWriter.Put(var_r32, R32.data());
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_r32 = io.InquireVariable<float>("r32");
+        EXPECT_TRUE(var_r32);
+        ASSERT_EQ(var_r32.ShapeID(), adios2::ShapeID::GlobalArray);
+        ASSERT_EQ(var_r32.Steps(), NSteps);
+        ASSERT_EQ(var_r32.Shape()[0], Ny);
+        ASSERT_EQ(var_r32.Shape()[1], mpiSize * Nx);
+
+        // rows 2 to 6, columns 5 to 14 of this rank's block
+        const size_t rowOffset = 2;
+        const size_t columnOffset = 5;
+        const adios2::Dims count{5, 10};
+        const adios2::Box<adios2::Dims> sel(
+            {rowOffset, mpiRank * Nx + columnOffset}, count);
+        var_r32.SetSelection(sel);
+
+        std::vector<float> R32(count[0] * count[1]);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            var_r32.SetStepSelection({t, 1});
+            bpReader.Get(var_r32, R32.data());
+            bpReader.PerformGets();
+
+            const std::vector<float> expectedR32 =
+                GenerateStepData<float>(Ny * Nx, t, mpiRank);
+
+            for (size_t j = 0; j < count[0]; ++j)
+            {
+                for (size_t i = 0; i < count[1]; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " j=" << j << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    const size_t index = j * count[1] + i;
+                    const size_t expectedIndex =
+                        (j + rowOffset) * Nx + i + columnOffset;
+                    EXPECT_EQ(R32[index], expectedR32[expectedIndex]) << msg;
+                }
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,352 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadBufferChunks : public ::testing::Test
+{
+public:
+    BPWriteReadBufferChunks() = default;
+
+    /** arrays larger than the chunk size mixed with small arrays, each step
+     * spans several data buffer chunks */
+    void WriteRead1D(const std::string &fname, const adios2::Params &params);
+
+    /** small arrays fill MaxBufferSize, a large array then flushes the
+     * buffer in the middle of a step */
+    void WriteReadMaxBufferSize1D(const std::string &fname,
+                                  const adios2::Params &params);
+};
+
+void BPWriteReadBufferChunks::WriteRead1D(const std::string &fname,
+                                          const adios2::Params &params)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank, 40Kb and 40 bytes
+    const size_t Nx = 5000;
+    const size_t NxSmall = 10;
+    // Number of steps
+    const size_t NSteps = 6;
+    // Number of large arrays
+    const size_t NVars = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const size_t var,
+                               const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 1000000 + var * 100000 +
+                                       rank * Nx));
+        return data;
+    };
+
+    auto lf_GenerateSmallData = [&](const size_t step, const int rank) {
+        std::vector<float> data(NxSmall);
+        std::iota(data.begin(), data.end(),
+                  static_cast<float>(step * 100 + rank * NxSmall));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetParameters(params);
+
+        std::vector<adios2::Variable<int64_t>> vars_i64;
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            vars_i64.push_back(io.DefineVariable<int64_t>(
+                "i64_" + std::to_string(v), {Nx * mpiSize}, {Nx * mpiRank},
+                {Nx}, adios2::ConstantDims));
+        }
+        auto var_r32 = io.DefineVariable<float>(
+            "r32", {NxSmall * mpiSize}, {NxSmall * mpiRank}, {NxSmall},
+            adios2::ConstantDims);
+        io.DefineAttribute<std::string>("units", "m");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                const std::vector<int64_t> I64 =
+                    lf_GenerateData(step, v, mpiRank);
+                bpWriter.Put(vars_i64[v], I64.data(), adios2::Mode::Sync);
+
+                const std::vector<float> R32 =
+                    lf_GenerateSmallData(step, mpiRank);
+                if (v == 0)
+                {
+                    bpWriter.Put(var_r32, R32.data(), adios2::Mode::Sync);
+                }
+            }
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto attr_units = io.InquireAttribute<std::string>("units");
+        EXPECT_TRUE(attr_units);
+        ASSERT_EQ(attr_units.Data().front(), "m");
+
+        auto var_r32 = io.InquireVariable<float>("r32");
+        EXPECT_TRUE(var_r32);
+        ASSERT_EQ(var_r32.Steps(), NSteps);
+        var_r32.SetSelection({{mpiRank * NxSmall}, {NxSmall}});
+
+        std::vector<int64_t> I64(Nx);
+        std::vector<float> R32(NxSmall);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                auto var_i64 =
+                    io.InquireVariable<int64_t>("i64_" + std::to_string(v));
+                EXPECT_TRUE(var_i64);
+                ASSERT_EQ(var_i64.Steps(), NSteps);
+                ASSERT_EQ(var_i64.Shape()[0], mpiSize * Nx);
+
+                var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+                var_i64.SetStepSelection({t, 1});
+                bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+                const std::vector<int64_t> expectedI64 =
+                    lf_GenerateData(t, v, mpiRank);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " v=" << v << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+                }
+            }
+
+            var_r32.SetStepSelection({t, 1});
+            bpReader.Get(var_r32, R32.data(), adios2::Mode::Sync);
+
+            const std::vector<float> expectedR32 =
+                lf_GenerateSmallData(t, mpiRank);
+
+            for (size_t i = 0; i < NxSmall; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(R32[i], expectedR32[i]) << msg;
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+void BPWriteReadBufferChunks::WriteReadMaxBufferSize1D(
+    const std::string &fname, const adios2::Params &params)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank, 15Kb small arrays and a 40Kb array
+    const size_t NxSmall = 3840;
+    const size_t NxLarge = 10240;
+    // Number of steps
+    const size_t NSteps = 3;
+    // Number of small arrays, fill the 64Kb buffer before the large one
+    const size_t NSmall = 4;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t nx, const size_t step,
+                               const size_t var, const int rank) {
+        std::vector<float> data(nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<float>(step * 100000 + var * 10000 + rank));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetParameters(params);
+
+        std::vector<adios2::Variable<float>> vars_r32;
+        for (size_t v = 0; v < NSmall; ++v)
+        {
+            vars_r32.push_back(io.DefineVariable<float>(
+                "r32_" + std::to_string(v), {NxSmall * mpiSize},
+                {NxSmall * mpiRank}, {NxSmall}, adios2::ConstantDims));
+        }
+        vars_r32.push_back(io.DefineVariable<float>(
+            "r32_" + std::to_string(NSmall), {NxLarge * mpiSize},
+            {NxLarge * mpiRank}, {NxLarge}, adios2::ConstantDims));
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t v = 0; v <= NSmall; ++v)
+            {
+                const std::vector<float> R32 = lf_GenerateData(
+                    v < NSmall ? NxSmall : NxLarge, step, v, mpiRank);
+                bpWriter.Put(vars_r32[v], R32.data(), adios2::Mode::Sync);
+            }
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        for (size_t v = 0; v <= NSmall; ++v)
+        {
+            const size_t nx = v < NSmall ? NxSmall : NxLarge;
+            auto var_r32 =
+                io.InquireVariable<float>("r32_" + std::to_string(v));
+            EXPECT_TRUE(var_r32);
+            ASSERT_EQ(var_r32.Steps(), NSteps);
+            ASSERT_EQ(var_r32.Shape()[0], mpiSize * nx);
+
+            var_r32.SetSelection({{mpiRank * nx}, {nx}});
+            std::vector<float> R32(nx);
+
+            for (size_t t = 0; t < NSteps; ++t)
+            {
+                var_r32.SetStepSelection({t, 1});
+                bpReader.Get(var_r32, R32.data(), adios2::Mode::Sync);
+
+                const std::vector<float> expectedR32 =
+                    lf_GenerateData(nx, t, v, mpiRank);
+
+                for (size_t i = 0; i < nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " v=" << v << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(R32[i], expectedR32[i]) << msg;
+                }
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// 1D test data in 16Kb chunks
+//******************************************************************************
+
+TEST_F(BPWriteReadBufferChunks, ADIOS2BPWriteRead1D)
+{
+    WriteRead1D("BPWriteReadBufferChunks1D.bp",
+                {{"BufferChunkSize", "16Kb"}, {"InitialBufferSize", "16Kb"}});
+}
+
+//******************************************************************************
+// 1D test data in 16Kb chunks, flushed in the background
+//******************************************************************************
+
+TEST_F(BPWriteReadBufferChunks, ADIOS2BPWriteRead1DAsyncWrite)
+{
+    WriteRead1D("BPWriteReadBufferChunks1DAsync.bp",
+                {{"BufferChunkSize", "16Kb"},
+                 {"InitialBufferSize", "16Kb"},
+                 {"AsyncWrite", "On"}});
+}
+
+//******************************************************************************
+// 1D test data in 16Kb chunks, two steps per flush
+//******************************************************************************
+
+TEST_F(BPWriteReadBufferChunks, ADIOS2BPWriteRead1DFlushSteps)
+{
+    WriteRead1D("BPWriteReadBufferChunks1DFlushSteps.bp",
+                {{"BufferChunkSize", "16Kb"},
+                 {"InitialBufferSize", "16Kb"},
+                 {"FlushStepsCount", "2"}});
+}
+
+//******************************************************************************
+// 1D test data in 16Kb chunks, a large array flushes a full buffer of small
+// chunks in the middle of a step
+//******************************************************************************
+
+TEST_F(BPWriteReadBufferChunks, ADIOS2BPWriteRead1DMaxBufferSize)
+{
+    WriteReadMaxBufferSize1D("BPWriteReadBufferChunks1DMaxBufferSize.bp",
+                             {{"BufferChunkSize", "16Kb"},
+                              {"InitialBufferSize", "16Kb"},
+                              {"MaxBufferSize", "64Kb"}});
+}
+
+//******************************************************************************
+// 1D test data in a contiguous buffer, flushed in the middle of a step
+//******************************************************************************
+
+TEST_F(BPWriteReadBufferChunks, ADIOS2BPWriteRead1DMaxBufferSizeContiguous)
+{
+    WriteReadMaxBufferSize1D(
+        "BPWriteReadBufferChunks1DMaxBufferSizeContiguous.bp",
+        {{"InitialBufferSize", "16Kb"}, {"MaxBufferSize", "64Kb"}});
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,230 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadDeferredByReference : public ::testing::Test
+{
+public:
+    BPWriteReadDeferredByReference() = default;
+
+    /** large arrays Put Deferred mixed with Sync arrays and a deferred single
+     * value, application memory is kept until EndStep */
+    void WriteRead1D(const std::string &fname, const adios2::Params &params);
+};
+
+void BPWriteReadDeferredByReference::WriteRead1D(const std::string &fname,
+                                                 const adios2::Params &params)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank, 40Kb and 40 bytes
+    const size_t Nx = 5000;
+    const size_t NxSmall = 10;
+    // Number of steps
+    const size_t NSteps = 6;
+    // Number of large arrays
+    const size_t NVars = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const size_t var,
+                               const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 1000000 + var * 100000 +
+                                       rank * Nx));
+        return data;
+    };
+
+    auto lf_GenerateSmallData = [&](const size_t step, const int rank) {
+        std::vector<float> data(NxSmall);
+        std::iota(data.begin(), data.end(),
+                  static_cast<float>(step * 100 + rank * NxSmall));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetParameters(params);
+
+        std::vector<adios2::Variable<int64_t>> vars_i64;
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            vars_i64.push_back(io.DefineVariable<int64_t>(
+                "i64_" + std::to_string(v), {Nx * mpiSize}, {Nx * mpiRank},
+                {Nx}, adios2::ConstantDims));
+        }
+        auto var_r32 = io.DefineVariable<float>(
+            "r32", {NxSmall * mpiSize}, {NxSmall * mpiRank}, {NxSmall},
+            adios2::ConstantDims);
+        auto var_step = io.DefineVariable<uint64_t>("step");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            // must stay valid until EndStep
+            std::vector<std::vector<int64_t>> I64(NVars);
+            const uint64_t stepValue = step;
+
+            bpWriter.BeginStep();
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                I64[v] = lf_GenerateData(step, v, mpiRank);
+                bpWriter.Put(vars_i64[v], I64[v].data());
+
+                if (v == 0)
+                {
+                    const std::vector<float> R32 =
+                        lf_GenerateSmallData(step, mpiRank);
+                    bpWriter.Put(var_r32, R32.data(), adios2::Mode::Sync);
+                }
+            }
+            bpWriter.Put(var_step, stepValue);
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_r32 = io.InquireVariable<float>("r32");
+        EXPECT_TRUE(var_r32);
+        ASSERT_EQ(var_r32.Steps(), NSteps);
+        var_r32.SetSelection({{mpiRank * NxSmall}, {NxSmall}});
+
+        auto var_step = io.InquireVariable<uint64_t>("step");
+        EXPECT_TRUE(var_step);
+        ASSERT_EQ(var_step.Steps(), NSteps);
+
+        std::vector<int64_t> I64(Nx);
+        std::vector<float> R32(NxSmall);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                auto var_i64 =
+                    io.InquireVariable<int64_t>("i64_" + std::to_string(v));
+                EXPECT_TRUE(var_i64);
+                ASSERT_EQ(var_i64.Steps(), NSteps);
+                ASSERT_EQ(var_i64.Shape()[0], mpiSize * Nx);
+
+                var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+                var_i64.SetStepSelection({t, 1});
+                bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+                const std::vector<int64_t> expectedI64 =
+                    lf_GenerateData(t, v, mpiRank);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " v=" << v << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+                }
+            }
+
+            var_r32.SetStepSelection({t, 1});
+            bpReader.Get(var_r32, R32.data(), adios2::Mode::Sync);
+
+            const std::vector<float> expectedR32 =
+                lf_GenerateSmallData(t, mpiRank);
+
+            for (size_t i = 0; i < NxSmall; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(R32[i], expectedR32[i]) << msg;
+            }
+
+            uint64_t stepValue = 0;
+            var_step.SetStepSelection({t, 1});
+            bpReader.Get(var_step, stepValue, adios2::Mode::Sync);
+            EXPECT_EQ(stepValue, t);
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// 1D test data, deferred arrays written from application memory
+//******************************************************************************
+
+TEST_F(BPWriteReadDeferredByReference, ADIOS2BPWriteRead1D)
+{
+    WriteRead1D("BPWriteReadDeferredByReference1D.bp",
+                {{"DeferredByReference", "On"}});
+}
+
+//******************************************************************************
+// 1D test data, referenced arrays between 16Kb chunks
+//******************************************************************************
+
+TEST_F(BPWriteReadDeferredByReference, ADIOS2BPWriteRead1DBufferChunks)
+{
+    WriteRead1D("BPWriteReadDeferredByReference1DChunks.bp",
+                {{"DeferredByReference", "On"},
+                 {"BufferChunkSize", "16Kb"},
+                 {"InitialBufferSize", "16Kb"}});
+}
+
+//******************************************************************************
+// 1D test data, flushed at each EndStep despite AsyncWrite and FlushStepsCount
+//******************************************************************************
+
+TEST_F(BPWriteReadDeferredByReference, ADIOS2BPWriteRead1DForcedFlush)
+{
+    WriteRead1D("BPWriteReadDeferredByReference1DForcedFlush.bp",
+                {{"DeferredByReference", "On"},
+                 {"AsyncWrite", "On"},
+                 {"FlushStepsCount", "2"}});
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,236 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadIncrementalMetadata : public ::testing::Test
+{
+public:
+    BPWriteReadIncrementalMetadata() = default;
+};
+
+//******************************************************************************
+// 1D test data, a metadata record is appended at every step
+//******************************************************************************
+
+TEST_F(BPWriteReadIncrementalMetadata, ADIOS2BPWriteRead1D)
+{
+    const std::string fname("BPWriteReadIncrementalMetadata1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 100;
+    // Number of steps
+    const size_t NSteps = 10;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetParameters({{"IncrementalMetadata", "On"}});
+
+        const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+        const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+        const adios2::Dims count{Nx};
+
+        auto var_i64 = io.DefineVariable<int64_t>("i64", shape, start, count,
+                                                  adios2::ConstantDims);
+        auto var_step = io.DefineVariable<uint64_t>("step");
+        io.DefineAttribute<std::string>("units", "m");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<int64_t> I64 = lf_GenerateData(step, mpiRank);
+            const uint64_t stepValue = step;
+            bpWriter.BeginStep();
+            bpWriter.Put(var_i64, I64.data());
+            bpWriter.Put(var_step, stepValue);
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto attr_units = io.InquireAttribute<std::string>("units");
+        EXPECT_TRUE(attr_units);
+        ASSERT_EQ(attr_units.Data().front(), "m");
+
+        auto var_i64 = io.InquireVariable<int64_t>("i64");
+        EXPECT_TRUE(var_i64);
+        ASSERT_EQ(var_i64.Steps(), NSteps);
+        ASSERT_EQ(var_i64.Shape()[0], mpiSize * Nx);
+
+        auto var_step = io.InquireVariable<uint64_t>("step");
+        EXPECT_TRUE(var_step);
+        ASSERT_EQ(var_step.Steps(), NSteps);
+
+        var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        std::vector<int64_t> I64(Nx);
+
+        // steps of different records, backwards
+        for (size_t s = 0; s < NSteps; ++s)
+        {
+            const size_t t = NSteps - 1 - s;
+            var_i64.SetStepSelection({t, 1});
+            bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+            const std::vector<int64_t> expectedI64 =
+                lf_GenerateData(t, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// reader follows steps while the writer appends them
+//******************************************************************************
+
+TEST_F(BPWriteReadIncrementalMetadata, ADIOS2BPReadWhileWriting1D)
+{
+    const std::string fname("BPReadWhileWriting1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 100;
+    // Number of steps
+    const size_t NSteps = 5;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+
+    adios2::IO writeIO = adios.DeclareIO("WriteIO");
+    writeIO.SetParameters({{"IncrementalMetadata", "On"}});
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+
+    auto var_i64W = writeIO.DefineVariable<int64_t>("i64", shape, start, count,
+                                                    adios2::ConstantDims);
+
+    adios2::Engine bpWriter = writeIO.Open(fname, adios2::Mode::Write);
+
+    adios2::IO readIO = adios.DeclareIO("ReadIO");
+    adios2::Engine bpReader = readIO.Open(fname, adios2::Mode::Read);
+
+    // nothing written yet
+    EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 0.f),
+              adios2::StepStatus::NotReady);
+
+    std::vector<int64_t> I64(Nx);
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        const std::vector<int64_t> expectedI64 = lf_GenerateData(step, mpiRank);
+        bpWriter.BeginStep();
+        bpWriter.Put(var_i64W, expectedI64.data());
+        bpWriter.EndStep();
+
+        ASSERT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 1.f),
+                  adios2::StepStatus::OK);
+        EXPECT_EQ(bpReader.CurrentStep(), step);
+
+        auto var_i64 = readIO.InquireVariable<int64_t>("i64");
+        EXPECT_TRUE(var_i64);
+        var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+        bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+        bpReader.EndStep();
+
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            std::stringstream ss;
+            ss << "t=" << step << " i=" << i << " rank=" << mpiRank;
+            std::string msg = ss.str();
+
+            EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+        }
+
+        // writer hasn't appended the next step
+        EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 0.f),
+                  adios2::StepStatus::NotReady);
+    }
+
+    bpWriter.Close();
+
+    EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 1.f),
+              adios2::StepStatus::EndOfStream);
+    bpReader.Close();
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
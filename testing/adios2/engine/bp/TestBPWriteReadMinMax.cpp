@@ -0,0 +1,153 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadMinMax : public ::testing::Test
+{
+public:
+    BPWriteReadMinMax() = default;
+};
+
+namespace
+{
+
+// Nx is prime, so values are a permutation with min and max inside the block
+template <class T>
+std::vector<T> GenerateData(const size_t Nx, const int rank)
+{
+    std::vector<T> data(Nx);
+    for (size_t i = 0; i < Nx; ++i)
+    {
+        const long long value = static_cast<long long>((i * 7 + 3) % Nx) -
+                                static_cast<long long>(Nx / 2) +
+                                static_cast<long long>(rank * Nx);
+        data[i] = static_cast<T>(value);
+    }
+    return data;
+}
+
+} // end empty namespace
+
+//******************************************************************************
+// 1D array min max, large enough to span several copy blocks
+//******************************************************************************
+
+TEST_F(BPWriteReadMinMax, ADIOS2BPWriteRead1D)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 10007;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+
+    const long long expectedMin = -static_cast<long long>(Nx / 2);
+    const long long expectedMax =
+        static_cast<long long>(Nx - 1 - Nx / 2 + (mpiSize - 1) * Nx);
+
+    for (const std::string threads : {"1", "2"})
+    {
+        const std::string fname("BPWriteReadMinMax1D_" + threads + ".bp");
+        {
+            adios2::IO io = adios.DeclareIO("WriteIO" + threads);
+            io.SetParameter("Threads", threads);
+
+            const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+            const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+            const adios2::Dims count{Nx};
+
+            auto var_i32 = io.DefineVariable<int32_t>("i32", shape, start,
+                                                      count);
+            auto var_i64 = io.DefineVariable<int64_t>("i64", shape, start,
+                                                      count);
+            auto var_r32 = io.DefineVariable<float>("r32", shape, start, count);
+            auto var_r64 =
+                io.DefineVariable<double>("r64", shape, start, count);
+
+            const std::vector<int32_t> I32 =
+                GenerateData<int32_t>(Nx, mpiRank);
+            const std::vector<int64_t> I64 =
+                GenerateData<int64_t>(Nx, mpiRank);
+            const std::vector<float> R32 = GenerateData<float>(Nx, mpiRank);
+            const std::vector<double> R64 = GenerateData<double>(Nx, mpiRank);
+
+            adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+            bpWriter.Put(var_i32, I32.data(), adios2::Mode::Sync);
+            bpWriter.Put(var_i64, I64.data(), adios2::Mode::Sync);
+            bpWriter.Put(var_r32, R32.data(), adios2::Mode::Sync);
+            bpWriter.Put(var_r64, R64.data(), adios2::Mode::Sync);
+            bpWriter.Close();
+        }
+
+        {
+            adios2::IO io = adios.DeclareIO("ReadIO" + threads);
+            io.SetParameter("Threads", threads);
+            adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+            auto variablesInfo = io.AvailableVariables();
+            for (const std::string name : {"i32", "i64", "r32", "r64"})
+            {
+                EXPECT_EQ(std::stoll(variablesInfo[name]["Min"]), expectedMin)
+                    << name << " threads=" << threads;
+                EXPECT_EQ(std::stoll(variablesInfo[name]["Max"]), expectedMax)
+                    << name << " threads=" << threads;
+            }
+
+            auto var_r64 = io.InquireVariable<double>("r64");
+            EXPECT_TRUE(var_r64);
+            var_r64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+            std::vector<double> R64(Nx);
+            bpReader.Get(var_r64, R64.data(), adios2::Mode::Sync);
+
+            const std::vector<double> expectedR64 =
+                GenerateData<double>(Nx, mpiRank);
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                EXPECT_EQ(R64[i], expectedR64[i]) << "i=" << i;
+            }
+
+            bpReader.Close();
+        }
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,255 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <sstream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+class BPWriteReadMmap : public ::testing::Test
+{
+public:
+    BPWriteReadMmap() = default;
+};
+
+//******************************************************************************
+// 2D NyxNx test data, read with mmap library
+//******************************************************************************
+
+TEST_F(BPWriteReadMmap, ADIOS2BPWriteRead2D)
+{
+    const std::string fname("BPWriteReadMmap2D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of rows
+    const size_t Ny = 4;
+    // Number of columns per rank
+    const size_t Nx = 8;
+    // Number of steps
+    const size_t NSteps = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<double> data(Ny * Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<double>(step * 1000 + rank * Ny * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+
+        const adios2::Dims shape{Ny, static_cast<size_t>(Nx * mpiSize)};
+        const adios2::Dims start{0, static_cast<size_t>(Nx * mpiRank)};
+        const adios2::Dims count{Ny, Nx};
+
+        auto var_r64 = io.DefineVariable<double>("r64", shape, start, count,
+                                                 adios2::ConstantDims);
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<double> R64 = lf_GenerateData(step, mpiRank);
+            bpWriter.BeginStep();
+            bpWriter.Put(var_r64, R64.data());
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.AddTransport("File", {{"Library", "mmap"}});
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_r64 = io.InquireVariable<double>("r64");
+        EXPECT_TRUE(var_r64);
+        ASSERT_EQ(var_r64.Steps(), NSteps);
+        ASSERT_EQ(var_r64.Shape()[0], Ny);
+        ASSERT_EQ(var_r64.Shape()[1], mpiSize * Nx);
+
+        // columns 2 to 5 of this rank's block: non-contiguous rows
+        const size_t columnOffset = 2;
+        const adios2::Dims count{Ny, 4};
+        var_r64.SetSelection({{0, mpiRank * Nx + columnOffset}, count});
+
+        std::vector<double> R64(count[0] * count[1]);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            var_r64.SetStepSelection({t, 1});
+            bpReader.Get(var_r64, R64.data(), adios2::Mode::Sync);
+
+            const std::vector<double> expectedR64 = lf_GenerateData(t, mpiRank);
+
+            for (size_t j = 0; j < count[0]; ++j)
+            {
+                for (size_t i = 0; i < count[1]; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " j=" << j << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(R64[j * count[1] + i],
+                              expectedR64[j * Nx + i + columnOffset])
+                        << msg;
+                }
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+//******************************************************************************
+// mapped metadata and data follow steps while the writer appends them
+//******************************************************************************
+
+TEST_F(BPWriteReadMmap, ADIOS2BPReadWhileWriting1D)
+{
+    const std::string fname("BPReadWhileWritingMmap1D.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 1000;
+    // Number of steps
+    const size_t NSteps = 5;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 100000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+
+    adios2::IO writeIO = adios.DeclareIO("WriteIO");
+    writeIO.SetParameters({{"IncrementalMetadata", "On"}});
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+
+    auto var_i64W = writeIO.DefineVariable<int64_t>("i64", shape, start, count,
+                                                    adios2::ConstantDims);
+
+    adios2::Engine bpWriter = writeIO.Open(fname, adios2::Mode::Write);
+
+    // first step is written before the reader maps the files
+    std::vector<int64_t> expectedI64 = lf_GenerateData(0, mpiRank);
+    bpWriter.BeginStep();
+    bpWriter.Put(var_i64W, expectedI64.data());
+    bpWriter.EndStep();
+
+    adios2::IO readIO = adios.DeclareIO("ReadIO");
+    readIO.AddTransport("File", {{"Library", "mmap"}});
+    adios2::Engine bpReader = readIO.Open(fname, adios2::Mode::Read);
+
+    std::vector<int64_t> I64(Nx);
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        if (step > 0)
+        {
+            expectedI64 = lf_GenerateData(step, mpiRank);
+            bpWriter.BeginStep();
+            bpWriter.Put(var_i64W, expectedI64.data());
+            bpWriter.EndStep();
+        }
+
+        ASSERT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 5.f),
+                  adios2::StepStatus::OK)
+            << "t=" << step;
+        EXPECT_EQ(bpReader.CurrentStep(), step);
+
+        auto var_i64 = readIO.InquireVariable<int64_t>("i64");
+        EXPECT_TRUE(var_i64);
+        var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+        bpReader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+        bpReader.EndStep();
+
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            std::stringstream ss;
+            ss << "t=" << step << " i=" << i << " rank=" << mpiRank;
+            std::string msg = ss.str();
+
+            EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+        }
+
+        // writer hasn't appended the next step
+        EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 0.f),
+                  adios2::StepStatus::NotReady);
+    }
+
+    bpWriter.Close();
+
+    EXPECT_EQ(bpReader.BeginStep(adios2::StepMode::NextAvailable, 5.f),
+              adios2::StepStatus::EndOfStream);
+    bpReader.Close();
+}
+
+TEST_F(BPWriteReadMmap, WriteModeThrows)
+{
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    adios2::IO io = adios.DeclareIO("WriteIO");
+    io.AddTransport("File", {{"Library", "mmap"}});
+
+    EXPECT_THROW(io.Open("BPWriteReadMmapWrite.bp", adios2::Mode::Write),
+                 std::invalid_argument);
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
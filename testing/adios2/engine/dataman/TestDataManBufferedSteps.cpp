@@ -0,0 +1,220 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestDataManBufferedSteps.cpp : DataManReader MaxBufferedSteps with the
+ * block and drop_oldest BufferedStepsPolicy, and the deserializer steps it
+ * relies on
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <numeric> //std::iota
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/core/Variable.h"
+#include "adios2/toolkit/format/dataman/DataMan.tcc"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+const size_t Nx = 10;
+
+/** values of a step, distinct in every step */
+std::vector<float> StepData(const size_t step)
+{
+    std::vector<float> data(Nx);
+    std::iota(data.begin(), data.end(), static_cast<float>(step * 1000));
+    return data;
+}
+
+/** serialized step as received by a reader transport */
+std::shared_ptr<std::vector<char>> SerializeStep(const size_t step)
+{
+    std::vector<float> data = StepData(step);
+    adios2::core::Variable<float> variable("floats", {Nx}, {0}, {Nx}, true,
+                                           true);
+    variable.SetData(data.data());
+
+    adios2::format::DataManSerializer serializer;
+    serializer.New(1024);
+    serializer.Put(variable, "stream", step, 0, {});
+    return serializer.Get();
+}
+
+} // end anonymous namespace
+
+//******************************************************************************
+// deserializer
+//******************************************************************************
+
+TEST(DataManBufferedStepsTest, EraseOldestMissingMinStep)
+{
+    adios2::format::DataManDeserializer deserializer;
+    deserializer.Put(SerializeStep(0));
+    deserializer.Put(SerializeStep(2));
+    EXPECT_EQ(deserializer.Steps(), 2);
+
+    // EndStep of step 0, step 1 is not received yet
+    deserializer.Erase(0);
+    EXPECT_EQ(deserializer.MinStep(), 1);
+    EXPECT_EQ(deserializer.Steps(), 1);
+
+    // the oldest buffered step is dropped, not the missing one
+    EXPECT_TRUE(deserializer.EraseOldest());
+    EXPECT_EQ(deserializer.Steps(), 0);
+    EXPECT_EQ(deserializer.GetMetaData(2), nullptr);
+
+    // nothing left to drop
+    EXPECT_FALSE(deserializer.EraseOldest());
+}
+
+TEST(DataManBufferedStepsTest, EraseOldestPinned)
+{
+    adios2::format::DataManDeserializer deserializer;
+    deserializer.Put(SerializeStep(0));
+    deserializer.Put(SerializeStep(1));
+
+    // BeginStep of step 0
+    ASSERT_NE(deserializer.PinMetaData(0), nullptr);
+    EXPECT_FALSE(deserializer.EraseOldest());
+    EXPECT_EQ(deserializer.Steps(), 2);
+
+    adios2::core::Variable<float> variable("floats", {Nx}, {0}, {Nx}, true,
+                                           true);
+    std::vector<float> data(Nx);
+    variable.SetData(data.data());
+    EXPECT_EQ(deserializer.Get(variable, 0), 0);
+    EXPECT_EQ(data, StepData(0));
+
+    // EndStep unpins
+    deserializer.Erase(0);
+    EXPECT_TRUE(deserializer.EraseOldest());
+    EXPECT_EQ(deserializer.Steps(), 0);
+}
+
+//******************************************************************************
+// engine, over zmq
+//******************************************************************************
+
+#ifdef ADIOS2_HAVE_ZEROMQ
+
+class DataManBufferedStepsEngineTest
+: public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(DataManBufferedStepsEngineTest, ReadLate)
+{
+    const std::string policy = GetParam();
+    const bool dropOldest = (policy == "drop_oldest");
+    const size_t NSteps = 10;
+    const size_t MaxBufferedSteps = 2;
+    const std::string port = dropOldest ? "12410" : "12420";
+
+    adios2::ADIOS adios(MPI_COMM_SELF, adios2::DebugON);
+
+    adios2::IO readIO = adios.DeclareIO("ReadIO");
+    readIO.SetEngine("DataMan");
+    readIO.SetParameters(
+        {{"WorkflowMode", "subscribe"},
+         {"MaxBufferedSteps", std::to_string(MaxBufferedSteps)},
+         {"BufferedStepsPolicy", policy}});
+    readIO.AddTransport("WAN", {{"Library", "ZMQ"},
+                                {"IPAddress", "127.0.0.1"},
+                                {"Port", port}});
+
+    adios2::IO writeIO = adios.DeclareIO("WriteIO");
+    writeIO.SetEngine("DataMan");
+    writeIO.SetParameters({{"WorkflowMode", "subscribe"}});
+    writeIO.AddTransport("WAN", {{"Library", "ZMQ"},
+                                 {"IPAddress", "127.0.0.1"},
+                                 {"Port", port}});
+    auto var_floats = writeIO.DefineVariable<float>("floats", {Nx}, {0}, {Nx});
+
+    adios2::Engine dataManWriter = writeIO.Open("stream", adios2::Mode::Write);
+    adios2::Engine dataManReader = readIO.Open("stream", adios2::Mode::Read);
+
+    // subscribers miss messages sent before they are connected
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        const std::vector<float> data = StepData(step);
+        dataManWriter.BeginStep();
+        dataManWriter.Put(var_floats, data.data(), adios2::Mode::Sync);
+        dataManWriter.EndStep();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // all steps arrived, more than MaxBufferedSteps are waiting to be read
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    std::vector<size_t> readSteps;
+    std::vector<float> data(Nx);
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((readSteps.empty() || readSteps.back() < NSteps - 1) &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        if (dataManReader.BeginStep() != adios2::StepStatus::OK)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        const size_t step = dataManReader.CurrentStep();
+        adios2::Variable<float> var_read =
+            readIO.InquireVariable<float>("floats");
+        EXPECT_TRUE(var_read);
+        if (var_read)
+        {
+            dataManReader.Get(var_read, data.data(), adios2::Mode::Sync);
+            EXPECT_EQ(data, StepData(step)) << "step " << step;
+        }
+        dataManReader.EndStep();
+        readSteps.push_back(step);
+    }
+
+    dataManWriter.Close();
+    dataManReader.Close();
+
+    std::vector<size_t> expectedSteps(dropOldest ? MaxBufferedSteps : NSteps);
+    std::iota(expectedSteps.begin(), expectedSteps.end(),
+              NSteps - expectedSteps.size());
+
+    // block keeps the steps in the transport, drop_oldest keeps the latest
+    EXPECT_EQ(readSteps, expectedSteps);
+}
+
+INSTANTIATE_TEST_CASE_P(Policy, DataManBufferedStepsEngineTest,
+                        ::testing::Values("block", "drop_oldest"));
+
+#endif
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
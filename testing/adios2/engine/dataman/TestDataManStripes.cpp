@@ -0,0 +1,218 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestDataManStripes.cpp : striped DataMan channels over in-memory transports
+ */
+
+#include <algorithm> //std::copy
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric> //std::iota
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/toolkit/transportman/dataman/DataMan.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/** messages of one socket, in order */
+struct Wire
+{
+    std::mutex Mutex;
+    std::deque<std::vector<char>> Messages;
+};
+
+/** message transport over a Wire, parts of a message are concatenated */
+class LoopbackTransport : public adios2::Transport
+{
+public:
+    LoopbackTransport(std::shared_ptr<Wire> wire)
+    : Transport("Loopback", "test", MPI_COMM_SELF, true), m_Wire(wire)
+    {
+    }
+
+    void Open(const std::string &name, const adios2::Mode openMode) final
+    {
+        m_Name = name;
+        m_OpenMode = openMode;
+        m_IsOpen = true;
+    }
+
+    void Write(const char *buffer, size_t size, size_t start) final
+    {
+        WriteV({{buffer, size}}, start);
+    }
+
+    void IWrite(const char *buffer, size_t size, Status &status,
+                size_t start) final
+    {
+        WriteV({{buffer, size}}, start);
+        status.Bytes = size;
+    }
+
+    void WriteV(const std::vector<Segment> &segments, size_t start) final
+    {
+        std::vector<char> message;
+        for (const Segment &segment : segments)
+        {
+            message.insert(message.end(), segment.first,
+                           segment.first + segment.second);
+        }
+        std::lock_guard<std::mutex> l(m_Wire->Mutex);
+        m_Wire->Messages.push_back(std::move(message));
+    }
+
+    void Read(char *buffer, size_t size, size_t start) final {}
+
+    void IRead(char *buffer, size_t size, Status &status, size_t start) final
+    {
+        status.Bytes = 0;
+        {
+            std::lock_guard<std::mutex> l(m_Wire->Mutex);
+            if (!m_Wire->Messages.empty())
+            {
+                const std::vector<char> &message = m_Wire->Messages.front();
+                status.Bytes = std::min(size, message.size());
+                std::copy(message.begin(), message.begin() + status.Bytes,
+                          buffer);
+                m_Wire->Messages.pop_front();
+            }
+        }
+        if (status.Bytes == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    void Close() final { m_IsOpen = false; }
+
+private:
+    std::shared_ptr<Wire> m_Wire;
+};
+
+std::vector<std::shared_ptr<adios2::Transport>>
+OpenStripes(const std::vector<std::shared_ptr<Wire>> &wires,
+            const adios2::Mode mode)
+{
+    std::vector<std::shared_ptr<adios2::Transport>> transports;
+    for (const auto &wire : wires)
+    {
+        transports.push_back(std::make_shared<LoopbackTransport>(wire));
+        transports.back()->Open("stripes", mode);
+    }
+    return transports;
+}
+
+std::vector<char> MakeMessage(const size_t size, const char first)
+{
+    std::vector<char> message(size);
+    std::iota(message.begin(), message.end(), first);
+    return message;
+}
+
+/** Polls channel 0 until a message arrives, nullptr after a few seconds */
+std::shared_ptr<std::vector<char>>
+ReadMessage(adios2::transportman::DataMan &reader)
+{
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        std::shared_ptr<std::vector<char>> message = reader.ReadWAN(0);
+        if (message != nullptr)
+        {
+            return message;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(250));
+    }
+    return nullptr;
+}
+
+} // end anonymous namespace
+
+class DataManStripesTest : public ::testing::TestWithParam<size_t>
+{
+};
+
+TEST_P(DataManStripesTest, Reassemble)
+{
+    const size_t stripes = GetParam();
+    std::vector<std::shared_ptr<Wire>> wires;
+    for (size_t s = 0; s < stripes; ++s)
+    {
+        wires.push_back(std::make_shared<Wire>());
+    }
+
+    adios2::transportman::DataMan reader(MPI_COMM_SELF, true);
+    adios2::transportman::DataMan writer(MPI_COMM_SELF, true);
+    reader.OpenTransports({OpenStripes(wires, adios2::Mode::Read)},
+                          adios2::Mode::Read);
+    writer.OpenTransports({OpenStripes(wires, adios2::Mode::Write)},
+                          adios2::Mode::Write);
+
+    // sizes not divisible by the stripes, smaller than them, and large
+    const std::vector<size_t> sizes = {1000, 1, 2, 4099, 1 << 20, 7};
+    std::vector<std::vector<char>> expected;
+
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        expected.push_back(
+            MakeMessage(sizes[i], static_cast<char>(expected.size())));
+        writer.WriteWAN(
+            std::make_shared<std::vector<char>>(expected.back()), 0);
+    }
+
+    // zero-copy writes split segment boundaries across stripes
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        const std::vector<char> head =
+            MakeMessage(sizes[i], static_cast<char>(expected.size()));
+        const std::vector<char> tail = MakeMessage(sizes[i] / 3 + 5, 'a');
+        std::vector<char> message(head);
+        message.insert(message.end(), tail.begin(), tail.end());
+        expected.push_back(message);
+
+        std::future<void> released = writer.WriteWAN(
+            {{head.data(), head.size()}, {tail.data(), tail.size()}}, 0);
+        EXPECT_NO_THROW(released.get());
+    }
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        std::shared_ptr<std::vector<char>> message = ReadMessage(reader);
+        ASSERT_NE(message, nullptr) << "message " << i;
+        EXPECT_EQ(*message, expected[i]) << "message " << i;
+    }
+    EXPECT_EQ(reader.ReadWAN(0), nullptr);
+}
+
+INSTANTIATE_TEST_CASE_P(Stripes, DataManStripesTest,
+                        ::testing::Values(1, 2, 3, 8));
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
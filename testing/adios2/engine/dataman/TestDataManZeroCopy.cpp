@@ -0,0 +1,286 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestDataManZeroCopy.cpp : ZeroCopy serializer round trip over a transport
+ * that holds segments until released, as zmq does with zmq_msg_init_data
+ */
+
+#include <algorithm> //std::copy, std::fill
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric> //std::iota
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/core/Variable.h"
+#include "adios2/toolkit/format/dataman/DataMan.tcc"
+#include "adios2/toolkit/transportman/dataman/DataMan.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Shared by both ends of a transport: writes hold their segments, without
+ * copying them, until Release copies them into a message, like zmq sending
+ * then calling the free callback
+ */
+struct Link
+{
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    std::vector<adios2::Transport::Segment> Held;
+    bool Holding = false;
+    std::deque<std::vector<char>> Messages;
+
+    /** Waits for a write to hold its segments, false after a few seconds */
+    bool WaitHeld()
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        return Condition.wait_for(lock, std::chrono::seconds(10),
+                                  [this] { return Holding; });
+    }
+
+    /** Sends the held segments and lets their write return */
+    void Release()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        std::vector<char> message;
+        for (const adios2::Transport::Segment &segment : Held)
+        {
+            message.insert(message.end(), segment.first,
+                           segment.first + segment.second);
+        }
+        Messages.push_back(std::move(message));
+        Held.clear();
+        Holding = false;
+        Condition.notify_all();
+    }
+};
+
+class HoldingTransport : public adios2::Transport
+{
+public:
+    HoldingTransport(std::shared_ptr<Link> link)
+    : Transport("Holding", "test", MPI_COMM_SELF, true), m_Link(link)
+    {
+    }
+
+    void Open(const std::string &name, const adios2::Mode openMode) final
+    {
+        m_Name = name;
+        m_OpenMode = openMode;
+        m_IsOpen = true;
+    }
+
+    void Write(const char *buffer, size_t size, size_t start) final
+    {
+        WriteV({{buffer, size}}, start);
+    }
+
+    void IWrite(const char *buffer, size_t size, Status &status,
+                size_t start) final
+    {
+        WriteV({{buffer, size}}, start);
+        status.Bytes = size;
+    }
+
+    void WriteV(const std::vector<Segment> &segments, size_t start) final
+    {
+        std::unique_lock<std::mutex> lock(m_Link->Mutex);
+        m_Link->Held = segments;
+        m_Link->Holding = true;
+        m_Link->Condition.notify_all();
+        m_Link->Condition.wait(lock, [this] { return !m_Link->Holding; });
+    }
+
+    void Read(char *buffer, size_t size, size_t start) final {}
+
+    void IRead(char *buffer, size_t size, Status &status, size_t start) final
+    {
+        status.Bytes = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_Link->Mutex);
+            if (!m_Link->Messages.empty())
+            {
+                const std::vector<char> &message = m_Link->Messages.front();
+                status.Bytes = std::min(size, message.size());
+                std::copy(message.begin(), message.begin() + status.Bytes,
+                          buffer);
+                m_Link->Messages.pop_front();
+            }
+        }
+        if (status.Bytes == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    void Close() final { m_IsOpen = false; }
+
+private:
+    std::shared_ptr<Link> m_Link;
+};
+
+std::vector<std::shared_ptr<adios2::Transport>>
+OpenLink(std::shared_ptr<Link> link, const adios2::Mode mode)
+{
+    std::vector<std::shared_ptr<adios2::Transport>> transports = {
+        std::make_shared<HoldingTransport>(link)};
+    transports.back()->Open("zerocopy", mode);
+    return transports;
+}
+
+/** Polls channel 0 until a message arrives, nullptr after a few seconds */
+std::shared_ptr<std::vector<char>>
+ReadMessage(adios2::transportman::DataMan &reader)
+{
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        std::shared_ptr<std::vector<char>> message = reader.ReadWAN(0);
+        if (message != nullptr)
+        {
+            return message;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(250));
+    }
+    return nullptr;
+}
+
+} // end anonymous namespace
+
+class DataManZeroCopyTest : public ::testing::TestWithParam<bool>
+{
+};
+
+TEST_P(DataManZeroCopyTest, RoundTrip)
+{
+    const bool binaryMetadata = GetParam();
+
+    // large is above the zero copy threshold, small is copied
+    const size_t largeSize = 100000;
+    const size_t smallSize = 10;
+    std::vector<float> large(largeSize);
+    std::vector<float> small(smallSize);
+    std::iota(large.begin(), large.end(), 0.f);
+    std::iota(small.begin(), small.end(), -100.f);
+    const std::vector<float> expectedLarge(large);
+
+    adios2::core::Variable<float> vLarge("large", {largeSize}, {0},
+                                         {largeSize}, true, true);
+    adios2::core::Variable<float> vSmall("small", {smallSize}, {0},
+                                         {smallSize}, true, true);
+    vLarge.SetData(large.data());
+    vSmall.SetData(small.data());
+
+    adios2::format::DataManSerializer serializer(binaryMetadata, true);
+    serializer.New(1024);
+    serializer.Put(vSmall, "zerocopy", 0, 0, {});
+    serializer.Put(vLarge, "zerocopy", 0, 0, {});
+    serializer.Put(vSmall, "zerocopy", 0, 0, {});
+
+    // the stream is the same as the one of a copying serializer
+    adios2::format::DataManSerializer copying(binaryMetadata, false);
+    copying.New(1024);
+    copying.Put(vSmall, "zerocopy", 0, 0, {});
+    copying.Put(vLarge, "zerocopy", 0, 0, {});
+    copying.Put(vSmall, "zerocopy", 0, 0, {});
+
+    const std::vector<adios2::Transport::Segment> segments =
+        serializer.GetSegments();
+    std::vector<char> concatenated;
+    for (const adios2::Transport::Segment &segment : segments)
+    {
+        concatenated.insert(concatenated.end(), segment.first,
+                            segment.first + segment.second);
+    }
+    EXPECT_EQ(concatenated, *copying.Get());
+
+    auto lf_ReferencesLarge =
+        [&large](const std::vector<adios2::Transport::Segment> &parts) {
+            return std::any_of(
+                parts.begin(), parts.end(),
+                [&large](const adios2::Transport::Segment &part) {
+                    return part.first ==
+                               reinterpret_cast<const char *>(large.data()) &&
+                           part.second == large.size() * sizeof(float);
+                });
+        };
+    EXPECT_TRUE(lf_ReferencesLarge(segments));
+
+    std::shared_ptr<Link> link = std::make_shared<Link>();
+    adios2::transportman::DataMan reader(MPI_COMM_SELF, true);
+    adios2::transportman::DataMan writer(MPI_COMM_SELF, true);
+    reader.OpenTransports({OpenLink(link, adios2::Mode::Read)},
+                          adios2::Mode::Read);
+    writer.OpenTransports({OpenLink(link, adios2::Mode::Write)},
+                          adios2::Mode::Write);
+
+    std::future<void> released = writer.WriteWAN(segments, 0);
+
+    // the transport still references the user buffer, so the write is not
+    // complete and the buffer must not be reused yet
+    const bool held = link->WaitHeld();
+    EXPECT_TRUE(held);
+    if (held)
+    {
+        std::lock_guard<std::mutex> lock(link->Mutex);
+        EXPECT_TRUE(lf_ReferencesLarge(link->Held));
+    }
+    EXPECT_EQ(released.wait_for(std::chrono::milliseconds(100)),
+              std::future_status::timeout);
+
+    link->Release();
+    EXPECT_NO_THROW(released.get());
+
+    // reusing the user buffer after release does not affect what was sent
+    std::fill(large.begin(), large.end(), -1.f);
+
+    std::shared_ptr<std::vector<char>> message = ReadMessage(reader);
+    ASSERT_NE(message, nullptr);
+    EXPECT_EQ(*message, *copying.Get());
+
+    adios2::format::DataManDeserializer deserializer;
+    deserializer.Put(message);
+
+    std::vector<float> outLarge(largeSize);
+    std::vector<float> outSmall(smallSize);
+    vLarge.SetData(outLarge.data());
+    vSmall.SetData(outSmall.data());
+    EXPECT_EQ(deserializer.Get(vLarge, 0), 0);
+    EXPECT_EQ(deserializer.Get(vSmall, 0), 0);
+    EXPECT_EQ(outLarge, expectedLarge);
+    EXPECT_EQ(outSmall, small);
+}
+
+INSTANTIATE_TEST_CASE_P(Metadata, DataManZeroCopyTest,
+                        ::testing::Values(false, true));
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,167 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestSPSCQueue.cpp : bounded ring queue of the DataMan receive threads
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/toolkit/transportman/dataman/SPSCQueue.h"
+
+#include <gtest/gtest.h>
+
+using adios2::transportman::SPSCQueue;
+
+TEST(SPSCQueueTest, CapacityRoundedUp)
+{
+    EXPECT_EQ(SPSCQueue<int>(1).Capacity(), 1);
+    EXPECT_EQ(SPSCQueue<int>(5).Capacity(), 8);
+    EXPECT_EQ(SPSCQueue<int>(16).Capacity(), 16);
+    EXPECT_EQ(SPSCQueue<int>().Capacity(), 256);
+}
+
+TEST(SPSCQueueTest, Empty)
+{
+    SPSCQueue<int> queue(4);
+    int value = -1;
+    EXPECT_EQ(queue.Size(), 0);
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_EQ(value, -1);
+
+    int in = 7;
+    EXPECT_TRUE(queue.TryPush(in));
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 7);
+
+    // empty again after draining
+    EXPECT_EQ(queue.Size(), 0);
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_EQ(value, 7);
+}
+
+TEST(SPSCQueueTest, Full)
+{
+    // heap allocated, as DataMan does
+    std::unique_ptr<SPSCQueue<std::shared_ptr<int>>> queue(
+        new SPSCQueue<std::shared_ptr<int>>(4));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        std::shared_ptr<int> value = std::make_shared<int>(i);
+        EXPECT_TRUE(queue->TryPush(value));
+    }
+    EXPECT_EQ(queue->Size(), 4);
+
+    // every slot is used, a rejected value is not moved from
+    std::shared_ptr<int> rejected = std::make_shared<int>(4);
+    EXPECT_FALSE(queue->TryPush(rejected));
+    ASSERT_NE(rejected, nullptr);
+    EXPECT_EQ(*rejected, 4);
+
+    std::shared_ptr<int> value;
+    ASSERT_TRUE(queue->TryPop(value));
+    EXPECT_EQ(*value, 0);
+
+    // one slot freed
+    EXPECT_TRUE(queue->TryPush(rejected));
+    EXPECT_EQ(rejected, nullptr);
+    EXPECT_FALSE(queue->TryPush(value));
+
+    for (int i = 1; i < 5; ++i)
+    {
+        ASSERT_TRUE(queue->TryPop(value));
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_FALSE(queue->TryPop(value));
+}
+
+TEST(SPSCQueueTest, Wraparound)
+{
+    SPSCQueue<size_t> queue(8);
+
+    // batches of every size, so indices wrap the slots at every position
+    size_t pushed = 0;
+    size_t popped = 0;
+    for (size_t round = 0; round < 100; ++round)
+    {
+        const size_t batch = round % (queue.Capacity() + 1);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            size_t value = pushed;
+            ASSERT_TRUE(queue.TryPush(value));
+            ++pushed;
+        }
+        EXPECT_EQ(queue.Size(), batch);
+
+        for (size_t i = 0; i < batch; ++i)
+        {
+            size_t value = 0;
+            ASSERT_TRUE(queue.TryPop(value));
+            EXPECT_EQ(value, popped);
+            ++popped;
+        }
+        EXPECT_EQ(queue.Size(), 0);
+    }
+    EXPECT_GT(pushed, 10 * queue.Capacity());
+}
+
+TEST(SPSCQueueTest, ProducerConsumer)
+{
+    const size_t count = 1000000;
+    SPSCQueue<size_t> queue(16);
+
+    std::thread producer([&queue, count]() {
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t value = i;
+            while (!queue.TryPush(value))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    size_t expected = 0;
+    size_t value = 0;
+    while (expected < count)
+    {
+        if (queue.TryPop(value))
+        {
+            EXPECT_EQ(value, expected);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,661 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+#include <utility> //std::pair
+
+#include <adios2.h>
+
+#include <hdf5.h>
+
+#include <gtest/gtest.h>
+
+class HDF5WriteReadChunks : public ::testing::Test
+{
+public:
+    HDF5WriteReadChunks() = default;
+
+    /** writes steps with the HDF5 engine, then reads back all steps, and a
+     * subset, with one step selection each */
+    void WriteReadStepSelection1D(const std::string &fname,
+                                  const adios2::Params &params);
+};
+
+void HDF5WriteReadChunks::WriteReadStepSelection1D(
+    const std::string &fname, const adios2::Params &params)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 8;
+    // Number of steps
+    const size_t NSteps = 6;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<float> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<float>(step * 100 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("HDF5");
+        io.SetParameters(params);
+
+        auto var_r32 = io.DefineVariable<float>(
+            "r32", {Nx * mpiSize}, {Nx * mpiRank}, {Nx}, adios2::ConstantDims);
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<float> R32 = lf_GenerateData(step, mpiRank);
+
+            h5Writer.BeginStep();
+            h5Writer.Put(var_r32, R32.data());
+            h5Writer.EndStep();
+        }
+
+        h5Writer.Close();
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("HDF5");
+
+        adios2::Engine h5Reader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_r32 = io.InquireVariable<float>("r32");
+        EXPECT_TRUE(var_r32);
+        ASSERT_EQ(var_r32.Steps(), NSteps);
+        ASSERT_EQ(var_r32.Shape().size(), 1);
+        ASSERT_EQ(var_r32.Shape()[0], mpiSize * Nx);
+
+        var_r32.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        // all steps, then the middle ones
+        const std::vector<std::pair<size_t, size_t>> stepSelections = {
+            {0, NSteps}, {2, 3}};
+
+        for (const auto &stepSelection : stepSelections)
+        {
+            std::vector<float> R32(stepSelection.second * Nx);
+            var_r32.SetStepSelection(
+                {stepSelection.first, stepSelection.second});
+            h5Reader.Get(var_r32, R32.data(), adios2::Mode::Sync);
+
+            for (size_t s = 0; s < stepSelection.second; ++s)
+            {
+                const size_t t = stepSelection.first + s;
+                const std::vector<float> expectedR32 =
+                    lf_GenerateData(t, mpiRank);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(R32[s * Nx + i], expectedR32[i]) << msg;
+                }
+            }
+        }
+        h5Reader.Close();
+    }
+}
+
+//******************************************************************************
+// 1D deferred Puts of many variables in filtered chunked datasets
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5WriteReadDeferredChunks1D)
+{
+    const std::string fname("HDF5WriteReadDeferredChunks1D.h5");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 16;
+    // Number of steps
+    const size_t NSteps = 3;
+    // Number of variables
+    const size_t NVars = 10;
+    // Chunk size
+    const hsize_t ChunkX = 4;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const size_t var,
+                               const int rank) {
+        std::vector<int64_t> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int64_t>(step * 10000 + var * 1000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("HDF5");
+        io.SetParameters({{"ChunkDims", std::to_string(ChunkX)},
+                          {"DeflateLevel", "4"},
+                          {"Shuffle", "On"}});
+
+        std::vector<adios2::Variable<int64_t>> vars_i64;
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            vars_i64.push_back(io.DefineVariable<int64_t>(
+                "i64_" + std::to_string(v), {Nx * mpiSize}, {Nx * mpiRank},
+                {Nx}, adios2::ConstantDims));
+        }
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            // must stay valid until EndStep
+            std::vector<std::vector<int64_t>> I64(NVars);
+
+            h5Writer.BeginStep();
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                I64[v] = lf_GenerateData(step, v, mpiRank);
+                h5Writer.Put(vars_i64[v], I64[v].data());
+            }
+            h5Writer.EndStep();
+        }
+
+        h5Writer.Close();
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    {
+        // chunked layout
+        hid_t fileId = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+        ASSERT_GE(fileId, 0);
+        hid_t datasetId = H5Dopen(fileId, "/Step0/i64_0", H5P_DEFAULT);
+        ASSERT_GE(datasetId, 0);
+        hid_t dcplId = H5Dget_create_plist(datasetId);
+        EXPECT_EQ(H5Pget_layout(dcplId), H5D_CHUNKED);
+        hsize_t chunk[1] = {0};
+        EXPECT_EQ(H5Pget_chunk(dcplId, 1, chunk), 1);
+        EXPECT_EQ(chunk[0], ChunkX);
+        H5Pclose(dcplId);
+        H5Dclose(datasetId);
+        H5Fclose(fileId);
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("HDF5");
+
+        adios2::Engine h5Reader = io.Open(fname, adios2::Mode::Read);
+
+        std::vector<int64_t> I64(Nx);
+
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            auto var_i64 =
+                io.InquireVariable<int64_t>("i64_" + std::to_string(v));
+            EXPECT_TRUE(var_i64);
+            ASSERT_EQ(var_i64.Steps(), NSteps);
+            ASSERT_EQ(var_i64.Shape()[0], mpiSize * Nx);
+
+            var_i64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+            for (size_t t = 0; t < NSteps; ++t)
+            {
+                var_i64.SetStepSelection({t, 1});
+                h5Reader.Get(var_i64, I64.data(), adios2::Mode::Sync);
+
+                const std::vector<int64_t> expectedI64 =
+                    lf_GenerateData(t, v, mpiRank);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "t=" << t << " v=" << v << " i=" << i
+                       << " rank=" << mpiRank;
+                    std::string msg = ss.str();
+
+                    EXPECT_EQ(I64[i], expectedI64[i]) << msg;
+                }
+            }
+        }
+        h5Reader.Close();
+    }
+}
+
+//******************************************************************************
+// 1D steps stored along an extendible time dimension
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5WriteTimeDimension1D)
+{
+    const std::string fname("HDF5WriteTimeDimension1D.h5");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 8;
+    // Number of steps
+    const size_t NSteps = 5;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<double> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<double>(step * 1000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("HDF5");
+        io.SetParameters({{"TimeDimension", "On"}});
+
+        auto var_r64 = io.DefineVariable<double>(
+            "r64", {Nx * mpiSize}, {Nx * mpiRank}, {Nx}, adios2::ConstantDims);
+        auto var_step = io.DefineVariable<uint32_t>("step");
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<double> R64 = lf_GenerateData(step, mpiRank);
+            const uint32_t stepValue = static_cast<uint32_t>(step);
+
+            h5Writer.BeginStep();
+            h5Writer.Put(var_r64, R64.data());
+            h5Writer.Put(var_step, stepValue);
+            h5Writer.EndStep();
+        }
+
+        h5Writer.Close();
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    hid_t fileId = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(fileId, 0);
+
+    unsigned int numSteps = 0;
+    hid_t attrId = H5Aopen(fileId, "NumSteps", H5P_DEFAULT);
+    ASSERT_GE(attrId, 0);
+    H5Aread(attrId, H5T_NATIVE_UINT, &numSteps);
+    H5Aclose(attrId);
+    EXPECT_EQ(numSteps, NSteps);
+
+    {
+        hid_t datasetId = H5Dopen(fileId, "/r64", H5P_DEFAULT);
+        ASSERT_GE(datasetId, 0);
+        hid_t fileSpace = H5Dget_space(datasetId);
+        ASSERT_EQ(H5Sget_simple_extent_ndims(fileSpace), 2);
+        hsize_t dims[2] = {0, 0};
+        hsize_t maxDims[2] = {0, 0};
+        H5Sget_simple_extent_dims(fileSpace, dims, maxDims);
+        EXPECT_EQ(dims[0], NSteps);
+        EXPECT_EQ(dims[1], Nx * mpiSize);
+        EXPECT_EQ(maxDims[0], H5S_UNLIMITED);
+
+        // all steps of this rank's block in one read
+        hsize_t start[2] = {0, Nx * mpiRank};
+        hsize_t count[2] = {NSteps, Nx};
+        H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, NULL, count,
+                            NULL);
+        hid_t memSpace = H5Screate_simple(2, count, NULL);
+        std::vector<double> R64(NSteps * Nx);
+        EXPECT_GE(H5Dread(datasetId, H5T_NATIVE_DOUBLE, memSpace, fileSpace,
+                          H5P_DEFAULT, R64.data()),
+                  0);
+        H5Sclose(memSpace);
+        H5Sclose(fileSpace);
+        H5Dclose(datasetId);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            const std::vector<double> expectedR64 =
+                lf_GenerateData(t, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                EXPECT_EQ(R64[t * Nx + i], expectedR64[i]) << msg;
+            }
+        }
+    }
+
+    {
+        hid_t datasetId = H5Dopen(fileId, "/step", H5P_DEFAULT);
+        ASSERT_GE(datasetId, 0);
+        hid_t fileSpace = H5Dget_space(datasetId);
+        ASSERT_EQ(H5Sget_simple_extent_ndims(fileSpace), 1);
+        hsize_t dims[1] = {0};
+        H5Sget_simple_extent_dims(fileSpace, dims, NULL);
+        EXPECT_EQ(dims[0], NSteps);
+        H5Sclose(fileSpace);
+
+        std::vector<uint32_t> steps(NSteps);
+        EXPECT_GE(H5Dread(datasetId, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL,
+                          H5P_DEFAULT, steps.data()),
+                  0);
+        H5Dclose(datasetId);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            EXPECT_EQ(steps[t], t);
+        }
+    }
+
+    H5Fclose(fileId);
+}
+
+//******************************************************************************
+// 1D multi-step selections from a step group per step
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5ReadStepSelection1D)
+{
+    WriteReadStepSelection1D("HDF5ReadStepSelection1D.h5", {});
+}
+
+//******************************************************************************
+// 1D multi-step selections along a time dimension
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5ReadStepSelectionTimeDimension1D)
+{
+    WriteReadStepSelection1D("HDF5ReadStepSelectionTimeDimension1D.h5",
+                             {{"TimeDimension", "On"}});
+}
+
+//******************************************************************************
+// 1D step selection past the steps a variable was written for, along a time
+// dimension
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5ReadStepSelectionTimeExtent1D)
+{
+    const std::string fname("HDF5ReadStepSelectionTimeExtent1D.h5");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank
+    const size_t Nx = 8;
+    // Number of steps, and steps the partial variable is written for
+    const size_t NSteps = 6;
+    const size_t NPartialSteps = 3;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<float> data(Nx);
+        std::iota(data.begin(), data.end(),
+                  static_cast<float>(step * 100 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("HDF5");
+        io.SetParameters({{"TimeDimension", "On"}});
+
+        auto var_r32 = io.DefineVariable<float>(
+            "r32", {Nx * mpiSize}, {Nx * mpiRank}, {Nx}, adios2::ConstantDims);
+        auto var_partial = io.DefineVariable<float>(
+            "partial", {Nx * mpiSize}, {Nx * mpiRank}, {Nx},
+            adios2::ConstantDims);
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<float> R32 = lf_GenerateData(step, mpiRank);
+
+            h5Writer.BeginStep();
+            h5Writer.Put(var_r32, R32.data(), adios2::Mode::Sync);
+            if (step < NPartialSteps)
+            {
+                h5Writer.Put(var_partial, R32.data(), adios2::Mode::Sync);
+            }
+            h5Writer.EndStep();
+        }
+
+        h5Writer.Close();
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("HDF5");
+
+        adios2::Engine h5Reader = io.Open(fname, adios2::Mode::Read);
+
+        auto var_partial = io.InquireVariable<float>("partial");
+        ASSERT_TRUE(var_partial);
+        var_partial.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        // steps 1 to 4, only 1 and 2 were written
+        const size_t stepStart = 1;
+        const size_t stepCount = 4;
+        const float untouched = -1.f;
+        std::vector<float> partial(stepCount * Nx, untouched);
+        var_partial.SetStepSelection({stepStart, stepCount});
+        h5Reader.Get(var_partial, partial.data(), adios2::Mode::Sync);
+
+        for (size_t s = 0; s < stepCount; ++s)
+        {
+            const size_t t = stepStart + s;
+            const std::vector<float> expected = lf_GenerateData(t, mpiRank);
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                std::stringstream ss;
+                ss << "t=" << t << " i=" << i << " rank=" << mpiRank;
+                std::string msg = ss.str();
+
+                if (t < NPartialSteps)
+                {
+                    EXPECT_EQ(partial[s * Nx + i], expected[i]) << msg;
+                }
+                else
+                {
+                    EXPECT_EQ(partial[s * Nx + i], untouched) << msg;
+                }
+            }
+        }
+        h5Reader.Close();
+    }
+}
+
+//******************************************************************************
+// 1D elements no rank writes, and steps before a variable's first Put, read
+// back as the fill value along a time dimension
+//******************************************************************************
+
+TEST_F(HDF5WriteReadChunks, ADIOS2HDF5WriteTimeDimensionFill1D)
+{
+    const std::string fname("HDF5WriteTimeDimensionFill1D.h5");
+
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements per rank, each rank writes the first half only
+    const size_t Nx = 64;
+    // Number of steps, and first step of the late variable
+    const size_t NSteps = 4;
+    const size_t LateStep = 2;
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    auto lf_GenerateData = [&](const size_t step, const int rank) {
+        std::vector<int32_t> data(Nx / 2);
+        std::iota(data.begin(), data.end(),
+                  static_cast<int32_t>(1 + step * 1000 + rank * Nx));
+        return data;
+    };
+
+#ifdef ADIOS2_HAVE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD, adios2::DebugON);
+#else
+    adios2::ADIOS adios(true);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("HDF5");
+        io.SetParameters({{"TimeDimension", "On"}});
+
+        auto var_i32 = io.DefineVariable<int32_t>(
+            "i32", {Nx * mpiSize}, {Nx * mpiRank}, {Nx / 2},
+            adios2::ConstantDims);
+        auto var_late = io.DefineVariable<int32_t>(
+            "late", {Nx * mpiSize}, {Nx * mpiRank}, {Nx / 2},
+            adios2::ConstantDims);
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const std::vector<int32_t> I32 = lf_GenerateData(step, mpiRank);
+
+            h5Writer.BeginStep();
+            h5Writer.Put(var_i32, I32.data(), adios2::Mode::Sync);
+            if (step >= LateStep)
+            {
+                h5Writer.Put(var_late, I32.data(), adios2::Mode::Sync);
+            }
+            h5Writer.EndStep();
+        }
+
+        h5Writer.Close();
+    }
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    hid_t fileId = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(fileId, 0);
+
+    for (const std::string name : {"/i32", "/late"})
+    {
+        const size_t firstStep = (name == "/late") ? LateStep : 0;
+
+        hid_t datasetId = H5Dopen(fileId, name.c_str(), H5P_DEFAULT);
+        ASSERT_GE(datasetId, 0);
+
+        // partially written datasets keep their fill value
+        hid_t dcplId = H5Dget_create_plist(datasetId);
+        H5D_fill_time_t fillTime;
+        H5Pget_fill_time(dcplId, &fillTime);
+        EXPECT_NE(fillTime, H5D_FILL_TIME_NEVER) << name;
+        H5Pclose(dcplId);
+
+        std::vector<int32_t> I32(NSteps * Nx * mpiSize, -1);
+        EXPECT_GE(H5Dread(datasetId, H5T_NATIVE_INT32, H5S_ALL, H5S_ALL,
+                          H5P_DEFAULT, I32.data()),
+                  0);
+        H5Dclose(datasetId);
+
+        for (size_t t = 0; t < NSteps; ++t)
+        {
+            for (int r = 0; r < mpiSize; ++r)
+            {
+                const std::vector<int32_t> expected = lf_GenerateData(t, r);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    std::stringstream ss;
+                    ss << name << " t=" << t << " i=" << i << " rank=" << r;
+                    std::string msg = ss.str();
+
+                    const int32_t value = I32[(t * mpiSize + r) * Nx + i];
+                    if (t >= firstStep && i < Nx / 2)
+                    {
+                        EXPECT_EQ(value, expected[i]) << msg;
+                    }
+                    else
+                    {
+                        EXPECT_EQ(value, 0) << msg;
+                    }
+                }
+            }
+        }
+    }
+
+    H5Fclose(fileId);
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -268,8 +268,143 @@ public:
         reader.Close();
     }
 
+    /* size of each writer block in the PartialBlock test */
+    const size_t partialNdx = 200;
+    const size_t partialNdy = 1000;
+
+    /* Selections inside one large writer block, that are not whole rows of
+     * it, so engines that read only the selected ranges of a block are
+     * exercised.  Each reader picks the block of writer rank % nwriters.
+     */
+    void PartialSelection(size_t gndx, size_t gndy, int rank, size_t step,
+                          adios2::Dims &start, adios2::Dims &count)
+    {
+        const size_t ndx = partialNdx;
+        const size_t ndy = partialNdy;
+        const size_t npx = gndx / ndx;
+        const size_t nwriters = npx * (gndy / ndy);
+        const size_t writer = rank % nwriters;
+        const size_t bx = (writer % npx) * ndx;
+        const size_t by = (writer / npx) * ndy;
+
+        switch (step % 4)
+        {
+        case 0:
+            // interior box
+            start = {bx + 3, by + 5};
+            count = {ndx / 2, ndy / 3};
+            break;
+        case 1:
+            // single column
+            start = {bx, by + ndy / 2};
+            count = {ndx, 1};
+            break;
+        case 2:
+            // last element of the block
+            start = {bx + ndx - 1, by + ndy - 1};
+            count = {1, 1};
+            break;
+        default:
+            // from the middle of the block to the end of the global array,
+            // crossing into the next blocks if any
+            start = {bx + ndx / 4, by + ndy / 2};
+            count = {gndx - start[0], gndy - start[1]};
+            break;
+        }
+    }
+
+    void MainPartialWriters(MPI_Comm comm, size_t npx, size_t npy, int steps)
+    {
+        int rank;
+        MPI_Comm_rank(comm, &rank);
+        const size_t ndx = partialNdx;
+        const size_t ndy = partialNdy;
+        size_t offsx = (rank % npx) * ndx;
+        size_t offsy = (rank / npx) * ndy;
+
+        std::vector<float> myArray(ndx * ndy);
+
+        adios2::ADIOS adios(comm);
+        adios2::IO io = adios.DeclareIO("writer");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParams);
+
+        adios2::Variable<float> varArray = io.DefineVariable<float>(
+            "myArray", {npx * ndx, npy * ndy}, {offsx, offsy}, {ndx, ndy},
+            adios2::ConstantDims);
+
+        adios2::Engine writer = io.Open(streamName, adios2::Mode::Write, comm);
+
+        for (size_t step = 0; step < steps; ++step)
+        {
+            size_t idx = 0;
+            for (size_t x = 0; x < ndx; ++x)
+            {
+                for (size_t y = 0; y < ndy; ++y)
+                {
+                    myArray[idx] = GetValue(offsx + x, offsy + y, step);
+                    ++idx;
+                }
+            }
+            writer.BeginStep(adios2::StepMode::Append);
+            writer.Put<float>(varArray, myArray.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+    void MainPartialReaders(MPI_Comm comm)
+    {
+        int rank;
+        MPI_Comm_rank(comm, &rank);
+
+        adios2::ADIOS adios(comm);
+        adios2::IO io = adios.DeclareIO("reader");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParams);
+        adios2::Engine reader = io.Open(streamName, adios2::Mode::Read, comm);
+
+        size_t step = 0;
+        std::vector<float> myArray;
+
+        while (true)
+        {
+            adios2::StepStatus status =
+                reader.BeginStep(adios2::StepMode::NextAvailable, 60.0f);
+            if (status != adios2::StepStatus::OK)
+            {
+                break;
+            }
+
+            adios2::Variable<float> vMyArray =
+                io.InquireVariable<float>("myArray");
+            if (!vMyArray)
+            {
+                throw std::ios_base::failure("Missing 'myArray' variable.");
+            }
+
+            size_t gndx = vMyArray.Shape()[0];
+            size_t gndy = vMyArray.Shape()[1];
+            adios2::Dims start;
+            adios2::Dims count;
+            PartialSelection(gndx, gndy, rank, step, start, count);
+
+            vMyArray.SetSelection({start, count});
+            myArray.resize(count[0] * count[1]);
+
+            reader.Get(vMyArray, myArray.data());
+            reader.EndStep();
+            CheckData(myArray, gndx, gndy, start[0], start[1], count[0],
+                      count[1], step, rank);
+            ++step;
+        }
+        EXPECT_GT(step, 0);
+        reader.Close();
+    }
+
     void TestCommon(RunParams p, int steps, unsigned int writer_sleeptime,
-                    unsigned int reader_sleeptime)
+                    unsigned int reader_sleeptime,
+                    const bool partialBlock = false)
     {
         std::cout << "test " << p.npx_w << "x" << p.npy_w << " writers "
                   << p.npx_r << "x" << p.npy_r << " readers " << std::endl;
@@ -310,13 +445,27 @@ public:
         {
             std::cout << "Process wrank " << wrank << " rank " << rank
                       << " calls MainWriters " << std::endl;
-            MainWriters(comm, p.npx_w, p.npy_w, steps, writer_sleeptime);
+            if (partialBlock)
+            {
+                MainPartialWriters(comm, p.npx_w, p.npy_w, steps);
+            }
+            else
+            {
+                MainWriters(comm, p.npx_w, p.npy_w, steps, writer_sleeptime);
+            }
         }
         else if (color == 1)
         {
             std::cout << "Process wrank " << wrank << " rank " << rank
                       << " calls MainReaders " << std::endl;
-            MainReaders(comm, p.npx_r, p.npy_r, reader_sleeptime);
+            if (partialBlock)
+            {
+                MainPartialReaders(comm);
+            }
+            else
+            {
+                MainReaders(comm, p.npx_r, p.npy_r, reader_sleeptime);
+            }
         }
         std::cout << "Process wrank " << wrank << " rank " << rank
                   << " enters MPI barrier..." << std::endl;
@@ -351,6 +500,12 @@ TEST_P(TestStagingMPMD, SlowReader)
     TestCommon(p, 5, 0, 500);
 }
 
+TEST_P(TestStagingMPMD, PartialBlock)
+{
+    RunParams p = GetParam();
+    TestCommon(p, 4, 0, 0, true);
+}
+
 INSTANTIATE_TEST_CASE_P(NxM, TestStagingMPMD,
                         ::testing::ValuesIn(CreateRunParams()));
 
@@ -0,0 +1,209 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestBoxIndex.cpp : helper::BoxIndex queries against a brute-force scan
+ */
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/helper/adiosMath.h"
+
+#include <gtest/gtest.h>
+
+using adios2::Box;
+using adios2::Dims;
+namespace helper = adios2::helper;
+
+namespace
+{
+
+/** positions of boxes with a non-empty IntersectionBox with selection */
+std::vector<size_t> BruteForce(const std::vector<Box<Dims>> &boxes,
+                               const Box<Dims> &selection)
+{
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        const Box<Dims> intersection =
+            helper::IntersectionBox(boxes[i], selection);
+        if (intersection.first.empty())
+        {
+            continue;
+        }
+
+        // an empty box or selection leaves an end below its start
+        bool isEmpty = false;
+        for (size_t d = 0; d < intersection.first.size(); ++d)
+        {
+            if (intersection.first[d] > intersection.second[d] ||
+                boxes[i].first[d] > boxes[i].second[d] ||
+                selection.first[d] > selection.second[d])
+            {
+                isEmpty = true;
+            }
+        }
+        if (!isEmpty)
+        {
+            positions.push_back(i);
+        }
+    }
+    return positions;
+}
+
+/** box of count in [1, maxCount] per dimension inside [0, extent) */
+Box<Dims> RandomBox(std::mt19937 &generator, const size_t nDims,
+                    const size_t extent, const size_t maxCount)
+{
+    Dims start(nDims);
+    Dims count(nDims);
+    for (size_t d = 0; d < nDims; ++d)
+    {
+        count[d] = std::uniform_int_distribution<size_t>(1, maxCount)(
+            generator);
+        start[d] = std::uniform_int_distribution<size_t>(
+            0, extent - count[d])(generator);
+    }
+    return helper::StartEndBox(start, count);
+}
+
+} // end anonymous namespace
+
+TEST(BoxIndexTest, EmptyIndex)
+{
+    const helper::BoxIndex index;
+    EXPECT_EQ(index.Size(), 0);
+    EXPECT_TRUE(index.Intersecting(helper::StartEndBox({0}, {10})).empty());
+}
+
+TEST(BoxIndexTest, OverlappingRandomBoxes)
+{
+    std::mt19937 generator(20261018);
+
+    for (size_t nDims = 1; nDims <= 3; ++nDims)
+    {
+        // more boxes than a leaf holds, so queries walk the tree
+        for (const size_t nBoxes : {1, 15, 16, 17, 200, 1000})
+        {
+            std::vector<Box<Dims>> boxes;
+            for (size_t i = 0; i < nBoxes; ++i)
+            {
+                boxes.push_back(RandomBox(generator, nDims, 100, 20));
+            }
+            const helper::BoxIndex index(boxes);
+            ASSERT_EQ(index.Size(), nBoxes);
+
+            for (size_t q = 0; q < 50; ++q)
+            {
+                const Box<Dims> selection =
+                    RandomBox(generator, nDims, 100, 40);
+                EXPECT_EQ(index.Intersecting(selection),
+                          BruteForce(boxes, selection))
+                    << "dims=" << nDims << " boxes=" << nBoxes
+                    << " query=" << q;
+            }
+        }
+    }
+}
+
+TEST(BoxIndexTest, TouchingEdges)
+{
+    // 8 x 8 tiles of 4 x 4 elements, neighbours touch without overlapping
+    const size_t tiles = 8;
+    const size_t tile = 4;
+    std::vector<Box<Dims>> boxes;
+    for (size_t i = 0; i < tiles; ++i)
+    {
+        for (size_t j = 0; j < tiles; ++j)
+        {
+            boxes.push_back(
+                helper::StartEndBox({i * tile, j * tile}, {tile, tile}));
+        }
+    }
+    const helper::BoxIndex index(boxes);
+
+    // ends are inclusive: a selection starting on the last row of a tile
+    // intersects it, one starting right after does not
+    const Box<Dims> lastRow = helper::StartEndBox({tile - 1, 0}, {1, 1});
+    EXPECT_EQ(index.Intersecting(lastRow), std::vector<size_t>({0}));
+
+    const Box<Dims> nextRow = helper::StartEndBox({tile, 0}, {1, 1});
+    EXPECT_EQ(index.Intersecting(nextRow), std::vector<size_t>({tiles}));
+
+    // a corner shared by four tiles
+    const Box<Dims> corner = helper::StartEndBox({tile - 1, tile - 1}, {2, 2});
+    EXPECT_EQ(index.Intersecting(corner),
+              std::vector<size_t>({0, 1, tiles, tiles + 1}));
+
+    for (size_t i = 0; i < tiles * tile; ++i)
+    {
+        const Box<Dims> row = helper::StartEndBox({i, 0}, {1, tiles * tile});
+        EXPECT_EQ(index.Intersecting(row), BruteForce(boxes, row))
+            << "row=" << i;
+        const Box<Dims> column =
+            helper::StartEndBox({0, i}, {tiles * tile, 1});
+        EXPECT_EQ(index.Intersecting(column), BruteForce(boxes, column))
+            << "column=" << i;
+    }
+}
+
+TEST(BoxIndexTest, ZeroCountBoxes)
+{
+    std::mt19937 generator(1018);
+
+    // every third box has a zero count in its last dimension
+    std::vector<Box<Dims>> boxes;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const size_t lastCount = (i % 3 == 0) ? 0 : 5;
+        boxes.push_back(helper::StartEndBox({1 + i % 10, 1 + i / 10},
+                                            {5, lastCount}));
+    }
+    const helper::BoxIndex index(boxes);
+
+    for (size_t q = 0; q < 100; ++q)
+    {
+        const Box<Dims> selection = RandomBox(generator, 2, 20, 10);
+        const std::vector<size_t> positions = index.Intersecting(selection);
+        EXPECT_EQ(positions, BruteForce(boxes, selection)) << "query=" << q;
+        for (const size_t position : positions)
+        {
+            EXPECT_NE(position % 3, 0) << "query=" << q;
+        }
+    }
+
+    // zero count selections intersect nothing
+    const Box<Dims> empty = helper::StartEndBox({5, 5}, {0, 10});
+    EXPECT_TRUE(index.Intersecting(empty).empty());
+
+    // an index of zero count boxes only
+    const helper::BoxIndex emptyBoxes(
+        std::vector<Box<Dims>>(20, helper::StartEndBox({3}, {0})));
+    EXPECT_TRUE(
+        emptyBoxes.Intersecting(helper::StartEndBox({0}, {10})).empty());
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
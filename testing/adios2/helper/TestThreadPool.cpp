@@ -0,0 +1,217 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestThreadPool.cpp : persistent worker threads owned by core::ADIOS, and
+ * the helpers running on them
+ */
+
+#include <algorithm> //std::equal
+#include <atomic>
+#include <cstdint>
+#include <functional> //std::ref
+#include <future>
+#include <numeric> //std::iota
+#include <stdexcept>
+#include <thread>
+#include <utility> //std::swap
+#include <vector>
+
+#include <adios2.h>
+
+#include "adios2/core/ADIOS.h"
+#include "adios2/core/IO.h"
+#include "adios2/helper/adiosMath.h"
+#include "adios2/helper/adiosMemory.h"
+#include "adios2/helper/adiosThreadPool.h"
+
+#include <gtest/gtest.h>
+
+using adios2::helper::ThreadPool;
+
+/** true: tasks run on a ThreadPool, false: on threads spawned per call */
+class ThreadPoolTest : public ::testing::TestWithParam<bool>
+{
+public:
+    ThreadPool m_Pool{4};
+
+    ThreadPool *Pool() { return GetParam() ? &m_Pool : nullptr; }
+};
+
+TEST_P(ThreadPoolTest, RunCompletesEveryTask)
+{
+    const size_t tasks = 1000;
+    std::vector<std::atomic<int>> runs(tasks);
+    for (auto &run : runs)
+    {
+        run = 0;
+    }
+
+    for (const unsigned int threads : {1u, 2u, 4u, 16u})
+    {
+        adios2::helper::RunTasks(Pool(), tasks,
+                                 [&](const size_t t) { ++runs[t]; }, threads);
+    }
+
+    for (size_t t = 0; t < tasks; ++t)
+    {
+        EXPECT_EQ(runs[t], 4) << "task " << t;
+    }
+
+    // no tasks, nothing to wait for
+    adios2::helper::RunTasks(Pool(), 0, [](const size_t) {}, 4);
+}
+
+TEST_P(ThreadPoolTest, RunRethrows)
+{
+    const size_t tasks = 100;
+    std::atomic<size_t> runs(0);
+
+    auto lf_Task = [&](const size_t t) {
+        ++runs;
+        if (t == 7)
+        {
+            throw std::runtime_error("task 7");
+        }
+    };
+
+    EXPECT_THROW(adios2::helper::RunTasks(Pool(), tasks, lf_Task, 4),
+                 std::runtime_error);
+
+    // tasks are not cancelled, all of them finished before the rethrow
+    EXPECT_EQ(runs, tasks);
+
+    // still usable
+    runs = 0;
+    adios2::helper::RunTasks(Pool(), tasks, [&](const size_t) { ++runs; }, 4);
+    EXPECT_EQ(runs, tasks);
+}
+
+TEST_P(ThreadPoolTest, SubmitTask)
+{
+    std::atomic<int> value(0);
+    std::future<void> done =
+        adios2::helper::SubmitTask(Pool(), [&value]() { value = 1; });
+    done.get();
+    EXPECT_EQ(value, 1);
+
+    std::future<void> failed = adios2::helper::SubmitTask(
+        Pool(), []() { throw std::runtime_error("job"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST_P(ThreadPoolTest, ThreadedHelpers)
+{
+    const size_t size = 100003;
+    std::vector<int64_t> values(size);
+    std::iota(values.begin(), values.end(), -50000);
+    std::swap(values[0], values[size / 2]);
+
+    int64_t min = 0;
+    int64_t max = 0;
+
+    // exceptions of RunTasks reach the caller instead of std::terminate
+    std::vector<char> buffer(16 + size * sizeof(int64_t));
+    size_t position = 16;
+    EXPECT_FALSE(noexcept(adios2::helper::GetMinMaxThreads(
+        values.data(), size, min, max, 4, Pool())));
+    EXPECT_FALSE(noexcept(adios2::helper::CopyToBufferThreads(
+        buffer, position, values.data(), size, 4, Pool())));
+    EXPECT_FALSE(noexcept(adios2::helper::CopyToBufferMinMaxThreads(
+        buffer, position, values.data(), size, min, max, 4, Pool())));
+
+    adios2::helper::GetMinMaxThreads(values.data(), size, min, max, 4,
+                                     Pool());
+    EXPECT_EQ(min, -50000);
+    EXPECT_EQ(max, static_cast<int64_t>(size) - 50001);
+
+    adios2::helper::CopyToBufferThreads(buffer, position, values.data(), size,
+                                        4, Pool());
+    EXPECT_EQ(position, buffer.size());
+    const int64_t *copied =
+        reinterpret_cast<const int64_t *>(buffer.data() + 16);
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), copied));
+
+    position = 16;
+    min = max = 0;
+    adios2::helper::CopyToBufferMinMaxThreads(
+        buffer, position, values.data(), size, min, max, 4, Pool());
+    EXPECT_EQ(position, buffer.size());
+    EXPECT_EQ(min, -50000);
+    EXPECT_EQ(max, static_cast<int64_t>(size) - 50001);
+}
+
+INSTANTIATE_TEST_CASE_P(Pool, ThreadPoolTest, ::testing::Values(true, false));
+
+TEST(ThreadPoolNestedTest, NestedRun)
+{
+    ThreadPool pool(2);
+    std::atomic<size_t> runs(0);
+
+    // every worker can be blocked in an outer task, callers take part in
+    // their own Run so inner ones still finish
+    pool.Run(8,
+             [&](const size_t) {
+                 pool.Run(100, [&](const size_t) { ++runs; }, 4);
+             },
+             4);
+
+    EXPECT_EQ(runs, 800);
+    EXPECT_LE(pool.Workers(), 2);
+}
+
+TEST(ThreadPoolNestedTest, ConcurrentIOs)
+{
+    adios2::core::ADIOS adios(MPI_COMM_SELF, true);
+    adios2::core::IO &io1 = adios.DeclareIO("IO1");
+    adios2::core::IO &io2 = adios.DeclareIO("IO2");
+
+    // one pool per ADIOS
+    ASSERT_NE(io1.m_ThreadPool, nullptr);
+    EXPECT_EQ(io1.m_ThreadPool, io2.m_ThreadPool);
+
+    const size_t tasks = 64;
+    const size_t rounds = 200;
+
+    auto lf_Submit = [&](adios2::core::IO &io, std::atomic<size_t> &runs) {
+        for (size_t r = 0; r < rounds; ++r)
+        {
+            std::future<void> job = adios2::helper::SubmitTask(
+                io.m_ThreadPool, [&runs]() { ++runs; });
+            adios2::helper::RunTasks(io.m_ThreadPool, tasks,
+                                     [&runs](const size_t) { ++runs; }, 3);
+            job.get();
+        }
+    };
+
+    std::atomic<size_t> runs1(0);
+    std::atomic<size_t> runs2(0);
+    std::thread thread1(lf_Submit, std::ref(io1), std::ref(runs1));
+    std::thread thread2(lf_Submit, std::ref(io2), std::ref(runs2));
+    thread1.join();
+    thread2.join();
+
+    EXPECT_EQ(runs1, rounds * (tasks + 1));
+    EXPECT_EQ(runs2, rounds * (tasks + 1));
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#ifdef ADIOS2_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
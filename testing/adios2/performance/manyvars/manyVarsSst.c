@@ -0,0 +1,275 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+
+/* ADIOS2 C performance test:
+ *  Stream a huge number of variables through the SST engine.
+ *  The first half of the processes write, the second half read and check
+ *  all variables at every step. The time per step divided by the number of
+ *  variables should not grow with the number of variables.
+ *  Note: FFS format descriptions are limited to 64KB, which caps FFS
+ *  marshaling at about 250 array variables per stream.
+ *
+ * How to run: mpirun -np <2N> PerfManyVarsSst <nvars> <steps> [marshal]
+ *
+ */
+#include "adios2_c.h"
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define log(...)                                                               \
+    fprintf(stderr, "[%s rank=%3.3d, line %d]: ", role, rank, __LINE__);     \
+    fprintf(stderr, __VA_ARGS__);                                              \
+    fflush(stderr);
+#define printE(...)                                                            \
+    fprintf(stderr, "[%s rank=%3.3d, line %d]: ERROR: ", role, rank,          \
+            __LINE__);                                                         \
+    fprintf(stderr, __VA_ARGS__);                                              \
+    fflush(stderr);
+
+int NVARS = 1;
+int NSTEPS = 1;
+const char *MARSHAL = "FFS";
+static const char STREAMNAME[] = "many_vars_sst";
+#define VALUE(rank, step, var) (step * 10000 + 100 * rank + var % 100)
+
+static const int ldim1 = 5;
+static const int ldim2 = 5;
+
+MPI_Comm comm;
+int rank;
+int size;
+const char *role;
+char **varnames;
+int *a2;
+
+void alloc_vars()
+{
+    int i;
+    a2 = (int *)malloc(ldim1 * ldim2 * sizeof(int));
+    varnames = (char **)malloc(NVARS * sizeof(char *));
+
+    /* make varnames like v001,v002,.. */
+    int digit = 1, d = 10;
+    while (NVARS / d > 0)
+    {
+        d *= 10;
+        digit++;
+    }
+
+    char fmt[16];
+    sprintf(fmt, "v%%%d.%dd", digit, digit);
+    for (i = 0; i < NVARS; i++)
+    {
+        varnames[i] = (char *)malloc(16);
+        sprintf(varnames[i], fmt, i);
+    }
+}
+
+void fini_vars()
+{
+    int i;
+    free(a2);
+    for (i = 0; i < NVARS; i++)
+    {
+        free(varnames[i]);
+    }
+    free(varnames);
+}
+
+void Usage()
+{
+    printf("Usage: PerfManyVarsSst <nvars> <nsteps> [marshal]\n"
+           "    <nvars>:   Number of variables to generate\n"
+           "    <nsteps>:  Number of steps to stream\n"
+           "    [marshal]: SST MarshalMethod, FFS (default) or BP\n"
+           "  Run with an even number of processes, half write, half read\n");
+}
+
+void set_io(adios2_io *io)
+{
+    adios2_set_engine(io, "SST");
+    adios2_set_parameter(io, "MarshalMethod", MARSHAL);
+    adios2_set_parameter(io, "RendezvousReaderCount", "1");
+}
+
+int write_stream(adios2_adios *adiosH)
+{
+    int step, v, i;
+    double tb, tput, tend;
+    size_t shape[2] = {size * ldim1, ldim2};
+    size_t start[2] = {rank * ldim1, 0};
+    size_t count[2] = {ldim1, ldim2};
+
+    adios2_io *ioW = adios2_declare_io(adiosH, "manyvarswrite");
+    set_io(ioW);
+    adios2_variable **varW =
+        (adios2_variable **)malloc(NVARS * sizeof(adios2_variable *));
+    for (v = 0; v < NVARS; v++)
+    {
+        varW[v] =
+            adios2_define_variable(ioW, varnames[v], adios2_type_int, 2, shape,
+                                   start, count, adios2_constant_dims_true);
+    }
+
+    adios2_engine *engineW = adios2_open(ioW, STREAMNAME, adios2_mode_write);
+
+    for (step = 0; step < NSTEPS; step++)
+    {
+        tb = MPI_Wtime();
+        adios2_begin_step(engineW, adios2_step_mode_append, 0.0);
+        for (v = 0; v < NVARS; v++)
+        {
+            for (i = 0; i < ldim1 * ldim2; i++)
+            {
+                a2[i] = VALUE(rank, step, v);
+            }
+            adios2_put(engineW, varW[v], a2, adios2_mode_sync);
+        }
+        tput = MPI_Wtime();
+        adios2_end_step(engineW);
+        tend = MPI_Wtime();
+
+        if (rank == 0)
+        {
+            log("  Step %d: Put %6.3lf s, EndStep %6.3lf s, %7.3lf us/var\n",
+                step, tput - tb, tend - tput, 1e6 * (tend - tb) / NVARS);
+        }
+    }
+
+    adios2_close(engineW);
+    free(varW);
+    return 0;
+}
+
+int read_stream(adios2_adios *adiosH)
+{
+    int err = 0, step = 0, v, i;
+    double tb, tbegin, tend;
+    size_t start[2] = {rank * ldim1, 0};
+    size_t count[2] = {ldim1, ldim2};
+
+    adios2_io *ioR = adios2_declare_io(adiosH, "manyvarsread");
+    set_io(ioR);
+    adios2_engine *engineR = adios2_open(ioR, STREAMNAME, adios2_mode_read);
+
+    while (adios2_begin_step(engineR, adios2_step_mode_next_available, -1.0) ==
+           adios2_step_status_ok)
+    {
+        tb = MPI_Wtime();
+        tbegin = tb;
+        for (v = 0; v < NVARS; v++)
+        {
+            adios2_variable *varH = adios2_inquire_variable(ioR, varnames[v]);
+            if (varH == NULL)
+            {
+                printE("No such variable: %s\n", varnames[v]);
+                err = 101;
+                break;
+            }
+            adios2_set_selection(varH, 2, start, count);
+            adios2_get(engineR, varH, a2, adios2_mode_sync);
+            for (i = 0; i < ldim1 * ldim2; i++)
+            {
+                if (a2[i] != VALUE(rank, step, v))
+                {
+                    printE("%s[%d] step %d: wrote %d but read %d\n",
+                           varnames[v], i, step, VALUE(rank, step, v), a2[i]);
+                    err = 104;
+                    break;
+                }
+            }
+        }
+        adios2_end_step(engineR);
+        tend = MPI_Wtime();
+
+        if (rank == 0)
+        {
+            log("  Step %d: Get %6.3lf s, %7.3lf us/var\n", step,
+                tend - tbegin, 1e6 * (tend - tb) / NVARS);
+        }
+        ++step;
+    }
+
+    adios2_close(engineR);
+    if (step != NSTEPS)
+    {
+        printE("read %d steps, expected %d\n", step, NSTEPS);
+        err = 105;
+    }
+    return err;
+}
+
+int main(int argc, char **argv)
+{
+    int err = 0, i, wrank, wsize;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &wsize);
+
+    if (argc < 3 || wsize % 2)
+    {
+        if (!wrank)
+        {
+            Usage();
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    errno = 0;
+    i = strtol(argv[1], NULL, 10);
+    if (errno || i < 1)
+    {
+        printf("Invalid 1st argument %s\n", argv[1]);
+        Usage();
+        MPI_Finalize();
+        return 1;
+    }
+    NVARS = i;
+
+    i = strtol(argv[2], NULL, 10);
+    if (errno || i < 1)
+    {
+        printf("Invalid 2nd argument %s\n", argv[2]);
+        Usage();
+        MPI_Finalize();
+        return 1;
+    }
+    NSTEPS = i;
+
+    if (argc > 3)
+    {
+        MARSHAL = argv[3];
+    }
+
+    const int color = (wrank < wsize / 2) ? 0 : 1;
+    role = color ? "reader" : "writer";
+    MPI_Comm_split(MPI_COMM_WORLD, color, wrank, &comm);
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    alloc_vars();
+    adios2_adios *adiosH = adios2_init(comm, adios2_debug_mode_on);
+
+    if (color == 0)
+    {
+        err = write_stream(adiosH);
+    }
+    else
+    {
+        err = read_stream(adiosH);
+    }
+
+    adios2_finalize(adiosH);
+    fini_vars();
+    MPI_Comm_free(&comm);
+    MPI_Finalize();
+    return err;
+}